@@ -110,6 +110,13 @@ public:
      */
     services::SharedPtr<services::ErrorCollection> getErrors() DAAL_C11_OVERRIDE { return _status.getCollection(); }
 
+    /**
+     * Returns the statistics of the temporary buffers allocated by the calling thread during the last call of the compute method.
+     * The buffers of the worker threads of the parallel loops and of the computations run in other threads are not included
+     * \return Statistics of the temporary buffers
+     */
+    const services::ScratchMemoryStatistics & getScratchMemoryStatistics() const { return _scratchStatistics; }
+
 private:
     bool _enableChecks;
 
@@ -125,6 +132,7 @@ protected:
 
     daal::services::Environment::env _env;
     services::Status _status;
+    services::ScratchMemoryStatistics _scratchStatistics;
 };
 
 /** @} */
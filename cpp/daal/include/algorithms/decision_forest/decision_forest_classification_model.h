@@ -121,6 +121,22 @@ public:
     */
     virtual void traverseBFS(size_t iTree, tree_utils::classification::TreeNodeVisitor & visitor) const = 0;
 
+    /**
+     *  Writes the model to the file in the flat format that Model::createFromFile loads without copying the trees
+     *  \param[in] path  Path to the file
+     *  \return Status of the operation
+     */
+    services::Status writeFile(const char * path) const;
+
+    /**
+     *  Loads the model from the file written by Model::writeFile. The file is mapped into memory:
+     *  the trees are not copied, and the prediction reads the nodes from the pages of the file loaded on demand
+     *  \param[in]  path  Path to the file
+     *  \param[out] stat  Status of the model loading
+     *  \return Model that keeps the file mapped while it exists
+     */
+    static services::SharedPtr<Model> createFromFile(const char * path, services::Status * stat = NULL);
+
 protected:
     Model() : classifier::Model() {}
 };
@@ -95,7 +95,7 @@ namespace interface3
  * \snippet decision_forest/decision_forest_classification_training_types.h Parameter source code
  */
 /* [Parameter source code] */
-struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algorithms::decision_forest::training::Parameter
+struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algorithms::decision_forest::training::interface2::Parameter
 {
     /** Default constructor */
     Parameter(size_t nClasses) : classifier::Parameter(nClasses) {}
@@ -104,6 +104,27 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 /* [Parameter source code] */
 } // namespace interface3
 
+/**
+ * \brief Contains version 4.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface4
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__PARAMETER"></a>
+ * \brief Decision forest algorithm parameters
+ *
+ * \snippet decision_forest/decision_forest_classification_training_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algorithms::decision_forest::training::interface3::Parameter
+{
+    /** Default constructor */
+    Parameter(size_t nClasses) : classifier::Parameter(nClasses) {}
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+} // namespace interface4
+
 namespace interface1
 {
 /**
@@ -198,7 +219,7 @@ private:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
-using interface3::Parameter;
+using interface4::Parameter;
 using interface1::Result;
 using interface1::ResultPtr;
 
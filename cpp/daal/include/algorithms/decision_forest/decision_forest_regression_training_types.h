@@ -123,7 +123,7 @@ namespace interface2
  * \snippet decision_forest/decision_forest_regression_training_types.h Parameter source code
  */
 /* [Parameter source code] */
-class DAAL_EXPORT Parameter : public daal::algorithms::Parameter, public daal::algorithms::decision_forest::training::Parameter
+class DAAL_EXPORT Parameter : public daal::algorithms::Parameter, public daal::algorithms::decision_forest::training::interface2::Parameter
 {
 public:
     Parameter();
@@ -132,6 +132,27 @@ public:
 /* [Parameter source code] */
 } // namespace interface2
 
+/**
+ * \brief Contains version 3.0 of the Intel(R) oneAPI Data Analytics Library interface
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSION__PARAMETER"></a>
+ * \brief Parameters for the decision forest algorithm
+ *
+ * \snippet decision_forest/decision_forest_regression_training_types.h Parameter source code
+ */
+/* [Parameter source code] */
+class DAAL_EXPORT Parameter : public daal::algorithms::Parameter, public daal::algorithms::decision_forest::training::interface3::Parameter
+{
+public:
+    Parameter();
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+} // namespace interface3
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface
  */
@@ -266,7 +287,7 @@ private:
 typedef services::SharedPtr<Result> ResultPtr;
 } // namespace interface1
 
-using interface2::Parameter;
+using interface3::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -28,6 +28,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/data_serialize.h"
 #include "services/daal_defines.h"
+#include "services/daal_string.h"
 #include "algorithms/engines/mt2203/mt2203.h"
 
 namespace daal
@@ -133,7 +134,36 @@ public:
 };
 /* [Parameter source code] */
 } // namespace interface2
-using interface2::Parameter;
+
+/**
+ * \brief Contains version 3.0 of the Intel(R) oneAPI Data Analytics Library interface
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__TRAINING__PARAMETER"></a>
+ * \brief Parameters for the decision forest algorithm
+ *
+ * \snippet decision_forest/decision_forest_training_parameter.h Parameter source code
+ */
+/* [Parameter source code] */
+class DAAL_EXPORT Parameter : public interface2::Parameter
+{
+public:
+    /**
+     * Construct parameters of decision forest algorithm
+     */
+    Parameter();
+
+    bool outOfCoreMode;                  /*!< If true then the indexed (binned in case of 'hist' split finding method) training data
+                                               is kept in a temporary memory-mapped file on local disk instead of the main memory.
+                                               Not used in memory saving mode. Default is false */
+    services::String outOfCoreDirectory; /*!< Used with outOfCoreMode only. Directory on local disk for the temporary file.
+                                               Default is empty (TMPDIR environment variable or /tmp is used) */
+};
+/* [Parameter source code] */
+} // namespace interface3
+using interface3::Parameter;
 /** @} */
 } // namespace training
 } // namespace decision_forest
@@ -36,12 +36,15 @@ namespace em_gmm
  */
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__COVARIANCESTORAGEID"></a>
- * Available identifiers of covariance types in the EM for GMM algorithm
+ * Available identifiers of covariance types in the EM for GMM algorithm.
+ * With the diagonal and spherical covariances, the probabilities of the observations are computed using matrix multiplication
+ * only in double precision. In single precision the distances to the means are computed directly to preserve accuracy
  */
 enum CovarianceStorageId
 {
-    full,
-    diagonal
+    full,     /*!< Full covariance matrix of size nFeatures x nFeatures */
+    diagonal, /*!< Diagonal of the covariance matrix stored as 1 x nFeatures table */
+    spherical /*!< Single variance of the component stored as 1 x nFeatures table with equal elements */
 };
 
 /** @} */
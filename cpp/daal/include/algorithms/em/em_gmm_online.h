@@ -0,0 +1,210 @@
+/* file: em_gmm_online.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the EM for GMM algorithm in the
+//  online processing mode
+//--
+*/
+
+#ifndef __EM_GMM_ONLINE_H__
+#define __EM_GMM_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/em/em_gmm_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+/**
+ * @defgroup em_gmm_online Online
+ * @ingroup em_gmm_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the EM for GMM algorithm.
+ *        This class is associated with the Online class and supports the method of computing EM for GMM in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the EM for GMM algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    ~OnlineContainer();
+    /**
+     * Updates the partial result of the EM for GMM algorithm with the next block of data
+     * in the online processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the parameters of the Gaussian mixture model from the partial result
+     * in the online processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__ONLINE"></a>
+ * \brief Computes EM for GMM in the online processing mode.
+ *        Every block of data runs one expectation step with the current parameters of the model and blends
+ *        the sufficient statistics of the block into the running ones with the decreasing step size (stepwise EM).
+ *        Initial weights, means and covariances are used as the starting point of the first block
+ * <!-- \n<a href="DAAL-REF-EM_GMM-ALGORITHM">EM for GMM algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the EM for GMM algorithm, double or float
+ * \tparam method           EM for GMM computation method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for EM for GMM
+ *      - \ref InputId          Identifiers of input objects for EM for GMM
+ *      - \ref PartialResultId  Identifiers of partial results of EM for GMM
+ *      - \ref ResultId         Result identifiers for EM for GMM
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef algorithms::em_gmm::Input InputType;
+    typedef algorithms::em_gmm::OnlineParameter ParameterType;
+    typedef algorithms::em_gmm::Result ResultType;
+    typedef algorithms::em_gmm::PartialResult PartialResultType;
+
+    Online(const size_t nComponents);
+
+    /**
+     * Constructs an EM for GMM algorithm by copying input objects and parameters
+     * of another EM for GMM algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains results of the EM for GMM algorithm
+     * \return Structure that contains results of the EM for GMM algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Sets the memory for storing results of the EM for GMM algorithm
+     * \param[in] result  Structure for storing results of the EM for GMM algorithm
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the EM for GMM algorithm
+     * \return Structure that contains partial results of the EM for GMM algorithm
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Sets the memory for storing partial results of the EM for GMM algorithm
+     * \param[in] partialResult  Structure for storing partial results of the EM for GMM algorithm
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult)
+        _partialResult = partialResult;
+        _pres          = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated EM for GMM algorithm with a copy of input objects
+     * of this EM for GMM algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const { return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Online<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
+        _res               = _result.get();
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    void initialize();
+
+public:
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameter data structure */
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+
+    Online & operator=(const Online &);
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -110,6 +110,23 @@ enum ResultCovariancesId
     lastResultCovariancesId = covariances
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the EM for GMM algorithm in the online processing mode.
+ * Partial results are the running averages of the sufficient statistics of the Gaussian mixture model
+ */
+enum PartialResultId
+{
+    sumOfResponsibilities,      /*!< Table 1 x nComponents with the averaged responsibilities of the components */
+    sumOfWeightedData,          /*!< Table nComponents x nFeatures with the averaged responsibility-weighted observations */
+    sumOfWeightedCrossProducts, /*!< Table nComponents x (nFeatures * nFeatures) with the averaged responsibility-weighted cross products
+                                     of the observations or table nComponents x nFeatures with their diagonals for diagonal and spherical
+                                     covariance storages */
+    partialGoalFunction,        /*!< Table 1 x 1 with the averaged log-likelihood of one observation */
+    nProcessedBlocks,           /*!< Table 1 x 1 with the number of processed blocks of data */
+    lastPartialResultId = nProcessedBlocks
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -154,6 +171,44 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__EM_GMM__ONLINEPARAMETER"></a>
+ * \brief %Parameter for the EM for GMM algorithm in the online processing mode.
+ *        Sufficient statistics are updated with the step size (t + 1 + stepSizeOffset)^(-stepSizeDecay) on the t-th block of data,
+ *        t = 1, 2, ..., the initial weights, means and covariances are taken as the statistics of the zeroth block
+ *
+ * \snippet em/em_gmm_types.h OnlineParameter source code
+ */
+/* [OnlineParameter source code] */
+struct DAAL_EXPORT OnlineParameter : public Parameter
+{
+    /**
+     * Constructs the parameter of EM for GMM algorithm in the online processing mode
+     * \param[in] nComponents              Number of components in the Gaussian mixture model
+     * \param[in] covariance               Pointer to the algorithm that computes the covariance
+     * \param[in] stepSizeOffset           Non-negative offset of the number of processed blocks in the step size,
+     *                                     larger values slow down the forgetting of early blocks
+     * \param[in] stepSizeDecay            Power of the decay of the step size, must be in the interval (0.5, 1]
+     * \param[in] regularizationFactor     Factor for covariance regularization in case of ill-conditional data
+     * \param[in] covarianceStorage        Type of covariance in the Gaussian mixture model.
+     */
+    OnlineParameter(const size_t nComponents, const services::SharedPtr<covariance::BatchImpl> & covariance, const double stepSizeOffset = 0.0,
+                    const double stepSizeDecay = 0.6, const double regularizationFactor = 0.01, const CovarianceStorageId covarianceStorage = full);
+
+    OnlineParameter(const OnlineParameter & other);
+
+    virtual ~OnlineParameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual services::Status check() const;
+
+    double stepSizeOffset; /*!< Offset of the number of processed blocks in the step size */
+    double stepSizeDecay;  /*!< Power of the decay of the step size */
+};
+/* [OnlineParameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__INPUT"></a>
  * \brief %Input objects for the EM for GMM algorithm
@@ -297,12 +352,87 @@ protected:
     }
 };
 typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the EM for GMM algorithm in the online processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult)
+    /** Default constructor */
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory for storing partial results of the EM for GMM algorithm
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Initializes memory for storing partial results of the EM for GMM algorithm
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns the partial result of the EM for GMM algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the EM for GMM algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the numeric table with the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Checks the partial result of the EM for GMM algorithm
+     * \param[in] input   %Input of the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the EM for GMM algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nComponents, size_t nFeatures, const Parameter * par) const;
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::OnlineParameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 
 } // namespace em_gmm
 } // namespace algorithms
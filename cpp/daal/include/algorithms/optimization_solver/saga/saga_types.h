@@ -54,7 +54,8 @@ namespace saga
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method */
+    defaultDense = 0, /*!< Default: performance-oriented method */
+    hogwild      = 1  /*!< Asynchronous method: updates are applied by several threads without locks */
 };
 
 /**
@@ -223,7 +224,49 @@ typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface2
 
-using interface2::Parameter;
+/**
+ * \brief Contains version 3.0 of the Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__SAGA__PARAMETER"></a>
+ * \brief %Parameter base class for the Stochastic average  gradient descent algorithm
+ *
+ * \snippet optimization_solver/saga/saga_types.h Parameter3 source code
+ */
+/* [Parameter3 source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /**
+     * Constructs the parameter base class of the Stochastic average  gradient descent algorithm
+     * \param[in] function                 Objective function represented as sum of functions
+     * \param[in] nIterations              Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold        Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices             Numeric table that represents 32 bit integer indices of terms in the objective function.
+     *                                      If no indices are provided, the implementation will generate random indices.
+     * \param[in] batchSize                Number of batch indices to compute the stochastic gradient. If batchSize is equal to the number of terms
+                                            in objective function then no random sampling is performed, and all terms are used to calculate the gradient.
+                                            This parameter is ignored if batchIndices is provided.
+     * \param[in] learningRateSequence     Numeric table that contains value of the learning rate
+     * \param[in] seed                     Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     * \param[in] deterministic            Applicable for hogwild method only. If true, all updates are applied by one thread
+     *                                      in the order of batch indices, that gives reproducible results
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              const data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), const size_t batchSize = 128,
+              const data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(), size_t seed = 777,
+              bool deterministic = false);
+
+    virtual ~Parameter() {}
+
+    bool deterministic; /*!< Applicable for hogwild method only. If true, all updates are applied
+                             by one thread in the order of batch indices, that gives reproducible results */
+};
+/* [Parameter3 source code] */
+} // namespace interface3
+
+using interface3::Parameter;
 using interface2::Input;
 using interface2::Result;
 using interface2::ResultPtr;
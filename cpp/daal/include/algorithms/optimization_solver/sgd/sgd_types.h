@@ -56,7 +56,9 @@ enum Method
 {
     defaultDense = 0, /*!< Default: Required gradient is computed using only one term of objective function */
     miniBatch    = 1, /*!< Required gradient is computed using batchSize terms of objective function  */
-    momentum     = 2  /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    momentum     = 2, /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    hogwild      = 3  /*!< Required gradient is computed using batchSize terms of objective function, updates are applied
+                           asynchronously by several threads without locks (Hogwild!) */
 };
 
 /**
@@ -256,6 +258,49 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 /* [ParameterMomentum source code] */
 /** @} */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_HOGWILD"></a>
+ * \brief %Parameter for the asynchronous lock-free (Hogwild!) Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterHogwild source code
+ */
+/* [ParameterHogwild source code] */
+template <>
+struct DAAL_EXPORT Parameter<hogwild> : public BaseParameter
+{
+    /**
+     * Constructs the parameter class of the asynchronous Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal number of iterations (updates of the argument) of the algorithm
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                       are provided, the implementation will generate random indices.
+     * \param[in] batchSize            Number of batch indices to compute the stochastic gradient of one update.
+                                       This parameter is ignored if batchIndices is provided.
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     * \param[in] deterministic        If true, all updates are applied by one thread in the order of batch indices, that gives reproducible results
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), size_t batchSize = 1,
+              data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t seed = 777, bool deterministic = false);
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    bool deterministic; /*!< If true, all updates are applied by one thread in the order of batch indices, that gives reproducible results */
+};
+/* [ParameterHogwild source code] */
+/** @} */
+
 /**
 * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__INPUT"></a>
 * \brief %Input for the Stochastic gradient descent algorithm
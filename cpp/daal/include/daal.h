@@ -52,6 +52,7 @@
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/mapped_numeric_table.h"
 #include "data_management/data/symmetric_matrix.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "algorithms/classifier/classifier_training_batch.h"
@@ -135,6 +136,7 @@
 #include "algorithms/svm/svm_quality_metric_set_batch.h"
 #include "algorithms/svm/svm_quality_metric_set_types.h"
 #include "algorithms/em/em_gmm.h"
+#include "algorithms/em/em_gmm_online.h"
 #include "algorithms/em/em_gmm_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm_init_types.h"
@@ -196,9 +196,157 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__BLOCKCOMPRESSIONPARAMETER"></a>
+ * \brief Parameters of the block-parallel compression and decompression streams
+ */
+struct DAAL_EXPORT BlockCompressionParameter
+{
+    /**
+     * %BlockCompressionParameter constructor
+     * \param blockSize Size in bytes of the raw data blocks that are compressed independently
+     */
+    BlockCompressionParameter(size_t blockSize = 1024 * 1024) : blockSize(blockSize) {}
+
+    size_t blockSize; /*!< Size in bytes of the raw data blocks that are compressed independently */
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKCOMPRESSIONSTREAM"></a>
+ * \brief %BlockCompressionStream splits the input data into blocks of fixed size and compresses
+ *        them independently and in parallel. The compressed data is a sequence of frames:
+ *        each frame starts with a header and an index of its blocks, so that the frame can be
+ *        decompressed in parallel by the %BlockDecompressionStream and any single block can be
+ *        decompressed without touching the others.
+ *        A frame is closed when the compressed data is requested from the stream.
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - BlockCompressionParameter structure
+ */
+class DAAL_EXPORT BlockCompressionStream : public CompressionStream
+{
+public:
+    /**
+     * %BlockCompressionStream constructor
+     * \param compr Pointer to a specific Compressor used for compression.
+     *              Compressors provided by the library are cloned to compress blocks in parallel,
+     *              other compressors are used to compress the blocks sequentially
+     * \param par   Parameters of the block compression
+     */
+    BlockCompressionStream(CompressorImpl * compr, const BlockCompressionParameter & par = BlockCompressionParameter());
+    virtual ~BlockCompressionStream() DAAL_C11_OVERRIDE;
+
+    using CompressionStream::copyCompressedArray;
+
+    /**
+     * Writes the next DataBlock to %BlockCompressionStream and compresses the filled blocks
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    void push_back(DataBlock * inBlock) DAAL_C11_OVERRIDE;
+    /**
+     * Closes the current frame and provides access to its compressed data
+     * \return Pointer to a \ref DataBlockCollection, the concatenation of its blocks forms the frames
+     */
+    DataBlockCollectionPtr getCompressedBlocksCollection() DAAL_C11_OVERRIDE;
+    /**
+     * Closes the current frame and returns the size of compressed data stored in %BlockCompressionStream
+     * \return Size in bytes
+     */
+    size_t getCompressedDataSize() DAAL_C11_OVERRIDE;
+    /**
+     * Closes the current frame and copies compressed data stored in %BlockCompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    size_t copyCompressedArray(byte * outPtr, size_t outSize) DAAL_C11_OVERRIDE;
+
+private:
+    void * _impl;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKDECOMPRESSIONSTREAM"></a>
+ * \brief %BlockDecompressionStream decompresses frames produced by the %BlockCompressionStream.
+ *        The blocks of the received frames are decompressed in parallel, and every block
+ *        can also be decompressed separately using the block index of its frame.
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ */
+class DAAL_EXPORT BlockDecompressionStream : public DecompressionStream
+{
+public:
+    /**
+     * %BlockDecompressionStream constructor
+     * \param decompr Pointer to a specific Decompressor used for decompression.
+     *                Decompressors provided by the library are cloned to decompress blocks in parallel,
+     *                other decompressors are used to decompress the blocks sequentially
+     */
+    BlockDecompressionStream(DecompressorImpl * decompr);
+    virtual ~BlockDecompressionStream() DAAL_C11_OVERRIDE;
+
+    using DecompressionStream::copyDecompressedArray;
+
+    /**
+     * Writes the next part of the compressed frames to %BlockDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be decompressed
+     */
+    void push_back(DataBlock * inBlock) DAAL_C11_OVERRIDE;
+    /**
+     * Decompresses the received frames and provides access to the decompressed data
+     * \return Pointer to a \ref DataBlockCollection
+     */
+    DataBlockCollectionPtr getDecompressedBlocksCollection() DAAL_C11_OVERRIDE;
+    /**
+     * Returns the size of decompressed data of the received frames. Does not decompress the data
+     * \return Size in bytes
+     */
+    size_t getDecompressedDataSize() DAAL_C11_OVERRIDE;
+    /**
+     * Decompresses the received frames and copies decompressed data to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    size_t copyDecompressedArray(byte * outPtr, size_t outSize) DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the number of compressed blocks in the received frames
+     * \return Number of blocks
+     */
+    size_t getNumberOfBlocks();
+    /**
+     * Returns the size of the decompressed block
+     * \param[in] iBlock Index of the block
+     * \return Size in bytes
+     */
+    size_t getDecompressedBlockSize(size_t iBlock);
+    /**
+     * Decompresses a single block of the received frames to an external array
+     * \param[in]  iBlock  Index of the block
+     * \param[out] outPtr  Pointer to the array where decompressed data is stored
+     * \param[in]  outSize Number of bytes available in external memory, at least getDecompressedBlockSize(iBlock)
+     * \return Size of decompressed data in bytes
+     */
+    size_t copyDecompressedBlock(size_t iBlock, byte * outPtr, size_t outSize);
+    /**
+     * Notifies %BlockDecompressionStream that all the compressed data is written to it.
+     * Reports services::ErrorCompressionIncorrectBlockFrame if the received data ends with an incomplete frame
+     */
+    void closeInput();
+
+private:
+    void * _impl;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::BlockCompressionParameter;
+using interface1::BlockCompressionStream;
+using interface1::BlockDecompressionStream;
 /** @} */
 
 } //namespace data_management
@@ -421,6 +421,22 @@ private:
 
         char * ptr = (char *)(_ptr.get()) + _structSize * idx;
 
+        if (nrows * ncols >= internal::parallelGatherMinSize)
+        {
+            services::Collection<internal::GatherColumn> columns(ncols);
+            if (columns.data())
+            {
+                for (size_t j = 0; j < ncols; j++)
+                {
+                    columns[j].ptr        = ptr + _offsets[j];
+                    columns[j].byteStride = _structSize;
+                    columns[j].indexType  = (*_ddict)[j].indexType;
+                }
+                internal::vectorGatherRows<T>(nrows, ncols, columns.data(), block.getBlockPtr(), ncols);
+                return services::Status();
+            }
+        }
+
         for (size_t j = 0; j < ncols; j++)
         {
             NumericTableFeature & f = (*_ddict)[j];
@@ -516,6 +516,18 @@ public:
         serializedBuffer  = 0;
     }
 
+    /**
+     *  Constructor of a compressed data archive that splits the data into blocks compressed in parallel
+     *  \param[in]  compressor  Pointer to the compressor
+     *  \param[in]  parameter   Parameters of the block compression
+     */
+    CompressedDataArchive(daal::data_management::CompressorImpl * compressor, const BlockCompressionParameter & parameter)
+        : minBlockSize(parameter.blockSize), _errors(new services::ErrorCollection())
+    {
+        compressionStream = new daal::data_management::BlockCompressionStream(compressor, parameter);
+        serializedBuffer  = 0;
+    }
+
     /** \private */
     ~CompressedDataArchive() DAAL_C11_OVERRIDE
     {
@@ -639,6 +651,19 @@ public:
         serializedBuffer    = 0;
     }
 
+    /**
+     *  Constructor of a decompressed data archive for the data compressed in blocks,
+     *  the blocks are decompressed in parallel
+     *  \param[in]  decompressor  Pointer to the decompressor
+     *  \param[in]  parameter     Parameters of the block compression, the block size is read from the compressed data
+     */
+    DecompressedDataArchive(daal::data_management::DecompressorImpl * decompressor, const BlockCompressionParameter & parameter)
+        : minBlockSize(parameter.blockSize), _errors(new services::ErrorCollection())
+    {
+        decompressionStream = new daal::data_management::BlockDecompressionStream(decompressor);
+        serializedBuffer    = 0;
+    }
+
     /** \private */
     ~DecompressedDataArchive() DAAL_C11_OVERRIDE
     {
@@ -449,6 +449,23 @@ public:
         DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(HomogenNumericTable, DataType, featuresEqual, nColumns, nRows, memoryAllocationFlag);
     }
 
+    /**
+     *  Constructs a Numeric Table and allocates memory of the given type for its data.
+     *  With daal::numaPartitioned the rows are split into contiguous ranges, one per NUMA node,
+     *  and each range is placed on its node. With daal::hugePages the data is backed by 2MB pages.
+     *  The memory of the same type is allocated when the table is resized
+     *  \param[in]  nColumns    Number of columns in the table
+     *  \param[in]  nRows       Number of rows in the table
+     *  \param[in]  memoryType  Type of memory to allocate for the data of the numeric table
+     *  \param[out] stat        Status of the numeric table construction
+     *  \return     Numeric table
+     */
+    static services::SharedPtr<HomogenNumericTable<DataType> > create(size_t nColumns, size_t nRows, daal::MemType memoryType,
+                                                                      services::Status * stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(HomogenNumericTable, DataType, DictionaryIface::notEqual, nColumns, nRows, memoryType);
+    }
+
     /**
      *  Constructor for a Numeric Table with memory allocation controlled via a flag and filling the table with a constant
      *  \param[in]  nColumns                Number of columns in the table
@@ -770,7 +787,20 @@ protected:
     HomogenNumericTable(DictionaryIface::FeaturesEqual featuresEqual, size_t nColumns, size_t nRows,
                         NumericTable::AllocationFlag memoryAllocationFlag, const DataType & constValue, services::Status & st);
 
-    services::Status allocateDataMemoryImpl(daal::MemType /*type*/ = daal::dram) DAAL_C11_OVERRIDE
+    HomogenNumericTable(DictionaryIface::FeaturesEqual featuresEqual, size_t nColumns, size_t nRows, daal::MemType memoryType,
+                        services::Status & st)
+        : NumericTable(nColumns, nRows, featuresEqual, st)
+    {
+        _layout = aos;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        st |= _ddict->setAllFeatures(df);
+
+        st |= allocateDataMemoryImpl(memoryType);
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
     {
         freeDataMemoryImpl();
 
@@ -791,11 +821,22 @@ protected:
                                                                 services::ErrorIncorrectNumberOfObservations);
         }
 
-        _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size * sizeof(DataType)), services::ServiceDeleter());
+        const size_t sizeInBytes = size * sizeof(DataType);
+        if (type == daal::hugePages || (type == daal::dram && daal::services::internal::daal_huge_pages_enabled(sizeInBytes)))
+        {
+            _ptr = services::SharedPtr<byte>((byte *)daal::services::internal::daal_huge_pages_calloc(sizeInBytes), services::HugePagesDeleter());
+        }
+        else
+        {
+            byte * data = (type == daal::numaPartitioned) ? (byte *)daal::services::internal::daal_numa_partitioned_calloc(sizeInBytes) :
+                                                            (byte *)daal::services::daal_malloc(sizeInBytes);
+            _ptr = services::SharedPtr<byte>(data, services::ServiceDeleter());
+        }
 
         if (!_ptr) return services::Status(services::ErrorMemoryAllocationFailed);
 
         _memStatus = internallyAllocated;
+        _memType   = type;
         return services::Status();
     }
 
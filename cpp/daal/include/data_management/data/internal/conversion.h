@@ -87,6 +87,32 @@ DAAL_EXPORT vectorConvertFuncType getVectorDownCast(int, int);
 DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideUpCast(int, int);
 DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int, int);
 
+/**
+ *  <a name="DAAL-STRUCT-DATAMANAGEMENT-INTERNAL__GATHERCOLUMN"></a>
+ *  \brief Describes the values of one column to be gathered into a block of rows
+ */
+struct GatherColumn
+{
+    const char * ptr;  /*!< Pointer to the value of the column in the first gathered row */
+    size_t byteStride; /*!< Distance in bytes between the values of the column in the consecutive rows */
+    int indexType;     /*!< Type of the values of the column, features::IndexNumType */
+};
+
+/* Minimal number of values in a block of rows that is gathered from the columns by several threads */
+const size_t parallelGatherMinSize = 65536;
+
+/**
+ *  Converts the values of the columns to T and stores them into the row-major block.
+ *  The rows are split between the threads and transposed in tiles
+ *  \param[in]  nrows     Number of rows to gather
+ *  \param[in]  ncols     Number of columns to gather
+ *  \param[in]  columns   Descriptions of the columns
+ *  \param[out] dst       Pointer to the first gathered value in the block of rows
+ *  \param[in]  dstNCols  Number of values in the row of the block
+ */
+template <typename T>
+DAAL_EXPORT void vectorGatherRows(size_t nrows, size_t ncols, const GatherColumn * columns, T * dst, size_t dstNCols);
+
 /**
  *  <a name="DAAL-CLASS-DATAMANAGEMENT-INTERNAL__VECTORUPCAST"></a>
  *  \brief Class to cast vector up from T type to U
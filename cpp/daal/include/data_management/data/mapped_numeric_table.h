@@ -0,0 +1,93 @@
+/* file: mapped_numeric_table.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a heterogeneous table stored in a memory-mapped columnar file.
+//--
+*/
+
+#ifndef __MAPPED_NUMERIC_TABLE_H__
+#define __MAPPED_NUMERIC_TABLE_H__
+
+#include "data_management/data/soa_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored in a columnar binary file mapped into memory.
+ *         The file is not read on creation of the table: the pages of the columns are loaded on demand
+ *         and shared with the page cache of the OS, so several processes that open the same file
+ *         use a single copy of its data. The values written to the table are private to the process
+ *         and never reach the file.
+ *
+ *  The file consists of the following parts, all the numbers are stored in the native byte order:
+ *  - header: 8-byte signature "DAALCOLF", 32-bit version, 32-bit alignment of the columns,
+ *    64-bit number of rows, 64-bit number of columns, 64-bit offset of the dictionary, 64-bit reserved value;
+ *  - dictionary: for each column 32-bit features::IndexNumType, 32-bit features::FeatureType,
+ *    64-bit number of categories, 64-bit size of the value in bytes and 64-bit offset of the column values;
+ *  - column values stored contiguously, the offset of each column is a multiple of the alignment.
+ *
+ *  Blocks of column values of the same type as the feature point directly into the mapped file,
+ *  blocks of rows are gathered from the columns.
+ */
+class DAAL_EXPORT MappedNumericTable : public SOANumericTable
+{
+public:
+    /**
+     *  Constructs a numeric table over the columnar file mapped into memory
+     *  \param[in]  path  Path to the file written by MappedNumericTable::writeFile
+     *  \param[out] stat  Status of the numeric table construction
+     *  \return Numeric table that references the data of the file
+     */
+    static services::SharedPtr<MappedNumericTable> create(const char * path, services::Status * stat = NULL);
+
+    /**
+     *  Writes the numeric table into the columnar file that can be mapped with MappedNumericTable::create.
+     *  The features are stored with the types of the dictionary of the table,
+     *  the features of undefined types are stored as double precision values
+     *  \param[in]  path   Path to the file
+     *  \param[in]  table  Numeric table to write
+     *  \return Status of the writing
+     */
+    static services::Status writeFile(const char * path, NumericTable & table);
+
+    virtual ~MappedNumericTable() {}
+
+protected:
+    MappedNumericTable(NumericTableDictionaryPtr ddict, size_t nRows, services::Status & st);
+
+    services::Status mapColumns(const services::SharedPtr<byte> & file, const size_t * offsets);
+};
+typedef services::SharedPtr<MappedNumericTable> MappedNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::MappedNumericTable;
+using interface1::MappedNumericTablePtr;
+
+} // namespace data_management
+} // namespace daal
+#endif
@@ -25,6 +25,7 @@
 #define __MERGED_NUMERIC_TABLE_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/internal/conversion.h"
 #include "services/daal_memory.h"
 #include "services/daal_defines.h"
 #include "data_management/data/data_serialize.h"
@@ -249,6 +250,22 @@ private:
     template <typename T>
     void internal_inner_repack(size_t pos, size_t cols, size_t rows, size_t ncols, T * src, T * dst)
     {
+        if (rows * cols >= internal::parallelGatherMinSize)
+        {
+            services::Collection<internal::GatherColumn> columns(cols);
+            if (columns.data())
+            {
+                for (size_t j = 0; j < cols; j++)
+                {
+                    columns[j].ptr        = (const char *)(src + j);
+                    columns[j].byteStride = sizeof(T) * cols;
+                    columns[j].indexType  = features::internal::getIndexNumType<T>();
+                }
+                internal::vectorGatherRows<T>(rows, cols, columns.data(), dst + pos, ncols);
+                return;
+            }
+        }
+
         size_t i, j;
 
         for (i = 0; i < rows; i++)
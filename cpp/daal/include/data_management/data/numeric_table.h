@@ -706,6 +706,7 @@ public:
         _layout            = layout_unknown;
         _memStatus         = notAllocated;
         _normalizationFlag = NumericTable::nonNormalized;
+        _memType           = daal::dram;
     }
 
     /**
@@ -719,6 +720,7 @@ public:
         _layout            = layout_unknown;
         _memStatus         = notAllocated;
         _normalizationFlag = NumericTable::nonNormalized;
+        _memType           = daal::dram;
     }
 
     /**
@@ -734,6 +736,7 @@ public:
         _layout            = layout_unknown;
         _memStatus         = notAllocated;
         _normalizationFlag = NumericTable::nonNormalized;
+        _memType           = daal::dram;
     }
 
     /** \private */
@@ -757,7 +760,7 @@ public:
         services::Status s = setNumberOfRowsImpl(nrows);
         if ((_memStatus != userAllocated && obsnum < nrows) || _memStatus == notAllocated)
         {
-            s |= allocateDataMemoryImpl();
+            s |= allocateDataMemoryImpl(_memType);
         }
         return s;
     }
@@ -950,13 +953,20 @@ protected:
 
     services::Status _status;
 
+    daal::MemType _memType; /*!< Type of the memory allocated for the data, the same type is allocated on resize */
+
 protected:
     NumericTable(NumericTableDictionaryPtr ddict, services::Status & /*st*/)
-        : _ddict(ddict), _obsnum(0), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized)
+        : _ddict(ddict),
+          _obsnum(0),
+          _memStatus(notAllocated),
+          _layout(layout_unknown),
+          _normalizationFlag(NumericTable::nonNormalized),
+          _memType(daal::dram)
     {}
 
     NumericTable(size_t featnum, size_t obsnum, DictionaryIface::FeaturesEqual featuresEqual, services::Status & st)
-        : _obsnum(obsnum), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized)
+        : _obsnum(obsnum), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized), _memType(daal::dram)
     {
         _ddict = NumericTableDictionary::create(featnum, featuresEqual, &st);
         if (!st) return;
@@ -395,6 +395,22 @@ protected:
                 computed         = data_management::internal::getVector<T>()(nrows, ncols, buffer, ptrMin, _wrapOffsets.get());
             }
         }
+        if (!computed && nrows * ncols >= data_management::internal::parallelGatherMinSize)
+        {
+            services::Collection<data_management::internal::GatherColumn> columns(ncols);
+            if (columns.data())
+            {
+                for (size_t j = 0; j < ncols; ++j)
+                {
+                    NumericTableFeature & f = (*_ddict)[j];
+                    columns[j].ptr          = (char *)_arrays[j].get() + idx * f.typeSize;
+                    columns[j].byteStride   = f.typeSize;
+                    columns[j].indexType    = f.indexType;
+                }
+                data_management::internal::vectorGatherRows<T>(nrows, ncols, columns.data(), buffer, ncols);
+                computed = true;
+            }
+        }
         if (!computed)
         {
             size_t di = 32;
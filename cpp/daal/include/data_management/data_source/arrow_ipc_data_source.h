@@ -0,0 +1,405 @@
+/* file: arrow_ipc_data_source.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that reads record batches of the Apache Arrow IPC format.
+//--
+*/
+
+#ifndef __ARROW_IPC_DATA_SOURCE_H__
+#define __ARROW_IPC_DATA_SOURCE_H__
+
+#include <limits>
+#include <memory>
+#include <arrow/record_batch.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/util/config.h>
+
+#include "services/daal_memory.h"
+#include "data_management/data_source/data_source.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/internal/conversion.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ARROWIPCDATASOURCE"></a>
+ *  \brief Specifies methods to access record batches of the Apache Arrow IPC stream or file format.
+ *         Each call to loadDataBlock() yields the next record batch as a SOANumericTable whose columns
+ *         point to the buffers of the batch, so the data is not copied. Floating-point columns
+ *         with null values are copied with the nulls replaced by NaN.
+ *
+ *  The data source is intended to feed the online processing mode of the algorithms,
+ *  such as low order moments, covariance or linear regression, one batch at a time:
+ *  \code
+ *  ArrowIPCDataSource dataSource(reader);
+ *  while (dataSource.loadDataBlock() > 0)
+ *  {
+ *      algorithm.input.set(low_order_moments::data, dataSource.getNumericTable());
+ *      algorithm.compute();
+ *  }
+ *  algorithm.finalizeCompute();
+ *  \endcode
+ */
+class ArrowIPCDataSource : public DataSource
+{
+public:
+    using DataSource::loadDataBlock;
+
+    /**
+     *  Constructs the data source that reads the Apache Arrow IPC stream
+     *  \param[in] reader  Reader of the record batches, e.g. arrow::ipc::RecordBatchStreamReader
+     */
+    ArrowIPCDataSource(const std::shared_ptr<arrow::RecordBatchReader> & reader)
+        : DataSource(), _streamReader(reader), _batchOffset(0), _nextBatchIndex(0), _isEndOfData(false)
+    {
+        if (!_streamReader) _status.add(services::ErrorNullPtr);
+    }
+
+    /**
+     *  Constructs the data source that reads the record batches of the Apache Arrow IPC file
+     *  \param[in] reader  Reader of the file with random access to the record batches
+     */
+    ArrowIPCDataSource(const std::shared_ptr<arrow::ipc::RecordBatchFileReader> & reader)
+        : DataSource(), _fileReader(reader), _batchOffset(0), _nextBatchIndex(0), _isEndOfData(false)
+    {
+        if (!_fileReader) _status.add(services::ErrorNullPtr);
+    }
+
+    virtual ~ArrowIPCDataSource() {}
+
+    /**
+     *  Creates the dictionary from the schema of the record batches
+     */
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        if (_dict) return services::throwIfPossible(services::Status(services::ErrorDictionaryAlreadyAvailable));
+
+        const std::shared_ptr<arrow::Schema> schemaPtr = getSchema();
+        if (!schemaPtr) return services::throwIfPossible(services::Status(services::ErrorNullPtr));
+
+        const size_t ncols = static_cast<size_t>(schemaPtr->num_fields());
+        services::Status s;
+        _dict = DataSourceDictionary::create(ncols, DictionaryIface::notEqual, &s);
+        if (!s) return services::throwIfPossible(s);
+
+        for (size_t j = 0; j < ncols; ++j)
+        {
+            DataSourceFeature & f = (*_dict)[j];
+            switch (schemaPtr->field(static_cast<int>(j))->type()->id())
+            {
+            case arrow::Type::UINT8: f.setType<unsigned char>(); break;
+            case arrow::Type::INT8: f.setType<char>(); break;
+            case arrow::Type::UINT16: f.setType<unsigned short>(); break;
+            case arrow::Type::INT16: f.setType<short>(); break;
+            case arrow::Type::UINT32: f.setType<unsigned int>(); break;
+            case arrow::Type::DATE32:
+            case arrow::Type::TIME32:
+            case arrow::Type::INT32: f.setType<int>(); break;
+            case arrow::Type::UINT64: f.setType<DAAL_UINT64>(); break;
+            case arrow::Type::DATE64:
+            case arrow::Type::TIMESTAMP:
+            case arrow::Type::TIME64:
+            case arrow::Type::INT64: f.setType<DAAL_INT64>(); break;
+            case arrow::Type::FLOAT: f.setType<float>(); break;
+            case arrow::Type::DOUBLE: f.setType<double>(); break;
+            default: _dict.reset(); return services::throwIfPossible(services::Status(services::ErrorDataTypeNotSupported));
+            }
+            f.ntFeature.featureType = features::DAAL_CONTINUOUS;
+        }
+        return s;
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
+    {
+        if (!_streamReader && !_fileReader) return DataSourceIface::notReady;
+        return _isEndOfData ? DataSourceIface::endOfData : DataSourceIface::readyForLoad;
+    }
+
+    /**
+     *  Returns the number of rows left in the current record batch,
+     *  the number of rows in the batches that are not read yet is not known
+     */
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE
+    {
+        return _batch ? static_cast<size_t>(_batch->num_rows()) - _batchOffset : 0;
+    }
+
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE
+    {
+        if (_spnt) return services::throwIfPossible(services::Status(services::ErrorNumericTableAlreadyAllocated));
+
+        services::Status s = checkDictionary();
+        if (!s) return s;
+
+        _spnt = SOANumericTable::create(_dict->getNumberOfFeatures(), 0, DictionaryIface::notEqual, &s);
+        if (s) s |= setNumericTableDictionary(_spnt);
+        return s;
+    }
+
+    void freeNumericTable() DAAL_C11_OVERRIDE { _spnt.reset(); }
+
+    /**
+     *  Loads the rest of the current record batch or the next record batch.
+     *  The numeric table of the data source is replaced with the view of the loaded rows
+     *  \return Number of loaded rows, zero at the end of the data
+     */
+    size_t loadDataBlock() DAAL_C11_OVERRIDE { return loadDataBlock(static_cast<size_t>(0)); }
+
+    /**
+     *  Loads at most maxRows rows of the current record batch or of the next record batch.
+     *  The numeric table of the data source is replaced with the view of the loaded rows
+     *  \param[in] maxRows  Maximal number of rows to load, zero means the whole batch
+     *  \return Number of loaded rows, zero at the end of the data
+     */
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE
+    {
+        services::Status s = checkDictionary();
+        SOANumericTablePtr view;
+        size_t nrows = 0;
+        if (s) view = SOANumericTable::create(_dict->getNumberOfFeatures(), 0, DictionaryIface::notEqual, &s);
+        if (s) s |= loadView(maxRows, *view, nrows);
+        if (!s)
+        {
+            _status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        if (nrows > 0) _spnt = view;
+        return nrows;
+    }
+
+    /**
+     *  Loads the rest of the current record batch or the next record batch into the numeric table.
+     *  The columns of a SOANumericTable that does not own its memory are set to the buffers
+     *  of the batch, other numeric tables receive a copy of the rows
+     *  \param[in] nt  Numeric table to load the rows into
+     *  \return Number of loaded rows, zero at the end of the data
+     */
+    size_t loadDataBlock(NumericTable * nt) DAAL_C11_OVERRIDE { return loadDataBlock(static_cast<size_t>(0), nt); }
+
+    /**
+     *  Loads at most maxRows rows of the current record batch or of the next record batch into the numeric table.
+     *  The columns of a SOANumericTable that does not own its memory are set to the buffers
+     *  of the batch, other numeric tables receive a copy of the rows
+     *  \param[in] maxRows  Maximal number of rows to load, zero means the whole batch
+     *  \param[in] nt       Numeric table to load the rows into
+     *  \return Number of loaded rows, zero at the end of the data
+     */
+    size_t loadDataBlock(size_t maxRows, NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = checkDictionary();
+        if (s && !nt) s.add(services::ErrorNullNumericTable);
+        size_t nrows = 0;
+        if (s)
+        {
+            SOANumericTable * const soa = dynamic_cast<SOANumericTable *>(nt);
+            if (soa && soa->getDataMemoryStatus() != NumericTableIface::internallyAllocated)
+            {
+                s |= loadView(maxRows, *soa, nrows);
+            }
+            else
+            {
+                SOANumericTablePtr view = SOANumericTable::create(_dict->getNumberOfFeatures(), 0, DictionaryIface::notEqual, &s);
+                if (s) s |= loadView(maxRows, *view, nrows);
+                if (s && nrows > 0) s |= copyRows(*view, *nt);
+            }
+        }
+        if (!s)
+        {
+            _status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        return nrows;
+    }
+
+protected:
+    /* Keeps the record batch alive while its buffers are referenced by a numeric table */
+    class BatchDeleter : public services::DeleterIface
+    {
+    public:
+        BatchDeleter(const std::shared_ptr<arrow::RecordBatch> & batch) : _batch(batch) {}
+        void operator()(const void * /*ptr*/) DAAL_C11_OVERRIDE { _batch.reset(); }
+
+    private:
+        std::shared_ptr<arrow::RecordBatch> _batch;
+    };
+
+    std::shared_ptr<arrow::Schema> getSchema() const
+    {
+        if (_streamReader) return _streamReader->schema();
+        if (_fileReader) return _fileReader->schema();
+        return std::shared_ptr<arrow::Schema>();
+    }
+
+    services::Status readNextBatch()
+    {
+        _batch.reset();
+        _batchOffset = 0;
+        if (_streamReader)
+        {
+            DAAL_CHECK(_streamReader->ReadNext(&_batch).ok(), services::ErrorOnFileRead);
+        }
+        else if (_fileReader)
+        {
+            if (_nextBatchIndex < _fileReader->num_record_batches())
+            {
+#if ARROW_VERSION >= 17000
+                arrow::Result<std::shared_ptr<arrow::RecordBatch> > batchResult = _fileReader->ReadRecordBatch(_nextBatchIndex);
+                DAAL_CHECK(batchResult.ok(), services::ErrorOnFileRead);
+                _batch = batchResult.ValueOrDie();
+#else
+                DAAL_CHECK(_fileReader->ReadRecordBatch(_nextBatchIndex, &_batch).ok(), services::ErrorOnFileRead);
+#endif
+                ++_nextBatchIndex;
+            }
+        }
+        else
+        {
+            return services::Status(services::ErrorNullPtr);
+        }
+        if (_batch)
+        {
+            DAAL_CHECK(static_cast<size_t>(_batch->num_columns()) == _dict->getNumberOfFeatures(), services::ErrorInconsistentNumberOfColumns);
+        }
+        _isEndOfData = !_batch;
+        return services::Status();
+    }
+
+    /* Sets the columns of the table to at most maxRows rows of the current or the next non-empty record batch */
+    services::Status loadView(size_t maxRows, SOANumericTable & table, size_t & nrows)
+    {
+        services::Status s;
+        nrows = 0;
+        while (!_isEndOfData && (!_batch || _batchOffset >= static_cast<size_t>(_batch->num_rows())))
+        {
+            DAAL_CHECK_STATUS(s, readNextBatch());
+        }
+        if (_isEndOfData) return s;
+
+        const size_t nAvailable = static_cast<size_t>(_batch->num_rows()) - _batchOffset;
+        const size_t ncols      = _dict->getNumberOfFeatures();
+        nrows                   = (maxRows == 0 || maxRows > nAvailable) ? nAvailable : maxRows;
+
+        if (table.getNumberOfColumns() != ncols)
+        {
+            DAAL_CHECK_STATUS(s, table.getDictionarySharedPtr()->setNumberOfFeatures(ncols));
+        }
+        for (size_t j = 0; j < ncols; ++j)
+        {
+            DAAL_CHECK_STATUS(s, setColumn(table, j, nrows));
+        }
+        DAAL_CHECK_STATUS(s, setNumericTableDictionary(NumericTablePtr(&table, services::EmptyDeleter())));
+        DAAL_CHECK_STATUS(s, table.resize(nrows));
+
+        _batchOffset += nrows;
+        return s;
+    }
+
+    services::Status setColumn(SOANumericTable & table, size_t j, size_t nrows)
+    {
+        const NumericTableFeature & f = (*_dict)[j].ntFeature;
+        switch (f.indexType)
+        {
+        case features::DAAL_FLOAT32: return setTColumn<float>(table, j, nrows);
+        case features::DAAL_FLOAT64: return setTColumn<double>(table, j, nrows);
+        case features::DAAL_INT8_S: return setTColumn<char>(table, j, nrows);
+        case features::DAAL_INT8_U: return setTColumn<unsigned char>(table, j, nrows);
+        case features::DAAL_INT16_S: return setTColumn<short>(table, j, nrows);
+        case features::DAAL_INT16_U: return setTColumn<unsigned short>(table, j, nrows);
+        case features::DAAL_INT32_S: return setTColumn<int>(table, j, nrows);
+        case features::DAAL_INT32_U: return setTColumn<unsigned int>(table, j, nrows);
+        case features::DAAL_INT64_S: return setTColumn<DAAL_INT64>(table, j, nrows);
+        case features::DAAL_INT64_U: return setTColumn<DAAL_UINT64>(table, j, nrows);
+        default: return services::Status(services::ErrorDataTypeNotSupported);
+        }
+    }
+
+    template <typename T>
+    services::Status setTColumn(SOANumericTable & table, size_t j, size_t nrows)
+    {
+        const std::shared_ptr<arrow::Array> arrayPtr = _batch->column(static_cast<int>(j));
+        DAAL_ASSERT(arrayPtr);
+        const arrow::ArrayData & arrayData = *arrayPtr->data();
+        DAAL_CHECK(arrayData.buffers.size() > 1 && arrayData.buffers[1], services::ErrorNullPtr);
+        DAAL_CHECK(arrayData.buffers[1]->size() >= static_cast<int64_t>((arrayData.offset + arrayData.length) * sizeof(T)),
+                   services::ErrorDataTypeNotSupported);
+
+        const T * const values = arrayData.GetValues<T>(1) + _batchOffset;
+        if (arrayPtr->null_count() == 0)
+        {
+            return table.setArray(services::SharedPtr<T>(const_cast<T *>(values), BatchDeleter(_batch)), j);
+        }
+
+        /* Nulls can be represented only by the floating-point types */
+        DAAL_CHECK(!std::numeric_limits<T>::is_integer, services::ErrorDataTypeNotSupported);
+
+        services::SharedPtr<T> copy((T *)daal::services::daal_malloc(nrows * sizeof(T)), services::ServiceDeleter());
+        DAAL_CHECK_MALLOC(copy.get());
+        T * const dst = copy.get();
+        for (size_t i = 0; i < nrows; ++i)
+        {
+            dst[i] = arrayPtr->IsNull(static_cast<int64_t>(_batchOffset + i)) ? std::numeric_limits<T>::quiet_NaN() : values[i];
+        }
+        return table.setArray(copy, j);
+    }
+
+    services::Status copyRows(NumericTable & src, NumericTable & dst)
+    {
+        const size_t ncols = src.getNumberOfColumns();
+        const size_t nrows = src.getNumberOfRows();
+        DAAL_CHECK(dst.getNumberOfColumns() == ncols, services::ErrorIncorrectNumberOfColumns);
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, dst.resize(nrows));
+
+        BlockDescriptor<DAAL_DATA_TYPE> srcBlock;
+        BlockDescriptor<DAAL_DATA_TYPE> dstBlock;
+        DAAL_CHECK_STATUS(s, src.getBlockOfRows(0, nrows, readOnly, srcBlock));
+        s |= dst.getBlockOfRows(0, nrows, writeOnly, dstBlock);
+        if (s)
+        {
+            const size_t size = nrows * ncols * sizeof(DAAL_DATA_TYPE);
+            daal::services::internal::daal_memcpy_s(dstBlock.getBlockPtr(), size, srcBlock.getBlockPtr(), size);
+            s |= dst.releaseBlockOfRows(dstBlock);
+        }
+        s |= src.releaseBlockOfRows(srcBlock);
+        return s;
+    }
+
+    std::shared_ptr<arrow::RecordBatchReader> _streamReader;
+    std::shared_ptr<arrow::ipc::RecordBatchFileReader> _fileReader;
+    std::shared_ptr<arrow::RecordBatch> _batch;
+    size_t _batchOffset;
+    int _nextBatchIndex;
+    bool _isEndOfData;
+};
+/** @} */
+} // namespace interface1
+using interface1::ArrowIPCDataSource;
+
+} // namespace data_management
+} // namespace daal
+#endif
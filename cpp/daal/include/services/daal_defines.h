@@ -167,8 +167,11 @@ enum ComputeStep
  */
 enum MemType
 {
-    dram   = 0, /*!< DRAM */
-    mcdram = 1  /*!< Multi-Channel DRAM */
+    dram            = 0, /*!< DRAM */
+    mcdram          = 1, /*!< Multi-Channel DRAM */
+    numaPartitioned = 2, /*!< DRAM split into contiguous ranges, one per NUMA node, each range is placed on its node
+                              by the first touch of the threads constrained to this node */
+    hugePages       = 3  /*!< DRAM backed by 2MB pages */
 };
 
 typedef unsigned char byte;
@@ -311,8 +314,9 @@ const int SERIALIZATION_CHOLESKY_RESULT_ID = 101800;
 const int SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID = 101900;
 const int SERIALIZATION_COSINE_DISTANCE_RESULT_ID      = 101910;
 
-const int SERIALIZATION_EM_GMM_INIT_RESULT_ID = 102000;
-const int SERIALIZATION_EM_GMM_RESULT_ID      = 102010;
+const int SERIALIZATION_EM_GMM_INIT_RESULT_ID    = 102000;
+const int SERIALIZATION_EM_GMM_RESULT_ID         = 102010;
+const int SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID = 102020;
 
 const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID = 102100;
 
@@ -72,6 +72,42 @@ DAAL_DEPRECATED DAAL_EXPORT void daal_memcpy_s(void * dest, size_t numberOfEleme
 
 namespace internal
 {
+/**
+ * Allocates an aligned block of memory and initializes it with zero in parallel.
+ * The block is split into contiguous page-aligned ranges, one per NUMA node, and each range
+ * is zeroed by the threads of the task arena constrained to its node, so under the first-touch
+ * policy of the OS the range is placed on this node. The ranges are zeroed in the task arena
+ * of the calling thread if the information about the NUMA nodes is not available
+ * \param[in] size      Size of the block of memory in bytes
+ * \param[in] alignment Alignment constraint. Must be a power of two
+ * \return Pointer to the beginning of a newly allocated zero-filled block of memory
+ */
+DAAL_EXPORT void * daal_numa_partitioned_calloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+ * Allocates an aligned block of memory backed by 2MB pages.
+ * Explicit huge pages are used if the system has them reserved, otherwise the block is aligned
+ * to 2MB and the OS is advised to back it with transparent huge pages
+ * \param[in] size      Size of the block of memory in bytes
+ * \param[in] alignment Alignment constraint. Must be a power of two not greater than 4096
+ * \return Pointer to the beginning of a newly allocated zero-filled block of memory that must be deallocated by daal_huge_pages_free
+ */
+DAAL_EXPORT void * daal_huge_pages_calloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+ * Checks if the blocks of memory of the given size are backed by 2MB pages by default,
+ * that is, if the size is not less than the threshold set by Environment::setHugePagesThreshold
+ * \param[in] size      Size of the block of memory in bytes
+ * \return True if the block is backed by huge pages
+ */
+DAAL_EXPORT bool daal_huge_pages_enabled(size_t size);
+
+/**
+ * Deallocates the space previously allocated by daal_huge_pages_calloc
+ * \param[in] ptr   Pointer to the beginning of a block of memory to deallocate
+ */
+DAAL_EXPORT void daal_huge_pages_free(void * ptr);
+
 /**
 * Saved version of bytes copy between buffers
 * \param[out] dest               Pointer to new buffer
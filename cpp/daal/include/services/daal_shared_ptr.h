@@ -85,6 +85,16 @@ public:
     void operator()(const void * ptr) DAAL_C11_OVERRIDE { daal::services::daal_free((void *)ptr); }
 };
 
+/**
+ * <a name="DAAL-CLASS-SERVICES__HUGEPAGESDELETER"></a>
+ * \brief Implementation of DeleterIface to destroy a pointer by the daal_huge_pages_free function
+ */
+class HugePagesDeleter : public DeleterIface
+{
+public:
+    void operator()(const void * ptr) DAAL_C11_OVERRIDE { daal::services::internal::daal_huge_pages_free((void *)ptr); }
+};
+
 /**
  * <a name="DAAL-CLASS-SERVICES__EMPTYDELETER"></a>
  * \brief Implementation of DeleterIface without pointer destroying
@@ -447,6 +457,7 @@ using interface1::DeleterIface;
 using interface1::ObjectDeleter;
 using interface1::EmptyDeleter;
 using interface1::ServiceDeleter;
+using interface1::HugePagesDeleter;
 using interface1::RefCounter;
 using interface1::RefCounterImp;
 using interface1::SharedPtr;
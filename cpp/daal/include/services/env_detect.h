@@ -27,6 +27,7 @@
 #include "services/base.h"
 #include "services/daal_defines.h"
 #include "services/internal/execution_context.h"
+#include "services/scratch_allocator.h"
 
 namespace daal
 {
@@ -159,6 +160,44 @@ public:
      */
     size_t getNumberOfThreads() const;
 
+    /**
+     *  Runs the computations started by the calling thread in a dedicated task arena,
+     *  so that several threads can run the algorithms on separate sets of cores
+     *  \param[in] maxConcurrency  The maximal number of threads used by the computations, 0 removes the limit
+     *  \param[in] numaNode        The index of the NUMA node the threads are bound to, -1 disables the binding
+     *  \return Status of the call, the NUMA node cannot be used if the threading layer is not able to bind threads to it
+     */
+    services::Status setThreadTaskArena(size_t maxConcurrency, int numaNode = -1);
+
+    /**
+     *  Sets the minimal size of the numeric tables and the temporary buffers of the algorithms backed by 2MB pages
+     *  \param[in] threshold  The size in bytes, 0 disables huge pages unless they are requested for a numeric table explicitly
+     */
+    void setHugePagesThreshold(size_t threshold);
+
+    /**
+     *  Sets the allocator of the temporary buffers the algorithms create during the computations.
+     *  The allocator is reset each time the outermost computation is finished
+     *  \param[in] allocator  The allocator of the temporary buffers, empty pointer restores the default allocation
+     *  \return Status of the call, the allocator cannot be changed while the computations are running
+     */
+    services::Status setScratchAllocator(const ScratchAllocatorIfacePtr & allocator);
+
+    /**
+     *  Limits the total size of the temporary buffers the algorithms use at the same time.
+     *  The computation whose allocation does not fit into the budget fails with ErrorScratchMemoryBudgetExceeded status,
+     *  the computations run in parallel in other threads are not affected
+     *  \param[in] budget  The budget in bytes, 0 removes the limit
+     */
+    void setScratchMemoryBudget(size_t budget);
+
+    /**
+     *  Returns the statistics of the temporary buffers allocated by the algorithms since the library was loaded.
+     *  The buffers are accounted only while a scratch allocator or a memory budget is set
+     *  \return Statistics of the temporary buffers
+     */
+    ScratchMemoryStatistics getScratchMemoryStatistics() const;
+
     /**
      * Limits the amount of memory of the given type available to internal function calls
      * \param[in] type   Memory type
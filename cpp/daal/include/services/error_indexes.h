@@ -142,11 +142,12 @@ enum ErrorID
     ErrorBufferSizeIntegerOverflow                    = -80, /*!< Integer oveflow is occured during buffer size calculation */
 
     // Environment errors: -2000..-2999
-    ErrorCpuNotSupported          = -2000, /*!< CPU not supported */
-    ErrorMemoryAllocationFailed   = -2001, /*!< Memory allocation failed */
-    ErrorEmptyDataBlock           = -2004, /*!< Empty data block */
-    ErrorMemoryCopyFailedInternal = -2005, /*!< Memory copy internal error */
-    ErrorCpuIsInvalid             = -2006, /*!< Invalid CPU value used */
+    ErrorCpuNotSupported             = -2000, /*!< CPU not supported */
+    ErrorMemoryAllocationFailed      = -2001, /*!< Memory allocation failed */
+    ErrorEmptyDataBlock              = -2004, /*!< Empty data block */
+    ErrorMemoryCopyFailedInternal    = -2005, /*!< Memory copy internal error */
+    ErrorCpuIsInvalid                = -2006, /*!< Invalid CPU value used */
+    ErrorScratchMemoryBudgetExceeded = -2007, /*!< Temporary buffers of the computation exceed the memory budget set in the environment */
 
     // Workflow errors: -3000..-3999
     ErrorIncorrectCombinationOfComputationModeAndStep = -3002, /*!< Incorrect combination of computation mode and computation step */
@@ -327,6 +328,8 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock      = -9022, /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+    ErrorCompressionIncorrectBlockFrame = -9023, /*!< Input compressed stream is not a valid block-compressed frame
+                                                                         *   or its block index is corrupted */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400, /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -368,6 +371,8 @@ enum ErrorID
     // Decision forest error: -20000..-20099
     ErrorDFBootstrapVarImportanceIncompatible = -20000, /*!< Parameter 'bootstrap' is incompatible with requested variable importance type */
     ErrorDFBootstrapOOBIncompatible = -20001, /*!< Parameter 'bootstrap' is incompatible with requested OOB result (no out-of-bag observations) */
+    ErrorDFIncorrectModelFileFormat = -20002, /*!< File is not in the flat format of the decision forest model or is corrupted */
+    ErrorDFMappedModelIsReadOnly    = -20003, /*!< Decision forest model mapped from the file cannot be modified */
 
     // K-Nearest Neighbors errors: -21000..21999
     ErrorKNNInternal = -21000, /*!< K-Nearest Neighbors internal error */
@@ -377,7 +382,8 @@ enum ErrorID
     ErrorGbtPredictIncorrectNumberOfIterations = -30001, /*!< Number of iterations value in GBT parameter is not consistent with the model */
 
     // Data management errors:  -80001..
-    ErrorUserAllocatedMemory = -80001, /*!< Couldn't free memory allocated by user */
+    ErrorUserAllocatedMemory       = -80001, /*!< Couldn't free memory allocated by user */
+    ErrorIncorrectMappedFileFormat = -80002, /*!< File is not in the columnar format of the mapped numeric table or is corrupted */
 
     //Math errors: -90000..-100000
     ErrorDataSourseNotAvailable = -90041, /*!< ErrorDataSourseNotAvailable */
@@ -387,6 +393,7 @@ enum ErrorID
     ErrorOnFileOpen             = -90045, /*!< Error on file open */
     ErrorOnFileRead             = -90046, /*!< Error on file read */
     ErrorNullByteInjection      = -90047, /*!< Error null byte injection */
+    ErrorOnFileWrite            = -90048, /*!< Error on file write */
 
     ErrorKDBNoConnection      = -90051, /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials  = -90052, /*!< ErrorKDBWrongCredentials */
@@ -60,9 +60,31 @@ private:
 };
 typedef services::SharedPtr<HostAppIface> HostAppIfacePtr;
 
+/**
+ *  <a name="DAAL-CLASS-SERVICES__HOSTAPPIFACE2"></a>
+ *  \brief Abstract class which extends the callback interface for the host application of this library
+ *         with the progress of the iterative algorithms. The library detects this interface at run time,
+ *         so the host application passes it wherever HostAppIface is accepted
+ */
+class DAAL_EXPORT HostAppIface2 : public HostAppIface
+{
+public:
+    /**
+     * This callback is called by compute() methods of the iterative algorithms of the library
+     * after each iteration, right before isCancelled() is checked
+     * \param[in] nIterations             Number of iterations completed so far
+     * \param[in] objectiveFunctionValue  Value of the objective function after the last iteration,
+     *                                    or of the stopping criterion if the algorithm does not compute the objective function
+     */
+    virtual void onIteration(size_t nIterations, double objectiveFunctionValue) = 0;
+};
+typedef services::SharedPtr<HostAppIface2> HostAppIface2Ptr;
+
 } // namespace interface1
 using interface1::HostAppIface;
 using interface1::HostAppIfacePtr;
+using interface1::HostAppIface2;
+using interface1::HostAppIface2Ptr;
 
 } // namespace services
 } // namespace daal
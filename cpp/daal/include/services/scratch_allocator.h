@@ -0,0 +1,138 @@
+/* file: scratch_allocator.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Interface of the allocator of temporary buffers used by the algorithms of the library
+//--
+*/
+
+#ifndef __DAAL_SCRATCH_ALLOCATOR_H__
+#define __DAAL_SCRATCH_ALLOCATOR_H__
+
+#include "services/daal_defines.h"
+#include "services/base.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup memory
+ * @{
+ */
+/**
+ *  <a name="DAAL-STRUCT-SERVICES__SCRATCHMEMORYSTATISTICS"></a>
+ *  \brief Statistics of the temporary buffers the algorithms allocate during the computations
+ */
+struct ScratchMemoryStatistics
+{
+    ScratchMemoryStatistics() : currentBytes(0), peakBytes(0), nAllocations(0) {}
+
+    size_t currentBytes; /*!< Size of the temporary buffers in use */
+    size_t peakBytes;    /*!< Maximal size of the temporary buffers in use at the same time */
+    size_t nAllocations; /*!< Number of the allocated temporary buffers */
+};
+
+/**
+ *  <a name="DAAL-CLASS-SERVICES__SCRATCHALLOCATORIFACE"></a>
+ *  \brief Abstract class which defines the interface of the allocator of temporary buffers
+ *         the algorithms of the library create and release during the computations.
+ *         The methods can be called from several threads at once
+ */
+class DAAL_EXPORT ScratchAllocatorIface : public Base
+{
+public:
+    DAAL_NEW_DELETE();
+    virtual ~ScratchAllocatorIface() {}
+
+    /**
+     * Allocates an aligned block of memory
+     * \param[in] size      Size of the block of memory in bytes
+     * \param[in] alignment Alignment constraint. Must be a power of two
+     * \return Pointer to the beginning of the block of memory, NULL if the memory cannot be allocated
+     */
+    virtual void * allocate(size_t size, size_t alignment) = 0;
+
+    /**
+     * Deallocates the block of memory previously allocated by this allocator
+     * \param[in] ptr   Pointer to the beginning of the block of memory
+     */
+    virtual void deallocate(void * ptr) = 0;
+
+    /**
+     * This callback is called when the outermost compute() method of the library algorithms is finished
+     */
+    virtual void reset() = 0;
+};
+typedef services::SharedPtr<ScratchAllocatorIface> ScratchAllocatorIfacePtr;
+
+/**
+ *  <a name="DAAL-CLASS-SERVICES__SCRATCHARENAALLOCATOR"></a>
+ *  \brief Allocator that caches the deallocated temporary buffers and reuses them for the following allocations
+ *         of the same size class, so iterative algorithms and repeated computations do not allocate memory again.
+ *         The total size of the cached blocks is bounded, the buffers over the limit are allocated and released
+ *         directly. The cached blocks are released on destruction of the allocator
+ */
+class DAAL_EXPORT ScratchArenaAllocator : public ScratchAllocatorIface
+{
+public:
+    /**
+     * Constructs the arena allocator
+     * \param[in]  maxReservedSize  Maximal total size of the blocks of memory held by the allocator in bytes
+     * \param[out] stat             Status of the allocator construction
+     * \return Arena allocator
+     */
+    static services::SharedPtr<ScratchArenaAllocator> create(size_t maxReservedSize = 1024 * 1024 * 1024, services::Status * stat = NULL);
+
+    virtual ~ScratchArenaAllocator();
+
+    void * allocate(size_t size, size_t alignment) DAAL_C11_OVERRIDE;
+
+    void deallocate(void * ptr) DAAL_C11_OVERRIDE;
+
+    void reset() DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the total size of the blocks of memory held by the allocator, both in use and cached
+     * \return Size of the blocks in bytes
+     */
+    size_t getReservedSize() const;
+
+private:
+    ScratchArenaAllocator(size_t maxReservedSize, services::Status & st);
+    ScratchArenaAllocator(const ScratchArenaAllocator &);
+    ScratchArenaAllocator & operator=(const ScratchArenaAllocator &);
+
+    void * _impl;
+};
+typedef services::SharedPtr<ScratchArenaAllocator> ScratchArenaAllocatorPtr;
+/** @} */
+} // namespace interface1
+using interface1::ScratchMemoryStatistics;
+using interface1::ScratchAllocatorIface;
+using interface1::ScratchAllocatorIfacePtr;
+using interface1::ScratchArenaAllocator;
+using interface1::ScratchArenaAllocatorPtr;
+
+} // namespace services
+} // namespace daal
+#endif //__DAAL_SCRATCH_ALLOCATOR_H__
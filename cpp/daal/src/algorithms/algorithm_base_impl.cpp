@@ -28,6 +28,7 @@
 
 #include "src/threading/service_thread_pinner.h"
 #include "src/services/service_topo.h"
+#include "src/externals/service_memory.h"
 
 namespace daal
 {
@@ -175,6 +176,7 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
         this->setInitFlag(true);
     }
 
+    services::internal::ScratchComputeScope scratchScope;
     s = setupCompute();
     if (s)
     {
@@ -195,6 +197,8 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
     }
 
     s |= resetCompute();
+    this->_scratchStatistics = scratchScope.getStatistics();
+    if (!s && scratchScope.isBudgetExceeded()) s.add(services::ErrorScratchMemoryBudgetExceeded);
     return s;
 }
 
@@ -233,6 +237,7 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
         s = this->checkResult();
         if (!s) return s;
     }
+    services::internal::ScratchComputeScope scratchScope;
     s = setupCompute();
 
     if (s)
@@ -254,7 +259,9 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
     }
 
     if (resetFlag) s |= resetCompute();
-    _res = this->_ac->getResult();
+    _res                     = this->_ac->getResult();
+    this->_scratchStatistics = scratchScope.getStatistics();
+    if (!s && scratchScope.isBudgetExceeded()) s.add(services::ErrorScratchMemoryBudgetExceeded);
     return s;
 }
 
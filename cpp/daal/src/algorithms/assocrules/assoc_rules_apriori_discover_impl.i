@@ -27,6 +27,9 @@
 
 #include "src/externals/service_memory.h"
 #include "src/algorithms/assocrules/assoc_rules_apriori_types.i"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/services/service_arrays.h"
 
 namespace daal
 {
@@ -239,7 +242,52 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
 }
 
 /**
- *  Generate association rules from "large" item sets
+ *  Generate association rules from one "large" item set
+ *
+ *  \param minConfidence[in]    minimum confidence
+ *  \param L[in]                structure that contains "large" itemsets
+ *  \param iset_size[in]        index of the list of "large" itemsets the item set belongs to
+ *  \param itemSet[in]          "large" item set
+ *  \param leftItems[in]        buffer to store left part of the rule
+ *  \param R[out]               structure that contains association rules
+ *  \param numRules[in,out]     number of association rules
+ *  \param numLeft[in,out]      total number of items in the left parts of association rules
+ *  \param numRight[in,out]     total number of items in the right parts of association rules
+ *
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::generateItemsetRules(double minConfidence, ItemSetList<cpu> * L,
+                                                                                             size_t iset_size,
+                                                                                             const assocrules_itemset<cpu> * itemSet,
+                                                                                             size_t * leftItems, AssocRule<cpu> * R,
+                                                                                             size_t & numRules, size_t & numLeft, size_t & numRight)
+{
+    const size_t * items = itemSet->items;
+    size_t itemsSupport  = itemSet->support.get();
+    size_t n_rules_prev  = 0;
+
+    /* Find rules that have 1 item in the right part */
+    services::Status statFirstPass =
+        firstPass(minConfidence, L, iset_size, items, itemsSupport, leftItems, R, numRules, numLeft, numRight, n_rules_prev);
+    DAAL_CHECK_STATUS_OK(statFirstPass.ok(), statFirstPass);
+
+    bool found = (n_rules_prev > 0);
+    for (size_t right_size = 2; right_size <= iset_size && found; ++right_size)
+    {
+        /* Find rules that have right_size items in the right part */
+        services::Status statNextPass =
+            nextPass(minConfidence, L, right_size, itemsSupport, leftItems, R, numRules, numLeft, numRight, n_rules_prev, found);
+
+        DAAL_CHECK_STATUS_OK(statNextPass.ok(), statNextPass);
+    }
+    return services::Status();
+}
+
+/**
+ *  Generate association rules from "large" item sets.
+ *  Item sets are processed in parallel: the rules of every item set are written into its own range of R
+ *  which size is the upper bound of the number of rules of the item set, then the ranges are packed
+ *  in the order of the item sets, hence the result does not depend on the number of threads
  *
  *  \param minConfidence[in]    minimum confidence
  *  \param L_size[in]           length of the array L
@@ -260,41 +308,80 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::generate
     numLeft  = 0;
     numRight = 0;
 
-    TArray<size_t, cpu> leftItemsAr(L_size);
-    size_t * leftItems = leftItemsAr.get();
-    if (!leftItems) return services::ErrorMemoryAllocationFailed;
-
     /* Generate all association rules */
     size_t startItemsetSize = 1;
     if (minItemsetSize > startItemsetSize)
     {
         startItemsetSize = minItemsetSize - 1;
     }
+
+    size_t nItemsets = 0;
     for (size_t iset_size = startItemsetSize; iset_size < L_size; ++iset_size)
     {
-        ItemSetList<cpu> & L_cur = L[iset_size];
+        nItemsets += L[iset_size].size;
+    }
+    if (!nItemsets) return services::Status();
 
-        for (const auto * current = L_cur.start; current != nullptr; current = current->next())
+    typedef const assocrules_itemset<cpu> * ItemsetConstPtr;
+    TArray<ItemsetConstPtr, cpu> itemsetsAr(nItemsets);
+    TArray<size_t, cpu> itemsetSizesAr(nItemsets);
+    TArray<size_t, cpu> rulesOffsetsAr(nItemsets);
+    TArray<size_t, cpu> countsAr(3 * nItemsets);
+    ItemsetConstPtr * itemsets = itemsetsAr.get();
+    size_t * itemsetSizes      = itemsetSizesAr.get();
+    size_t * rulesOffsets      = rulesOffsetsAr.get();
+    size_t * counts            = countsAr.get();
+    DAAL_CHECK_MALLOC(itemsets && itemsetSizes && rulesOffsets && counts);
+
+    size_t iItemset    = 0;
+    size_t rulesOffset = 0;
+    for (size_t iset_size = startItemsetSize; iset_size < L_size; ++iset_size)
+    {
+        /* Upper bound of the number of rules generated from one item set, the same as in the allocation of R */
+        size_t exp2LSize = ((size_t)1 << (iset_size + 1)) - (size_t)2;
+        if (exp2LSize < 2)
         {
-            const size_t * items = current->itemSet()->items;
-            size_t itemsSupport  = current->itemSet()->support.get();
-            size_t n_rules_prev  = 0;
+            exp2LSize = 2;
+        }
+        const size_t maxItemsetRules = (exp2LSize - 1) * exp2LSize;
 
-            /* Find rules that have 1 item in the right part */
-            services::Status statFirstPass =
-                firstPass(minConfidence, L, iset_size, items, itemsSupport, leftItems, R, numRules, numLeft, numRight, n_rules_prev);
-            DAAL_CHECK_STATUS_OK(statFirstPass.ok(), statFirstPass);
+        for (const auto * current = L[iset_size].start; current != nullptr; current = current->next(), ++iItemset)
+        {
+            itemsets[iItemset]     = current->itemSet();
+            itemsetSizes[iItemset] = iset_size;
+            rulesOffsets[iItemset] = rulesOffset;
+            rulesOffset += maxItemsetRules;
+        }
+    }
 
-            bool found = (n_rules_prev > 0);
-            for (size_t right_size = 2; right_size <= iset_size && found; ++right_size)
-            {
-                /* Find rules that have right_size items in the right part */
-                services::Status statNextPass =
-                    nextPass(minConfidence, L, right_size, itemsSupport, leftItems, R, numRules, numLeft, numRight, n_rules_prev, found);
+    daal::tls<size_t *> leftItemsTls([=]() -> size_t * { return daal::services::internal::service_calloc<size_t, cpu>(L_size); });
 
-                DAAL_CHECK_STATUS_OK(statNextPass.ok(), statNextPass);
-            }
+    SafeStatus safeStat;
+    daal::threader_for(nItemsets, nItemsets, [=, &leftItemsTls, &safeStat](size_t i) {
+        size_t * leftItems = leftItemsTls.local();
+        DAAL_CHECK_MALLOC_THR(leftItems);
+
+        size_t itemsetRules = rulesOffsets[i];
+        size_t itemsetLeft  = 0;
+        size_t itemsetRight = 0;
+        safeStat |= generateItemsetRules(minConfidence, L, itemsetSizes[i], itemsets[i], leftItems, R, itemsetRules, itemsetLeft, itemsetRight);
+
+        counts[3 * i]     = itemsetRules - rulesOffsets[i];
+        counts[3 * i + 1] = itemsetLeft;
+        counts[3 * i + 2] = itemsetRight;
+    });
+    leftItemsTls.reduce([](size_t * leftItems) { daal::services::daal_free(leftItems); });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Pack the rules of the item sets, numRules never exceeds the offset of the current item set */
+    for (size_t i = 0; i < nItemsets; ++i)
+    {
+        for (size_t j = 0; j < counts[3 * i]; ++j)
+        {
+            R[numRules++] = R[rulesOffsets[i] + j];
         }
+        numLeft += counts[3 * i + 1];
+        numRight += counts[3 * i + 2];
     }
     return services::Status();
 }
@@ -46,7 +46,7 @@ struct assocrules_itemset
 {
     DAAL_NEW_DELETE();
     /** \brief Construct itemset of size 1 from item value */
-    assocrules_itemset(size_t item0, size_t _support = 0) : items(nullptr), size(0), support(_support)
+    assocrules_itemset(size_t item0, size_t _support = 0) : items(nullptr), size(0), support(_support), index(0)
     {
         allocItems(1);
         items[0] = item0;
@@ -56,7 +56,7 @@ struct assocrules_itemset
      *  \brief Construct itemset of size (iset_size) from itemset of size (iset_size - 1) and item
      */
     assocrules_itemset(const size_t iset_size, const size_t * first_items, const size_t second_item, const size_t _support = 0)
-        : support(_support), items(nullptr), size(0)
+        : support(_support), items(nullptr), size(0), index(0)
     {
         allocItems(iset_size);
         int result = daal::services::internal::daal_memcpy_s(items, iset_size * sizeof(size_t), first_items, (iset_size - 1) * sizeof(size_t));
@@ -73,7 +73,7 @@ struct assocrules_itemset
     ~assocrules_itemset() { daal::services::daal_free(items); }
 
     /** \brief Copy constructor */
-    assocrules_itemset(const assocrules_itemset & iset) : items(nullptr), size(0)
+    assocrules_itemset(const assocrules_itemset & iset) : items(nullptr), size(0), index(iset.index)
     {
         allocItems(iset.size);
         support.set(iset.support.get());
@@ -92,6 +92,7 @@ struct assocrules_itemset
             items = nullptr;
             allocItems(iset.size);
             support.set(iset.support.get());
+            index      = iset.index;
             int result = daal::services::internal::daal_memcpy_s(items, size * sizeof(size_t), iset.items, size * sizeof(size_t));
             if (result)
             {
@@ -104,6 +105,7 @@ struct assocrules_itemset
     Atomic<size_t> support;
     size_t * items; /*<! Array of items */
     size_t size;    /*<! Itemset size */
+    size_t index;   /*<! Position of the candidate itemset in the list of candidates, addresses its thread-local support counter */
 
     bool ok() const { return _status.ok(); }
     services::Status getLastStatus() const { return _status; }
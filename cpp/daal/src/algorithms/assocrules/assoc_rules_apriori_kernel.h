@@ -88,13 +88,13 @@ protected:
                        services::Status & s);
 
     /** Generate all subsets of size iset_size from a transaction and hash those subsets
-        using hash tree of candidate itemsets C_tree to increment support values of candidates */
+        using hash tree of candidate itemsets C_tree to increment support counters of candidates */
     void genSubset(size_t transactionSize, const size_t * items, size_t iset_size, size_t * subset, size_t * idx, hash_tree<cpu> & C_tree,
-                   size_t & large_count);
+                   size_t * supportCounters, size_t & large_count);
 
-    /** Remove candidate itemsets which support is less then minimum support
+    /** Count support of candidate itemsets and remove ones which support is less then minimum support
         from array of "large" item sets */
-    void prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L, hash_tree<cpu> * C_tree);
+    services::Status prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L, hash_tree<cpu> * C_tree);
 
     /*
      *  Auxiliary methods for association rules discovery
@@ -115,6 +115,10 @@ protected:
     services::Status nextPass(double minConfidence, ItemSetList<cpu> * L, size_t right_size, size_t itemsSupport, size_t * leftItems,
                               AssocRule<cpu> * R, size_t & numRules, size_t & numLeft, size_t & numRight, size_t & numRulesFound, bool & found);
 
+    /** Generate association rules from one "large" item set */
+    services::Status generateItemsetRules(double minConfidence, ItemSetList<cpu> * L, size_t iset_size, const assocrules_itemset<cpu> * itemSet,
+                                          size_t * leftItems, AssocRule<cpu> * R, size_t & numRules, size_t & numLeft, size_t & numRight);
+
     /** Generate association rules from "large" item sets */
     services::Status generateRules(double minConfidence, size_t minItemsetSize, size_t L_size, ItemSetList<cpu> * L, AssocRule<cpu> * R,
                                    size_t & numRules, size_t & numLeft, size_t & numRight);
@@ -30,6 +30,8 @@
 #include "src/algorithms/service_sort.h"
 
 #include "src/threading/threading.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/services/service_arrays.h"
 #include "src/algorithms/assocrules/assoc_rules_apriori_types.i"
 #include "src/algorithms/assocrules/assoc_rules_apriori_tree.i"
 
@@ -260,11 +262,13 @@ bool AssociationRulesKernel<apriori, algorithmFPType, cpu>::genCandidates(size_t
  *  \param subset[in]       buffer for storing transaction items subsets
  *  \param idx[in]          buffer for storing transaction items indices
  *  \param C_tree[in]       hash tree formed from candidates
+ *  \param supportCounters[in,out] support counters of candidates addressed by candidate index
  *  \param large_count[out] number of candidates found in transaction
  */
 template <typename algorithmFPType, CpuType cpu>
 void AssociationRulesKernel<apriori, algorithmFPType, cpu>::genSubset(size_t transactionSize, const size_t * items, size_t iset_size, size_t * subset,
-                                                                      size_t * idx, hash_tree<cpu> & C_tree, size_t & large_count)
+                                                                      size_t * idx, hash_tree<cpu> & C_tree, size_t * supportCounters,
+                                                                      size_t & large_count)
 {
     int levelMiss;
     assocrules_itemset<cpu> * iset = nullptr;
@@ -290,7 +294,7 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::genSubset(size_t tra
         iset = C_tree.hash_subset(iset_size, subset, &levelMiss);
         if (iset)
         {
-            iset->support.inc();
+            supportCounters[iset->index]++;
             large_count++;
         }
 
@@ -334,8 +338,10 @@ void removeNodesWithSmallSupport(ItemSetList<cpu> & l, size_t support)
 }
 
 /**
- *  \brief Remove candidate itemsets which support is less then minimum support
- *         from array of "large" item sets
+ *  \brief Count support of candidate itemsets and remove ones which support is less then minimum support
+ *         from array of "large" item sets.
+ *         Transactions are processed in parallel, every thread counts support of the candidates
+ *         in its own array of counters, the counters are summed up after all transactions are processed
  *
  *  \param imin_s[in]    minimum support
  *  \param iset_size[in] size (number of items) of the candidate itemsets
@@ -344,24 +350,41 @@ void removeNodesWithSmallSupport(ItemSetList<cpu> & l, size_t support)
  *
  */
 template <typename algorithmFPType, CpuType cpu>
-void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data,
-                                                                  ItemSetList<cpu> * L, hash_tree<cpu> * C_tree)
+services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data,
+                                                                              ItemSetList<cpu> * L, hash_tree<cpu> * C_tree)
 {
-    size_t new_iset_size = iset_size + 1;
+    const size_t new_iset_size = iset_size + 1;
+    const size_t nCandidates   = L[iset_size].size;
+
+    TArray<assocrules_itemset<cpu> *, cpu> candidatesAr(nCandidates);
+    assocrules_itemset<cpu> ** candidates = candidatesAr.get();
+    DAAL_CHECK_MALLOC(candidates);
+    size_t iCandidate = 0;
+    for (auto * current = L[iset_size].start; current != nullptr; current = current->next(), iCandidate++)
+    {
+        candidates[iCandidate]        = current->itemSet();
+        candidates[iCandidate]->index = iCandidate;
+    }
+
+    /* Thread-local buffer: subset indices, subset items and support counters of all candidates */
+    const size_t bufferSize = 2 * new_iset_size + nCandidates;
     daal::tls<size_t *> tls([&]() -> size_t * // The functor to initialize a memory buffer
-                            { return daal::services::internal::service_calloc<size_t, cpu>(2 * new_iset_size); });
+                            { return daal::services::internal::service_calloc<size_t, cpu>(bufferSize); });
 
     assocrules_transaction<cpu> ** large_tran = data.large_tran;
     size_t numOfLargeTransactions             = data.numOfLargeTransactions;
 
-    daal::threader_for(numOfLargeTransactions, numOfLargeTransactions, [=, &tls](size_t i_tran) {
+    SafeStatus safeStat;
+    daal::threader_for(numOfLargeTransactions, numOfLargeTransactions, [=, &tls, &safeStat](size_t i_tran) {
         assocrules_transaction<cpu> * tran = large_tran[i_tran];
 
         size_t large_count = 0;
         size_t * idx       = tls.local();
-        size_t * subset    = idx + new_iset_size;
+        DAAL_CHECK_MALLOC_THR(idx);
+        size_t * subset          = idx + new_iset_size;
+        size_t * supportCounters = subset + new_iset_size;
 
-        genSubset(tran->size, tran->items, new_iset_size, subset, idx, *C_tree, large_count);
+        genSubset(tran->size, tran->items, new_iset_size, subset, idx, *C_tree, supportCounters, large_count);
 
         if (large_count < 2)
         {
@@ -370,9 +393,18 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s,
     });
 
     tls.reduce([&](size_t * idx) {
+        if (idx)
+        {
+            const size_t * supportCounters = idx + 2 * new_iset_size;
+            for (size_t i = 0; i < nCandidates; i++)
+            {
+                candidates[i]->support.set(candidates[i]->support.get() + supportCounters[i]);
+            }
+        }
         daal::services::daal_free(idx);
         idx = nullptr;
     });
+    DAAL_CHECK_SAFE_STATUS();
 
     /* Remove candidates that has support less than mininmum support from hash tree */
     for (size_t i = 0; i < C_tree->n_leaves; i++)
@@ -410,6 +442,7 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s,
         iNotLarge--;
     }
     data.numOfLargeTransactions = iLarge;
+    return services::Status();
 }
 
 /**
@@ -453,7 +486,13 @@ hash_tree<cpu> * AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
         return nullptr;
     }
 
-    prune(imin_s, iset_size, data, L, C_tree_new);
+    s = prune(imin_s, iset_size, data, L, C_tree_new);
+    if (!s.ok())
+    {
+        bFound = false;
+        delete C_tree_new;
+        return nullptr;
+    }
     if (L[iset_size].size > 0)
     {
         ++L_size;
@@ -97,12 +97,23 @@ bool FeatureTypes::findInBuf(size_t iFeature) const
 
 IndexedFeatures::~IndexedFeatures()
 {
-    if (_data) daal::services::daal_free(_data);
+    releaseData();
     delete[] _entries;
-    _data    = nullptr;
     _entries = nullptr;
 }
 
+void IndexedFeatures::releaseData()
+{
+    if (_mappedData.get())
+        _mappedData.release();
+    else if (_data && _isHugePages)
+        daal::services::internal::daal_huge_pages_free(_data);
+    else if (_data)
+        daal::services::daal_free(_data);
+    _data     = nullptr;
+    _capacity = 0;
+}
+
 IndexedFeatures::FeatureEntry::~FeatureEntry()
 {
     if (binBorders) daal::services::daal_free(binBorders);
@@ -123,22 +134,23 @@ services::Status IndexedFeatures::FeatureEntry::allocBorders()
 services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
 {
     const size_t newCapacity = nC * nR;
-    if (_data)
+    if (_data && (newCapacity > _capacity)) releaseData();
+    if (!_data)
     {
-        if (newCapacity > _capacity)
+        if (_outOfCore)
         {
-            services::daal_free(_data);
-            _data     = nullptr;
-            _capacity = 0;
-            _data     = (IndexType *)services::daal_calloc(sizeof(IndexType) * newCapacity);
+            //pages of a new file are zero-filled
+            services::Status s = _mappedData.create(_outOfCoreDirectory, sizeof(IndexType) * newCapacity);
+            DAAL_CHECK_STATUS_VAR(s);
+            _data = (IndexType *)_mappedData.get();
+        }
+        else
+        {
+            _isHugePages = services::internal::daal_huge_pages_enabled(sizeof(IndexType) * newCapacity);
+            _data        = (IndexType *)(_isHugePages ? services::internal::daal_huge_pages_calloc(sizeof(IndexType) * newCapacity) :
+                                                 services::daal_calloc(sizeof(IndexType) * newCapacity));
             DAAL_CHECK_MALLOC(_data);
-            _capacity = newCapacity;
         }
-    }
-    else
-    {
-        _data = (IndexType *)services::daal_calloc(sizeof(IndexType) * newCapacity);
-        DAAL_CHECK_MALLOC(_data);
         _capacity = newCapacity;
     }
     if (_entries)
@@ -26,6 +26,7 @@
 
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/services/service_mapped_file.h"
 
 typedef double ModelFPType;
 
@@ -99,12 +100,34 @@ public:
     };
 
 public:
-    IndexedFeatures() : _data(nullptr), _entries(nullptr), _sizeOfIndex(sizeof(IndexType)), _nCols(0), _nRows(0), _capacity(0), _maxNumIndices(0) {}
+    IndexedFeatures()
+        : _data(nullptr),
+          _entries(nullptr),
+          _sizeOfIndex(sizeof(IndexType)),
+          _nCols(0),
+          _nRows(0),
+          _capacity(0),
+          _maxNumIndices(0),
+          _outOfCore(false),
+          _isHugePages(false),
+          _outOfCoreDirectory(nullptr)
+    {}
     ~IndexedFeatures();
 
     template <typename algorithmFPType, CpuType cpu>
     services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr);
 
+    //keep the indices in a temporary memory-mapped file in the given directory instead of the main memory,
+    //should be called before init()
+    void setOutOfCore(const char * directory)
+    {
+        _outOfCore          = true;
+        _outOfCoreDirectory = directory;
+    }
+
+    //free the indices but keep the bins, used after the indices are copied to a more compact storage
+    void releaseData();
+
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const { return _entries[iCol].numIndices; }
 
@@ -143,6 +166,10 @@ protected:
     size_t _nCols;
     size_t _capacity;
     size_t _maxNumIndices;
+    bool _outOfCore;
+    bool _isHugePages;
+    const char * _outOfCoreDirectory;
+    services::internal::MappedTempFile _mappedData;
 };
 
 } /* namespace internal */
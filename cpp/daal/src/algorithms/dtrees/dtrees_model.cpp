@@ -21,7 +21,10 @@
 //--
 */
 
+#include <stdio.h>
+
 #include "src/algorithms/dtrees/dtrees_model_impl.h"
+#include "src/services/service_mapped_file.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -36,7 +39,83 @@ namespace internal
 {
 Tree::~Tree() {}
 
-ModelImpl::ModelImpl() : _nTree(0) {}
+namespace
+{
+const char mappedModelSignature[8]     = { 'D', 'A', 'A', 'L', 'T', 'R', 'E', 'E' };
+const unsigned int mappedModelVersion  = 1;
+const DAAL_UINT64 mappedArrayAlignment = 64;
+
+struct MappedModelHeader
+{
+    char signature[8];
+    unsigned int version;
+    unsigned int kind;
+    DAAL_UINT64 nodeSize;
+    DAAL_UINT64 nTrees;
+    DAAL_UINT64 nClasses;
+    DAAL_UINT64 nFeatures;
+    DAAL_UINT64 treesOffset;
+    DAAL_UINT64 reserved;
+};
+
+DAAL_UINT64 alignOffset(DAAL_UINT64 offset)
+{
+    return (offset + mappedArrayAlignment - 1) / mappedArrayAlignment * mappedArrayAlignment;
+}
+
+/* Reserves the place for the array in the file and returns its offset */
+DAAL_UINT64 placeArray(DAAL_UINT64 & offset, size_t size)
+{
+    if (!size) return 0;
+    const DAAL_UINT64 arrayOffset = alignOffset(offset);
+    offset                        = arrayOffset + size;
+    return arrayOffset;
+}
+
+/* Checks that the array of n elements of the given size lies within the file */
+bool isValidArray(DAAL_UINT64 offset, DAAL_UINT64 n, size_t elementSize, size_t fileSize)
+{
+    return offset % mappedArrayAlignment == 0 && offset <= fileSize && n <= (fileSize - offset) / elementSize;
+}
+
+class ModelFileWriter
+{
+public:
+    ModelFileWriter(const char * path) : _file(path ? fopen(path, "wb") : NULL), _position(0) {}
+    ~ModelFileWriter()
+    {
+        if (_file) fclose(_file);
+    }
+
+    bool isOpen() const { return _file != NULL; }
+
+    /* Writes the block at the given offset, the gap after the previous block is filled with zeros */
+    services::Status write(DAAL_UINT64 offset, const void * ptr, size_t size)
+    {
+        const char zeros[mappedArrayAlignment] = { 0 };
+        DAAL_ASSERT(offset >= _position && offset - _position < mappedArrayAlignment);
+        const size_t padding = static_cast<size_t>(offset - _position);
+        if (fwrite(zeros, 1, padding, _file) != padding || fwrite(ptr, 1, size, _file) != size) return services::Status(services::ErrorOnFileWrite);
+        _position = offset + size;
+        return services::Status();
+    }
+
+    /* Closes the file and returns false if the buffered data was not written */
+    bool close()
+    {
+        const bool isClosed = (fclose(_file) == 0);
+        _file               = NULL;
+        return isClosed;
+    }
+
+private:
+    FILE * _file;
+    DAAL_UINT64 _position;
+};
+
+} // namespace
+
+ModelImpl::ModelImpl() : _nTree(0), _mappedTrees(nullptr), _nMappedClasses(0) {}
 
 ModelImpl::~ModelImpl()
 {
@@ -49,11 +128,12 @@ void ModelImpl::destroy()
     _impurityTables.reset();
     _nNodeSampleTables.reset();
     _probTbl.reset();
+    releaseMappedModel();
 }
 
 bool ModelImpl::reserve(const size_t nTrees)
 {
-    if (_serializationData.get()) return false;
+    if (_serializationData.get() || isMapped()) return false;
     _nTree.set(0);
     _serializationData.reset(new DataCollection());
     _serializationData->resize(nTrees);
@@ -72,7 +152,7 @@ bool ModelImpl::reserve(const size_t nTrees)
 
 bool ModelImpl::resize(const size_t nTrees)
 {
-    if (_serializationData.get()) return false;
+    if (_serializationData.get() || isMapped()) return false;
     _nTree.set(0);
     _serializationData.reset(new DataCollection(nTrees));
     _impurityTables.reset(new DataCollection(nTrees));
@@ -91,9 +171,161 @@ void ModelImpl::clear()
 
     if (_probTbl.get()) _probTbl.reset();
 
+    releaseMappedModel();
     _nTree.set(0);
 }
 
+services::Status ModelImpl::writeMappedModel(const char * path, MappedModelKind kind, size_t nFeatures) const
+{
+    const size_t nTrees   = size();
+    const size_t nClasses = getNumClasses();
+    DAAL_CHECK(nTrees > 0, services::ErrorIncorrectParameter);
+
+    services::Collection<MappedTreeEntry> entries(nTrees);
+    DAAL_CHECK_MALLOC(entries.data());
+
+    MappedModelHeader header;
+    daal::services::internal::daal_memcpy_s(header.signature, sizeof(header.signature), mappedModelSignature, sizeof(mappedModelSignature));
+    header.version     = mappedModelVersion;
+    header.kind        = kind;
+    header.nodeSize    = sizeof(DecisionTreeNode);
+    header.nTrees      = nTrees;
+    header.nClasses    = nClasses;
+    header.nFeatures   = nFeatures;
+    header.treesOffset = sizeof(MappedModelHeader);
+    header.reserved    = 0;
+
+    DAAL_UINT64 offset = header.treesOffset + nTrees * sizeof(MappedTreeEntry);
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        const DecisionTreeView tree = getTreeView(i);
+        DAAL_CHECK(tree.getArray() && tree.getNumberOfRows() > 0, services::ErrorModelNotFullInitialized);
+
+        const size_t nNodes         = tree.getNumberOfRows();
+        MappedTreeEntry & entry     = entries[i];
+        entry.nNodes                = nNodes;
+        entry.nodesOffset           = placeArray(offset, nNodes * sizeof(DecisionTreeNode));
+        entry.impurityOffset        = placeArray(offset, getImpVals(i) ? nNodes * sizeof(double) : 0);
+        entry.nodeSampleCountOffset = placeArray(offset, getNodeSampleCount(i) ? nNodes * sizeof(int) : 0);
+        entry.probOffset            = placeArray(offset, getProbas(i) ? nNodes * nClasses * sizeof(double) : 0);
+        entry.reserved              = 0;
+    }
+
+    ModelFileWriter file(path);
+    DAAL_CHECK(file.isOpen(), services::ErrorOnFileOpen);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, file.write(0, &header, sizeof(header)));
+    DAAL_CHECK_STATUS(s, file.write(header.treesOffset, entries.data(), nTrees * sizeof(MappedTreeEntry)));
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        const MappedTreeEntry & entry = entries[i];
+        const size_t nNodes           = static_cast<size_t>(entry.nNodes);
+        DAAL_CHECK_STATUS(s, file.write(entry.nodesOffset, getTreeView(i).getArray(), nNodes * sizeof(DecisionTreeNode)));
+        if (entry.impurityOffset) DAAL_CHECK_STATUS(s, file.write(entry.impurityOffset, getImpVals(i), nNodes * sizeof(double)));
+        if (entry.nodeSampleCountOffset) DAAL_CHECK_STATUS(s, file.write(entry.nodeSampleCountOffset, getNodeSampleCount(i), nNodes * sizeof(int)));
+        if (entry.probOffset) DAAL_CHECK_STATUS(s, file.write(entry.probOffset, getProbas(i), nNodes * nClasses * sizeof(double)));
+    }
+
+    DAAL_CHECK(file.close(), services::ErrorOnFileWrite);
+    return s;
+}
+
+services::Status ModelImpl::mapModel(const char * path, MappedModelKind kind, size_t & nFeatures)
+{
+    services::Status s;
+    size_t fileSize                      = 0;
+    const services::SharedPtr<byte> file = services::internal::mapFile(path, fileSize, s);
+    if (!s) return s;
+
+    const MappedModelHeader * header = reinterpret_cast<const MappedModelHeader *>(file.get());
+    bool isValid                     = (fileSize >= sizeof(MappedModelHeader));
+    for (size_t i = 0; isValid && i < sizeof(mappedModelSignature); ++i)
+    {
+        isValid = (header->signature[i] == mappedModelSignature[i]);
+    }
+    isValid = isValid && header->version == mappedModelVersion && header->kind == kind && header->nodeSize == sizeof(DecisionTreeNode)
+              && header->nTrees > 0 && header->treesOffset % sizeof(DAAL_UINT64) == 0 && header->treesOffset <= fileSize
+              && header->nTrees <= (fileSize - header->treesOffset) / sizeof(MappedTreeEntry)
+              && (kind == mappedClassificationModel || header->nClasses == 0);
+    DAAL_CHECK(isValid, services::ErrorDFIncorrectModelFileFormat);
+
+    /* Only the table of trees is read here, the pages of the trees are loaded on demand */
+    const size_t nTrees             = static_cast<size_t>(header->nTrees);
+    const size_t nClasses           = static_cast<size_t>(header->nClasses);
+    const MappedTreeEntry * entries = reinterpret_cast<const MappedTreeEntry *>(file.get() + static_cast<size_t>(header->treesOffset));
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        const MappedTreeEntry & entry = entries[i];
+        isValid = entry.nNodes > 0 && entry.nodesOffset > 0 && isValidArray(entry.nodesOffset, entry.nNodes, sizeof(DecisionTreeNode), fileSize)
+                  && isValidArray(entry.impurityOffset, entry.nNodes, sizeof(double), fileSize)
+                  && isValidArray(entry.nodeSampleCountOffset, entry.nNodes, sizeof(int), fileSize)
+                  && (entry.probOffset == 0
+                      || (nClasses > 0 && isValidArray(entry.probOffset, entry.nNodes, nClasses * sizeof(double), fileSize)));
+        DAAL_CHECK(isValid, services::ErrorDFIncorrectModelFileFormat);
+    }
+
+    destroy();
+    _mappedModel    = file;
+    _mappedTrees    = entries;
+    _nMappedClasses = nClasses;
+    _nTree.set(nTrees);
+    nFeatures = static_cast<size_t>(header->nFeatures);
+    return s;
+}
+
+services::Status ModelImpl::materializeMappedTrees()
+{
+    const size_t nTrees = size();
+    DataCollectionPtr trees(new DataCollection(nTrees));
+    DataCollectionPtr impurities(new DataCollection(nTrees));
+    DataCollectionPtr nodeSampleCounts(new DataCollection(nTrees));
+    DataCollectionPtr probs(new DataCollection(nTrees));
+    DAAL_CHECK_MALLOC(trees && impurities && nodeSampleCounts && probs);
+
+    services::Status s;
+    bool hasImpurities = true, hasNodeSampleCounts = true, hasProbs = (_nMappedClasses > 0);
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        const MappedTreeEntry & entry = _mappedTrees[i];
+        const size_t nNodes           = static_cast<size_t>(entry.nNodes);
+        byte * const base             = _mappedModel.get();
+
+        /* The mapping is private to the process, so the tables may refer to it as to the writable memory */
+        (*trees)[i].reset(new DecisionTreeTable(SharedPtr<byte>(_mappedModel, base + entry.nodesOffset), nNodes));
+        DAAL_CHECK_MALLOC((*trees)[i]);
+
+        hasImpurities       = hasImpurities && entry.impurityOffset;
+        hasNodeSampleCounts = hasNodeSampleCounts && entry.nodeSampleCountOffset;
+        hasProbs            = hasProbs && entry.probOffset;
+        if (hasImpurities)
+        {
+            (*impurities)[i] = HomogenNumericTable<double>::create(
+                reinterpretPointerCast<double, byte>(SharedPtr<byte>(_mappedModel, base + entry.impurityOffset)), 1, nNodes, &s);
+        }
+        if (hasNodeSampleCounts)
+        {
+            (*nodeSampleCounts)[i] = HomogenNumericTable<int>::create(
+                reinterpretPointerCast<int, byte>(SharedPtr<byte>(_mappedModel, base + entry.nodeSampleCountOffset)), 1, nNodes, &s);
+        }
+        if (hasProbs)
+        {
+            (*probs)[i] = HomogenNumericTable<double>::create(
+                reinterpretPointerCast<double, byte>(SharedPtr<byte>(_mappedModel, base + entry.probOffset)), nNodes, _nMappedClasses, &s);
+        }
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    _serializationData = trees;
+    _impurityTables    = hasImpurities ? impurities : DataCollectionPtr();
+    _nNodeSampleTables = hasNodeSampleCounts ? nodeSampleCounts : DataCollectionPtr();
+    _probTbl           = hasProbs ? probs : DataCollectionPtr();
+
+    /* The tables keep the mapping alive */
+    releaseMappedModel();
+    return s;
+}
+
 void MemoryManager::destroy()
 {
     for (size_t i = 0; i < _aChunk.size(); ++i)
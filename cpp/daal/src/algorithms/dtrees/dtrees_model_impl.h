@@ -66,10 +66,53 @@ public:
         setFeature<ModelFPType>(2, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse));
         allocateDataMemory();
     }
+
+    /* Constructs the table over the nodes allocated elsewhere, e.g. in the mapped model file */
+    DecisionTreeTable(const services::SharedPtr<byte> & nodes, size_t rowCount) : data_management::AOSNumericTable(sizeof(DecisionTreeNode), 3, 0)
+    {
+        setFeature<int>(0, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex));
+        setFeature<ClassIndexType>(1, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass));
+        setFeature<ModelFPType>(2, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse));
+        setArray(nodes, rowCount);
+    }
 };
 typedef services::SharedPtr<DecisionTreeTable> DecisionTreeTablePtr;
 typedef services::SharedPtr<const DecisionTreeTable> DecisionTreeTableConstPtr;
 
+/* Nodes of the tree stored one after another. The view does not own the nodes, they belong to the model */
+class DecisionTreeView
+{
+public:
+    DecisionTreeView() : _nodes(nullptr), _nNodes(0) {}
+    DecisionTreeView(const DecisionTreeNode * nodes, size_t nNodes) : _nodes(nodes), _nNodes(nNodes) {}
+
+    const DecisionTreeNode * getArray() const { return _nodes; }
+    size_t getNumberOfRows() const { return _nNodes; }
+
+private:
+    const DecisionTreeNode * _nodes;
+    size_t _nNodes;
+};
+
+/* Kinds of the models stored in the mapped model file */
+enum MappedModelKind
+{
+    mappedClassificationModel = 1,
+    mappedRegressionModel     = 2
+};
+
+/* Entry of the table of trees in the mapped model file. The offsets are counted from the beginning of the file,
+   zero offset means that the array is not stored */
+struct MappedTreeEntry
+{
+    DAAL_UINT64 nNodes;
+    DAAL_UINT64 nodesOffset;
+    DAAL_UINT64 impurityOffset;
+    DAAL_UINT64 nodeSampleCountOffset;
+    DAAL_UINT64 probOffset;
+    DAAL_UINT64 reserved;
+};
+
 template <typename TResponse, typename THistogramm>
 class ClassifierResponse
 {
@@ -478,25 +521,44 @@ public:
 
     const data_management::DataCollection * serializationData() const { return _serializationData.get(); }
 
-    const DecisionTreeTable * at(const size_t i) const { return (const DecisionTreeTable *)(*_serializationData)[i].get(); }
+    /* Returns true if the trees are read from the mapped model file. Such model cannot be modified */
+    bool isMapped() const { return _mappedTrees != nullptr; }
+
+    /* Returns the table of the tree, nullptr if the trees are read from the mapped model file */
+    const DecisionTreeTable * at(const size_t i) const
+    {
+        return _serializationData ? (const DecisionTreeTable *)(*_serializationData)[i].get() : nullptr;
+    }
+
+    DecisionTreeView getTreeView(const size_t i) const
+    {
+        if (_mappedTrees) return DecisionTreeView(mappedArray<DecisionTreeNode>(_mappedTrees[i].nodesOffset), size_t(_mappedTrees[i].nNodes));
+
+        const DecisionTreeTable * const t = at(i);
+        return t ? DecisionTreeView((const DecisionTreeNode *)t->getArray(), t->getNumberOfRows()) : DecisionTreeView();
+    }
 
     const double * getImpVals(size_t i) const
     {
+        if (_mappedTrees) return mappedArray<double>(_mappedTrees[i].impurityOffset);
         return _impurityTables ? ((const data_management::HomogenNumericTable<double> *)(*_impurityTables)[i].get())->getArray() : nullptr;
     }
 
     const int * getNodeSampleCount(size_t i) const
     {
+        if (_mappedTrees) return mappedArray<int>(_mappedTrees[i].nodeSampleCountOffset);
         return _nNodeSampleTables ? ((const data_management::HomogenNumericTable<int> *)(*_nNodeSampleTables)[i].get())->getArray() : nullptr;
     }
 
     const double * getProbas(size_t i) const
     {
+        if (_mappedTrees) return mappedArray<double>(_mappedTrees[i].probOffset);
         return _probTbl ? ((const data_management::HomogenNumericTable<double> *)(*_probTbl)[i].get())->getArray() : nullptr;
     }
 
     size_t getNumClasses() const
     {
+        if (_mappedTrees) return _nMappedClasses;
         if (_probTbl.get() == nullptr || _probTbl->size() == 0)
         {
             return 0;
@@ -504,11 +566,49 @@ public:
         return ((const data_management::HomogenNumericTable<double> *)(*_probTbl)[0].get())->getNumberOfRows();
     }
 
+    /**
+     * Writes the trees to the file in the flat format: the header, the table of trees
+     * and the arrays of the trees aligned to 64 bytes
+     * \param[in] path       Path to the file
+     * \param[in] kind       Kind of the model
+     * \param[in] nFeatures  Number of features in the model
+     */
+    services::Status writeMappedModel(const char * path, MappedModelKind kind, size_t nFeatures) const;
+
+    /**
+     * Replaces the trees of the model with the trees of the mapped model file.
+     * The predictors read the nodes directly from the mapped pages
+     * \param[in]  path       Path to the file written by writeMappedModel
+     * \param[in]  kind       Expected kind of the model
+     * \param[out] nFeatures  Number of features in the model
+     */
+    services::Status mapModel(const char * path, MappedModelKind kind, size_t & nFeatures);
+
 protected:
     void destroy();
+
+    /* Creates the tables over the arrays of the mapped model file, it is required by serialization */
+    services::Status materializeMappedTrees();
+
+    template <typename T>
+    const T * mappedArray(DAAL_UINT64 offset) const
+    {
+        return offset ? reinterpret_cast<const T *>(_mappedModel.get() + size_t(offset)) : nullptr;
+    }
+
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
+        if (onDeserialize)
+        {
+            releaseMappedModel();
+        }
+        else if (_mappedTrees)
+        {
+            services::Status s = materializeMappedTrees();
+            if (!s) return s;
+        }
+
         arch->setSharedPtrObj(_serializationData);
 
         if ((daalVersion >= COMPUTE_DAAL_VERSION(2019, 0, 0)))
@@ -533,6 +633,18 @@ protected:
     data_management::DataCollectionPtr _impurityTables;
     data_management::DataCollectionPtr _nNodeSampleTables;
     data_management::DataCollectionPtr _probTbl;
+
+    services::SharedPtr<byte> _mappedModel; //region of the mapped model file
+    const MappedTreeEntry * _mappedTrees;   //table of trees in the mapped model file, nullptr if the trees are stored in the tables
+    size_t _nMappedClasses;
+
+private:
+    void releaseMappedModel()
+    {
+        _mappedTrees    = nullptr;
+        _nMappedClasses = 0;
+        _mappedModel.reset();
+    }
 };
 
 template <typename NodeType, typename Allocator>
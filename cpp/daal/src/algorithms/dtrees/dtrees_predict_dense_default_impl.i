@@ -76,7 +76,7 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
 // Common service function. Finds a node corresponding to the given observation
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, typename TreeType, CpuType cpu>
-const DecisionTreeNode * findNode(const dtrees::internal::DecisionTreeTable & t, const FeatureTypes & featTypes, const algorithmFPType * x)
+const DecisionTreeNode * findNode(const dtrees::internal::DecisionTreeView & t, const FeatureTypes & featTypes, const algorithmFPType * x)
 {
     const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
     if (!aNode) return nullptr;
@@ -377,17 +377,17 @@ public:
         DAAL_ASSERT(iDst == getNumOOBIndices());
     }
 
-    bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
+    template <typename BinIndexType>
+    bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n, const BinIndexType * indexedFeature) const
     {
         if (this->indexedFeatures().numIndices(iFeature) == 1) return false; //single value only
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        const auto aResponse                              = this->_aResponse.get();
-        const IndexedFeatures::IndexType idx0             = indexedFeature[aResponse[aIdx[0]].idx];
-        size_t i                                          = 1;
+        const auto aResponse    = this->_aResponse.get();
+        const BinIndexType idx0 = indexedFeature[aResponse[aIdx[0]].idx];
+        size_t i                = 1;
         for (; i < n; ++i)
         {
-            const Response & r                   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const Response & r     = aResponse[aIdx[i]];
+            const BinIndexType idx = indexedFeature[r.idx];
             if (idx != idx0) break;
         }
         return (i != n);
@@ -99,6 +99,32 @@ namespace classification
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS2(Model, internal::ModelImpl, SERIALIZATION_DECISION_FOREST_CLASSIFICATION_MODEL_ID);
+
+services::Status Model::writeFile(const char * path) const
+{
+    const internal::ModelImpl * const impl = static_cast<const internal::ModelImpl *>(this);
+    return impl->writeMappedModel(path, dtrees::internal::mappedClassificationModel, impl->getNumberOfFeatures());
+}
+
+services::SharedPtr<Model> Model::createFromFile(const char * path, services::Status * stat)
+{
+    services::Status defaultSt;
+    services::Status & st = (stat ? *stat : defaultSt);
+
+    services::SharedPtr<internal::ModelImpl> model(new internal::ModelImpl());
+    if (!model)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<Model>();
+    }
+
+    size_t nFeatures = 0;
+    st |= model->mapModel(path, dtrees::internal::mappedClassificationModel, nFeatures);
+    if (!st) return services::SharedPtr<Model>();
+
+    model->setNFeatures(nFeatures);
+    return model;
+}
 }
 
 namespace internal
@@ -116,8 +142,7 @@ size_t ModelImpl::getNumberOfTrees() const
 void ModelImpl::traverseDF(size_t iTree, classifier::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t    = *at(iTree);
-    const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode = getTreeView(iTree).getArray();
     if (aNode)
     {
         auto onSplitNodeFunc = [&aNode, &visitor](size_t iRowInTable, size_t level) -> bool {
@@ -133,8 +158,7 @@ void ModelImpl::traverseDF(size_t iTree, classifier::TreeNodeVisitor & visitor)
 void ModelImpl::traverseBF(size_t iTree, classifier::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t    = *at(iTree);
-    const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode = getTreeView(iTree).getArray();
     NodeIdxArray aCur;  //nodes of current layer
     NodeIdxArray aNext; //nodes of next layer
     if (aNode)
@@ -154,8 +178,7 @@ void ModelImpl::traverseBF(size_t iTree, classifier::TreeNodeVisitor & visitor)
 void ModelImpl::traverseDFS(size_t iTree, tree_utils::classification::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t        = *at(iTree);
-    const DecisionTreeNode * aNode     = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode     = getTreeView(iTree).getArray();
     const double * const imp           = getImpVals(iTree);
     const int * const nodeSamplesCount = getNodeSampleCount(iTree);
     const double * const modelProb     = getProbas(iTree);
@@ -181,8 +204,7 @@ void ModelImpl::traverseDFS(size_t iTree, tree_utils::classification::TreeNodeVi
 void ModelImpl::traverseBFS(size_t iTree, tree_utils::classification::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t          = *at(iTree);
-    const DecisionTreeNode * const aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * const aNode = getTreeView(iTree).getArray();
     const double * const imp             = getImpVals(iTree);
     const int * const nodeSamplesCount   = getNodeSampleCount(iTree);
     const double * const modelProb       = getProbas(iTree);
@@ -229,9 +251,10 @@ services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArc
     return s;
 }
 
-bool ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
+services::Status ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
 {
-    DAAL_CHECK_STATUS_VAR(!(size() >= _serializationData->size()));
+    DAAL_CHECK(!isMapped(), services::ErrorDFMappedModelIsReadOnly);
+    DAAL_CHECK(_serializationData && size() < _serializationData->size(), services::ErrorIncorrectParameter);
     _nTree.inc();
     const size_t nNode = tree.getNumberOfNodes();
 
@@ -246,7 +269,7 @@ bool ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
         delete impTbl;
         delete nodeSamplesTbl;
         delete probTbl;
-        return false;
+        return services::Status(services::ErrorMemoryAllocationFailed);
     }
 
     tree.convertToTable(pTbl, impTbl, nodeSamplesTbl, probTbl, nClasses);
@@ -254,7 +277,7 @@ bool ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
     (*_impurityTables)[iTree].reset(impTbl);
     (*_nNodeSampleTables)[iTree].reset(nodeSamplesTbl);
     (*_probTbl)[iTree].reset(probTbl);
-    return true;
+    return services::Status();
 }
 
 } // namespace internal
@@ -203,7 +203,7 @@ protected:
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    TArray<dtrees::internal::DecisionTreeView, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
     NumericTable * _prob;
@@ -261,10 +261,10 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTrees(const size_
     for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
     {
         const dtrees::internal::DecisionTreeNode * const pNode =
-            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(*_aTree[iTree], _featHelper, x);
+            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(_aTree[iTree], _featHelper, x);
 
         DAAL_ASSERT(pNode);
-        const dtrees::internal::DecisionTreeNode * const top = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
+        const dtrees::internal::DecisionTreeNode * const top = (const DecisionTreeNode *)_aTree[iTree].getArray();
         const size_t idx                                     = pNode - top;
         const double * const probas                          = _model->getProbas(iTree);
 
@@ -313,9 +313,9 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreesWithoutConve
     for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
     {
         const dtrees::internal::DecisionTreeNode * const pNode =
-            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(*_aTree[iTree], _featHelper, x);
+            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(_aTree[iTree], _featHelper, x);
         DAAL_ASSERT(pNode);
-        const dtrees::internal::DecisionTreeNode * const top = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
+        const dtrees::internal::DecisionTreeNode * const top = (const DecisionTreeNode *)_aTree[iTree].getArray();
         const size_t idx                                     = pNode - top;
         const double * probas                                = nullptr;
 
@@ -628,8 +628,8 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictOneRowByAllTrees(
         double ** const prob_ptr = _probas.get();
         for (size_t i = 0; i < nTreesTotal; ++i)
         {
-            _aTree[i] = _model->at(i);
-            _averageTreeSize += _aTree[i]->getNumberOfRows();
+            _aTree[i] = _model->getTreeView(i);
+            _averageTreeSize += _aTree[i].getNumberOfRows();
             prob_ptr[i] = nullptr;
         }
         _averageTreeSize = _averageTreeSize / nTreesTotal;
@@ -706,8 +706,8 @@ Status PredictClassificationTask<float, avx512>::predictOneRowByAllTrees(size_t
         _averageTreeSize = 0;
         for (size_t i = 0; i < nTreesTotal; ++i)
         {
-            _aTree[i] = _model->at(i);
-            _averageTreeSize += _aTree[i]->getNumberOfRows();
+            _aTree[i] = _model->getTreeView(i);
+            _averageTreeSize += _aTree[i].getNumberOfRows();
         }
         _averageTreeSize = _averageTreeSize / nTreesTotal;
         _sumTreeSize     = 0;
@@ -728,7 +728,7 @@ Status PredictClassificationTask<float, avx512>::predictOneRowByAllTrees(size_t
         int * disp = _displaces.get();
         for (size_t iTree = 0; iTree < nTreesTotal; ++iTree)
         {
-            _sumTreeSize += _aTree[iTree]->getNumberOfRows();
+            _sumTreeSize += _aTree[iTree].getNumberOfRows();
             disp[iTree]     = -1;
             prob_ptr[iTree] = nullptr;
         }
@@ -800,11 +800,11 @@ Status PredictClassificationTask<float, avx512>::predictOneRowByAllTrees(size_t
     {
         if (disp[iTree] == -1)
         {
-            size_t displace = (iTree == 0) ? 0 : (disp[iTree - 1] + _aTree[iTree - 1]->getNumberOfRows());
+            size_t displace = (iTree == 0) ? 0 : (disp[iTree - 1] + _aTree[iTree - 1].getNumberOfRows());
             for (size_t i = 0; i < 16; ++i)
             {
-                const size_t treeSize          = _aTree[iTree + i]->getNumberOfRows();
-                const DecisionTreeNode * aNode = (const DecisionTreeNode *)(*_aTree[iTree + i]).getArray();
+                const size_t treeSize          = _aTree[iTree + i].getNumberOfRows();
+                const DecisionTreeNode * aNode = (const DecisionTreeNode *)_aTree[iTree + i].getArray();
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j < treeSize; ++j)
@@ -965,8 +965,8 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
         daal::static_tls<algorithmFPType *> tlsData([=]() { return service_scalable_calloc<algorithmFPType, cpu>(_nClasses * nRowsOfRes); });
 
         daal::static_threader_for(numberOfTrees, [&, nCols](const size_t iTree, size_t tid) {
-            const size_t treeSize                = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode * const aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
+            const size_t treeSize                = _aTree[iTree].getNumberOfRows();
+            const DecisionTreeNode * const aNode = (const DecisionTreeNode *)_aTree[iTree].getArray();
             parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, tlsData.local(tid), iTree);
         });
 
@@ -1029,8 +1029,8 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
 
         for (size_t iTree = 0; iTree < numberOfTrees; ++iTree)
         {
-            const size_t treeSize                = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode * const aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
+            const size_t treeSize                = _aTree[iTree].getNumberOfRows();
+            const DecisionTreeNode * const aNode = (const DecisionTreeNode *)_aTree[iTree].getArray();
             parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, commonBufVal, iTree);
         }
         if (prob != nullptr || res != nullptr)
@@ -1097,8 +1097,8 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         _averageTreeSize = 0;
         for (size_t i = 0; i < nTreesTotal; ++i)
         {
-            _aTree[i] = _model->at(i);
-            _averageTreeSize += _aTree[i]->getNumberOfRows();
+            _aTree[i] = _model->getTreeView(i);
+            _averageTreeSize += _aTree[i].getNumberOfRows();
         }
         _averageTreeSize = _averageTreeSize / nTreesTotal;
         _sumTreeSize     = 0;
@@ -1108,7 +1108,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         || (_data->getNumberOfRows() < _averageTreeSize * _SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE && daal::threader_get_threads_number() > 1)
         || (_data->getNumberOfRows() < _MIN_NUMBER_OF_ROWS_FOR_VECT_SEQ_COMPUTE && daal::threader_get_threads_number() == 1))
     {
-        const auto treeSize = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+        const auto treeSize = _aTree[0].getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
         DimType dim(*_data, nTreesTotal, treeSize, _nClasses);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nClasses, dim.nRowsTotal);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nClasses * dim.nRowsTotal, sizeof(ClassIndexType));
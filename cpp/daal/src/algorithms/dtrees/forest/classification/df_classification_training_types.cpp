@@ -131,6 +131,17 @@ services::Status Parameter::check() const
 }
 } // namespace interface3
 
+namespace interface4
+{
+services::Status Parameter::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, classifier::Parameter::check());
+    DAAL_CHECK_STATUS(s, decision_forest::training::checkImpl(*this));
+    return s;
+}
+} // namespace interface4
+
 } // namespace training
 } // namespace classification
 } // namespace decision_forest
@@ -198,7 +198,7 @@ services::Status PredictKernelOneAPI<algorithmFPType, method>::predictByAllTrees
 
     auto & context = services::internal::getDefaultContext();
 
-    TArray<const dtrees::internal::DecisionTreeTable *, sse2> _aTree;
+    TArray<dtrees::internal::DecisionTreeView, sse2> _aTree;
 
     const auto nTrees = pModel->size();
 
@@ -223,8 +223,8 @@ services::Status PredictKernelOneAPI<algorithmFPType, method>::predictByAllTrees
     size_t maxTreeSize = 0;
     for (size_t i = 0; i < nTrees; ++i)
     {
-        _aTree[i]   = pModel->at(i);
-        maxTreeSize = maxTreeSize < _aTree[i]->getNumberOfRows() ? _aTree[i]->getNumberOfRows() : maxTreeSize;
+        _aTree[i]   = pModel->getTreeView(i);
+        maxTreeSize = maxTreeSize < _aTree[i].getNumberOfRows() ? _aTree[i].getNumberOfRows() : maxTreeSize;
     }
 
     if (maxTreeSize > _int32max)
@@ -269,8 +269,8 @@ services::Status PredictKernelOneAPI<algorithmFPType, method>::predictByAllTrees
 
     for (size_t iTree = 0; iTree < nTrees; iTree++)
     {
-        const size_t treeSize                = _aTree[iTree]->getNumberOfRows();
-        const DecisionTreeNode * const aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
+        const size_t treeSize                = _aTree[iTree].getNumberOfRows();
+        const DecisionTreeNode * const aNode = (const DecisionTreeNode *)_aTree[iTree].getArray();
 
         int32_t * const fi         = tFI.get() + iTree * maxTreeSize;
         int32_t * const lc         = tLC.get() + iTree * maxTreeSize;
@@ -1130,7 +1130,7 @@ services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, hist>::co
 
         for (size_t tree = 0; tree < nTrees; tree++)
         {
-            mdImpl.add(mTreeHelper._tree_list[tree], _nClasses, iter + tree);
+            DAAL_CHECK_STATUS(status, mdImpl.add(mTreeHelper._tree_list[tree], _nClasses, iter + tree));
 
             DAAL_CHECK_STATUS_VAR(computeResults(mTreeHelper._tree_list[tree], dataBlock.getBlockPtr(), responseBlock.getBlockPtr(), _nSelectedRows,
                                                  _nFeatures, oobRows, oobRowsNumList, oobBufferPerObs, varImpBlock.getBlockPtr(),
@@ -31,6 +31,8 @@
 #include "src/algorithms/engines/engine_types_internal.h"
 #include "src/algorithms/service_heap.h"
 #include "src/services/service_defines.h"
+#include "src/services/service_mapped_file.h"
+#include "src/externals/service_memory.h"
 #include "src/algorithms/distributions/uniform/uniform_kernel.h"
 
 using namespace daal::algorithms::dtrees::training::internal;
@@ -304,13 +306,41 @@ services::Status selectParallelizationTechnique(const Parameter & par, engines::
 //////////////////////////////////////////////////////////////////////////////////////////
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
+//Storage of the bin indices of the training data: in the main memory or in a temporary memory-mapped file
+template <typename BinIndexType, CpuType cpu>
+class BinIndexStorage
+{
+public:
+    BinIndexStorage(bool outOfCore, const char * directory) : _outOfCore(outOfCore), _directory(directory) {}
+
+    services::Status alloc(size_t n)
+    {
+        if (_outOfCore)
+        {
+            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(BinIndexType));
+            return _file.create(_directory, n * sizeof(BinIndexType));
+        }
+        _vector.resize(n);
+        DAAL_CHECK(_vector.get(), ErrorMemoryAllocationFailed);
+        return services::Status();
+    }
+
+    BinIndexType * get() { return _outOfCore ? static_cast<BinIndexType *>(_file.get()) : _vector.get(); }
+
+private:
+    bool _outOfCore;
+    const char * _directory;
+    TVector<BinIndexType, cpu, ScalableAllocator<cpu> > _vector;
+    services::internal::MappedTempFile _file;
+};
+
 template <CpuType cpu, typename IndexType, typename BinIndexType>
 services::Status copyBinIndex(const size_t nRows, const size_t nCols, const IndexType * featureIndex,
-                              TVector<BinIndexType, cpu, ScalableAllocator<cpu> > & binIndexVector, BinIndexType ** binIndex);
+                              BinIndexStorage<BinIndexType, cpu> & binIndexStorage, BinIndexType ** binIndex);
 
 template <CpuType cpu, dtrees::internal::IndexedFeatures::IndexType, dtrees::internal::IndexedFeatures::IndexType>
 services::Status copyBinIndex(const size_t nRows, const size_t nCols, const dtrees::internal::IndexedFeatures::IndexType * featureIndex,
-                              TVector<dtrees::internal::IndexedFeatures::IndexType, cpu, ScalableAllocator<cpu> > & binIndexVector,
+                              BinIndexStorage<dtrees::internal::IndexedFeatures::IndexType, cpu> & binIndexStorage,
                               dtrees::internal::IndexedFeatures::IndexType ** binIndex)
 {
     *binIndex = const_cast<dtrees::internal::IndexedFeatures::IndexType *>(featureIndex);
@@ -319,12 +349,12 @@ services::Status copyBinIndex(const size_t nRows, const size_t nCols, const dtre
 
 template <CpuType cpu, typename IndexType, typename BinIndexType>
 services::Status copyBinIndex(const size_t nRows, const size_t nCols, const IndexType * featureIndex,
-                              TVector<BinIndexType, cpu, ScalableAllocator<cpu> > & binIndexVector, BinIndexType ** binIndex)
+                              BinIndexStorage<BinIndexType, cpu> & binIndexStorage, BinIndexType ** binIndex)
 {
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nCols);
-    binIndexVector.resize(nRows * nCols);
-    DAAL_CHECK(binIndexVector.get(), ErrorMemoryAllocationFailed);
-    *binIndex = binIndexVector.get();
+    services::Status s = binIndexStorage.alloc(nRows * nCols);
+    DAAL_CHECK_STATUS_VAR(s);
+    *binIndex = binIndexStorage.get();
 
     const size_t nThreads    = threader_get_threads_number();
     const size_t nBlocks     = ((nThreads < nRows) ? nThreads : 1);
@@ -347,23 +377,41 @@ services::Status copyBinIndex(const size_t nRows, const size_t nCols, const Inde
     return services::Status();
 }
 
+//indexed features and at least one byte per element of the bin index copy are kept during the whole training,
+//the memory saving mode is used instead if they do not fit into the scratch memory budget
+inline bool isMemorySavingModeRequired(const NumericTable & x, const Parameter & par)
+{
+    if (par.memorySavingMode) return true;
+    if (par.outOfCoreMode) return false;
+    const size_t nRows = x.getNumberOfRows();
+    const size_t nCols = x.getNumberOfColumns();
+    if (nCols && nRows > size_t(-1) / nCols) return true;
+    const size_t nElements       = nRows * nCols;
+    const size_t bytesPerElement = sizeof(dtrees::internal::IndexedFeatures::IndexType) + sizeof(uint8_t);
+    if (nElements > size_t(-1) / bytesPerElement) return true;
+    return nElements * bytesPerElement > services::internal::getAvailableScratchMemory();
+}
+
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu, typename ModelType, typename TaskType>
 services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const NumericTable * w, ModelType & md,
                              ResultData & res, const Parameter & par, size_t nClasses, const dtrees::internal::FeatureTypes & featTypes,
-                             const dtrees::internal::IndexedFeatures & indexedFeatures)
+                             dtrees::internal::IndexedFeatures & indexedFeatures)
 {
     services::Status s;
     DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
 
     const size_t nRows = x->getNumberOfRows();
     const size_t nCols = x->getNumberOfColumns();
-    TVector<BinIndexType, cpu, ScalableAllocator<cpu> > binIndexVector;
+    BinIndexStorage<BinIndexType, cpu> binIndexStorage(par.outOfCoreMode, par.outOfCoreDirectory.c_str());
     BinIndexType * binIndex = nullptr;
 
     if (!par.memorySavingMode)
     {
-        s = copyBinIndex<cpu>(nRows, nCols, indexedFeatures.data(0), binIndexVector, &binIndex);
+        s = copyBinIndex<cpu>(nRows, nCols, indexedFeatures.data(0), binIndexStorage, &binIndex);
         DAAL_CHECK_STATUS_VAR(s);
+        //in out-of-core mode only the compact copy of the indices is kept on disk
+        if (par.outOfCoreMode && (static_cast<const void *>(binIndex) != static_cast<const void *>(indexedFeatures.data(0))))
+            indexedFeatures.releaseData();
     }
 
     const auto nFeatures = x->getNumberOfColumns();
@@ -419,7 +467,8 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
         DAAL_CHECK_STATUS_THR(s);
         if (pTree)
         {
-            md.add((typename ModelType::TreeType &)*pTree, nClasses, i);
+            s = md.add((typename ModelType::TreeType &)*pTree, nClasses, i);
+            DAAL_CHECK_STATUS_THR(s);
         }
     });
     s = safeStat.detach();
@@ -1046,7 +1095,8 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
 
         if (bUseIndexedFeatures)
         {
-            if (!_helper.hasDiffFeatureValues(iFeature, aIdx, n)) continue; //all values of the feature are the same
+            if (!_helper.hasDiffFeatureValues(iFeature, aIdx, n, _binIndex + _data->getNumberOfRows() * iFeature))
+                continue; //all values of the feature are the same
             split.featureUnordered = _featHelper.isUnordered(iFeature);
             //index of best feature value in the array of sorted feature values
             const int idxFeatureValue =
@@ -60,6 +60,11 @@ Parameter::Parameter()
       maxBins(256)
 {}
 } // namespace interface2
+
+namespace interface3
+{
+Parameter::Parameter() : outOfCoreMode(false) {}
+} // namespace interface3
 Status checkImpl(const decision_forest::training::interface2::Parameter & prm)
 {
     DAAL_CHECK_EX(prm.nTrees, ErrorIncorrectParameter, ParameterName, nTreesStr());
@@ -46,6 +46,32 @@ __DAAL_REGISTER_SERIALIZATION_CLASS2(Model, internal::ModelImpl, SERIALIZATION_D
 
 Model::Model() {}
 
+services::Status Model::writeFile(const char * path) const
+{
+    const internal::ModelImpl * const impl = static_cast<const internal::ModelImpl *>(this);
+    return impl->writeMappedModel(path, dtrees::internal::mappedRegressionModel, impl->getNumberOfFeatures());
+}
+
+services::SharedPtr<Model> Model::createFromFile(const char * path, services::Status * stat)
+{
+    services::Status defaultSt;
+    services::Status & st = (stat ? *stat : defaultSt);
+
+    services::SharedPtr<internal::ModelImpl> model(new internal::ModelImpl());
+    if (!model)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<Model>();
+    }
+
+    size_t nFeatures = 0;
+    st |= model->mapModel(path, dtrees::internal::mappedRegressionModel, nFeatures);
+    if (!st) return services::SharedPtr<Model>();
+
+    model->setNumberOfFeatures(nFeatures);
+    return model;
+}
+
 } // namespace interface1
 
 namespace internal
@@ -63,8 +89,7 @@ size_t ModelImpl::getNumberOfTrees() const
 void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t    = *at(iTree);
-    const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode = getTreeView(iTree).getArray();
     if (aNode)
     {
         auto onSplitNodeFunc = [&aNode, &visitor](size_t iRowInTable, size_t level) -> bool {
@@ -80,8 +105,7 @@ void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor
 void ModelImpl::traverseBF(size_t iTree, algorithms::regression::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t    = *at(iTree);
-    const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode = getTreeView(iTree).getArray();
     NodeIdxArray aCur;  //nodes of current layer
     NodeIdxArray aNext; //nodes of next layer
     if (aNode)
@@ -101,8 +125,7 @@ void ModelImpl::traverseBF(size_t iTree, algorithms::regression::TreeNodeVisitor
 void ModelImpl::traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t    = *at(iTree);
-    const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode = getTreeView(iTree).getArray();
     const double * imp             = getImpVals(iTree);
     const int * nodeSamplesCount   = getNodeSampleCount(iTree);
     if (aNode)
@@ -125,8 +148,7 @@ void ModelImpl::traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisito
 void ModelImpl::traverseBFS(size_t iTree, tree_utils::regression::TreeNodeVisitor & visitor) const
 {
     if (iTree >= size()) return;
-    const DecisionTreeTable & t    = *at(iTree);
-    const DecisionTreeNode * aNode = (const DecisionTreeNode *)t.getArray();
+    const DecisionTreeNode * aNode = getTreeView(iTree).getArray();
     const double * imp             = getImpVals(iTree);
     const int * nodeSamplesCount   = getNodeSampleCount(iTree);
     NodeIdxArray aCur;  //nodes of current layer
@@ -161,9 +183,10 @@ services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArc
     return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch));
 }
 
-bool ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
+services::Status ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
 {
-    DAAL_CHECK_STATUS_VAR(!(size() >= _serializationData->size()));
+    DAAL_CHECK(!isMapped(), services::ErrorDFMappedModelIsReadOnly);
+    DAAL_CHECK(_serializationData && size() < _serializationData->size(), services::ErrorIncorrectParameter);
     _nTree.inc();
     const size_t nNode = tree.getNumberOfNodes();
 
@@ -178,7 +201,7 @@ bool ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
         delete impTbl;
         delete nodeSamplesTbl;
         delete probTbl;
-        return false;
+        return services::Status(services::ErrorMemoryAllocationFailed);
     }
 
     tree.convertToTable(pTbl, impTbl, nodeSamplesTbl, probTbl, 0);
@@ -188,7 +211,7 @@ bool ModelImpl::add(const TreeType & tree, size_t nClasses, size_t iTree)
     (*_nNodeSampleTables)[iTree].reset(nodeSamplesTbl);
     (*_probTbl)[iTree].reset(probTbl);
 
-    return true;
+    return services::Status();
 }
 
 } // namespace internal
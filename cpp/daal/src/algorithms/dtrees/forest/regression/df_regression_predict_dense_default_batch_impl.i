@@ -85,7 +85,7 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     const auto nTreesTotal = m->size();
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
-    for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->getTreeView(i);
     const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
     return super::run(pHostApp, div);
 }
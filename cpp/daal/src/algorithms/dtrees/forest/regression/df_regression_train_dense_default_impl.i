@@ -835,41 +835,45 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     services::Status s;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK(featTypes.init(*x), ErrorMemoryAllocationFailed);
+    //the memory saving mode is also used if the indexed features do not fit into the scratch memory budget
+    Parameter trainPar(par);
+    trainPar.memorySavingMode = isMemorySavingModeRequired(*x, par);
     dtrees::internal::IndexedFeatures indexedFeatures;
+    if (par.outOfCoreMode) indexedFeatures.setOutOfCore(par.outOfCoreDirectory.c_str());
     if (method == hist)
     {
-        if (!par.memorySavingMode)
+        if (!trainPar.memorySavingMode)
         {
-            BinParams prm(par.maxBins, par.minBinSize);
+            BinParams prm(trainPar.maxBins, trainPar.minBinSize);
             s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, &prm);
             DAAL_CHECK_STATUS_VAR(s);
             if (indexedFeatures.maxNumIndices() <= 256)
                 s = computeImpl<algorithmFPType, uint8_t, cpu, daal::algorithms::decision_forest::regression::internal::ModelImpl,
                                 TrainBatchTask<algorithmFPType, uint8_t, hist, cpu> >(
-                    pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0, featTypes,
-                    indexedFeatures);
+                    pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, trainPar,
+                    0, featTypes, indexedFeatures);
             else if (indexedFeatures.maxNumIndices() <= 65536)
                 s = computeImpl<algorithmFPType, uint16_t, cpu, daal::algorithms::decision_forest::regression::internal::ModelImpl,
                                 TrainBatchTask<algorithmFPType, uint16_t, hist, cpu> >(
-                    pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0, featTypes,
-                    indexedFeatures);
+                    pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, trainPar,
+                    0, featTypes, indexedFeatures);
             else
                 s = computeImpl<algorithmFPType, dtrees::internal::IndexedFeatures::IndexType, cpu,
                                 daal::algorithms::decision_forest::regression::internal::ModelImpl,
                                 TrainBatchTask<algorithmFPType, dtrees::internal::IndexedFeatures::IndexType, hist, cpu> >(
-                    pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0, featTypes,
-                    indexedFeatures);
+                    pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, trainPar,
+                    0, featTypes, indexedFeatures);
         }
         else
             s = computeImpl<algorithmFPType, dtrees::internal::IndexedFeatures::IndexType, cpu,
                             daal::algorithms::decision_forest::regression::internal::ModelImpl,
                             TrainBatchTask<algorithmFPType, dtrees::internal::IndexedFeatures::IndexType, hist, cpu> >(
-                pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0, featTypes,
+                pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, trainPar, 0, featTypes,
                 indexedFeatures);
     }
     else
     {
-        if (!par.memorySavingMode)
+        if (!trainPar.memorySavingMode)
         {
             s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes);
             DAAL_CHECK_STATUS_VAR(s);
@@ -877,7 +881,7 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
         s = computeImpl<algorithmFPType, dtrees::internal::IndexedFeatures::IndexType, cpu,
                         daal::algorithms::decision_forest::regression::internal::ModelImpl,
                         TrainBatchTask<algorithmFPType, dtrees::internal::IndexedFeatures::IndexType, defaultDense, cpu> >(
-            pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0, featTypes,
+            pHostApp, x, y, w, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, trainPar, 0, featTypes,
             indexedFeatures);
     }
 
@@ -51,6 +51,15 @@ Status Parameter::check() const
 }
 } // namespace interface2
 
+namespace interface3
+{
+Parameter::Parameter() {}
+Status Parameter::check() const
+{
+    return decision_forest::training::checkImpl(*this);
+}
+} // namespace interface3
+
 namespace interface1
 {
 /** Default constructor */
@@ -90,8 +99,8 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     NumericTablePtr dependentVariableTable = get(dependentVariable);
 
     DAAL_CHECK_EX(dependentVariableTable->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, dependentVariableStr());
-    const daal::algorithms::decision_forest::regression::training::interface2::Parameter * parameter2 =
-        dynamic_cast<const daal::algorithms::decision_forest::regression::training::interface2::Parameter *>(par);
+    const daal::algorithms::decision_forest::training::interface2::Parameter * parameter2 =
+        dynamic_cast<const daal::algorithms::decision_forest::training::interface2::Parameter *>(par);
     if (parameter2 != NULL)
     {
         const size_t nSamplesPerTree(parameter2->observationsPerTreeFraction * dataTable->getNumberOfRows());
@@ -84,8 +84,8 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     const decision_forest::regression::training::Input * algInput = static_cast<const decision_forest::regression::training::Input *>(input);
 
     //TODO: check model
-    const daal::algorithms::decision_forest::regression::training::interface2::Parameter * algParameter2 =
-        dynamic_cast<const daal::algorithms::decision_forest::regression::training::interface2::Parameter *>(par);
+    const daal::algorithms::decision_forest::training::interface2::Parameter * algParameter2 =
+        dynamic_cast<const daal::algorithms::decision_forest::training::interface2::Parameter *>(par);
 
     if (algParameter2 != NULL)
     {
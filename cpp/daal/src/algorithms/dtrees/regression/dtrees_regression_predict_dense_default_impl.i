@@ -59,7 +59,7 @@ public:
     PredictRegressionTaskBase(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
 
 protected:
-    static algorithmFPType predict(const dtrees::internal::DecisionTreeTable & t, const dtrees::internal::FeatureTypes & featTypes,
+    static algorithmFPType predict(const dtrees::internal::DecisionTreeView & t, const dtrees::internal::FeatureTypes & featTypes,
                                    const algorithmFPType * x)
     {
         const typename dtrees::internal::DecisionTreeNode * pNode =
@@ -74,14 +74,14 @@ protected:
         algorithmFPType val    = 0;
         const size_t iLastTree = iFirstTree + nTrees;
 
-        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(*_aTree[iTree], _featHelper, x);
+        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(_aTree[iTree], _featHelper, x);
         return val;
     }
     services::Status run(services::HostAppIface * pHostApp, algorithmFPType factor);
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    TArray<dtrees::internal::DecisionTreeView, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
 };
@@ -90,7 +90,7 @@ template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::HostAppIface * pHostApp, algorithmFPType factor)
 {
     const auto nTreesTotal = _aTree.size();
-    const auto treeSize    = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+    const auto treeSize    = _aTree[0].getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
 
     dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
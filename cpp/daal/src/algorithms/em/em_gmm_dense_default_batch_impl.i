@@ -69,7 +69,7 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
     double oldLogLikelyhood = 0;
 
     daal::tls<Task<algorithmFPType, cpu> *> threadBuffer([=]() -> Task<algorithmFPType, cpu> * {
-        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs.get());
+        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs.get(), precisions);
     });
     int & iterCounter               = iterCounterArray[0];
     algorithmFPType & logLikelyhood = logLikelyhoodArray[0];
@@ -81,6 +81,11 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
 
         Math<algorithmFPType, cpu>::vLog(nComponents, alpha, logAlpha); // inplace: same memory as alpha
 
+        if (par.covarianceStorage != full && !IsSameType<algorithmFPType, float>::value)
+        {
+            computePrecisions();
+        }
+
         logLikelyhood = 0;
 
         SafeStatus safeStat;
@@ -167,8 +172,11 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
     const size_t nComponents = t.nComponents;
     const size_t nFeatures   = t.nFeatures;
 
-    if (covType == diagonal)
+    if (covType != full && IsSameType<algorithmFPType, float>::value)
     {
+        /* In single precision the data is centered by the mean of every component: the expanded form of the quadratic form
+         * used below loses all the significant digits when the distance from the data to the means is small compared
+         * to the magnitude of the data */
         for (size_t k = 0; k < nComponents; k++)
         {
             const algorithmFPType * curMean  = &t.means[k * nFeatures];
@@ -190,6 +198,88 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
             }
         }
     }
+    else if (covType != full)
+    {
+        /* Log density of the Gaussian with diagonal covariance is a quadratic form of x:
+         * p_ik = c_k + sum_j(q_kj * y_ij^2) + sum_j(l_kj * y_ij), where y = x - s is the data shifted by the mean of the component means,
+         * q_kj = -0.5 / sigma_kj and l_kj = (mu_kj - s_j) / sigma_kj, hence it is computed for all the components by matrix-matrix
+         * products with precomputed coefficients. The shift removes the common offset of the data, which would cancel otherwise */
+        typedef Blas<algorithmFPType, cpu> blas;
+
+        const algorithmFPType * quadCoeff  = t.precisions;
+        const algorithmFPType * linCoeff   = quadCoeff + nComponents * nFeatures;
+        const algorithmFPType * constCoeff = linCoeff + nComponents * nFeatures;
+        const algorithmFPType * shift      = constCoeff + nComponents;
+
+        char transa              = 'T';
+        char transb              = 'N';
+        DAAL_INT nRows           = nVectorsInCurrentBlock;
+        DAAL_INT nCols           = nComponents;
+        DAAL_INT nInner          = nFeatures;
+        algorithmFPType one      = 1.0;
+        algorithmFPType zero     = 0.0;
+        algorithmFPType * y      = t.x_mu; // shifted data, then its squares
+        algorithmFPType * rowSqr = t.rowSum; // squared norms of the rows
+
+        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                y[i * nFeatures + j] = t.dataBlock[i * nFeatures + j] - shift[j];
+            }
+        }
+
+        blas::xxgemm(&transa, &transb, &nRows, &nCols, &nInner, &one, y, &nInner, linCoeff, &nInner, &zero, t.p, &nRows);
+
+        if (covType == diagonal)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nVectorsInCurrentBlock * nFeatures; i++)
+            {
+                y[i] = y[i] * y[i];
+            }
+            blas::xxgemm(&transa, &transb, &nRows, &nCols, &nInner, &one, y, &nInner, quadCoeff, &nInner, &one, t.p, &nRows);
+
+            for (size_t k = 0; k < nComponents; k++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+                {
+                    t.p[k * nVectorsInCurrentBlock + i] += constCoeff[k];
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                algorithmFPType sqr = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sqr += y[i * nFeatures + j] * y[i * nFeatures + j];
+                }
+                rowSqr[i] = sqr;
+            }
+
+            for (size_t k = 0; k < nComponents; k++)
+            {
+                const algorithmFPType q = quadCoeff[k * nFeatures];
+                const algorithmFPType c = constCoeff[k];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+                {
+                    t.p[k * nVectorsInCurrentBlock + i] += c + q * rowSqr[i];
+                }
+            }
+        }
+    }
     else
     {
         daal::services::internal::transpose<algorithmFPType, cpu>(t.dataBlock, nVectorsInCurrentBlock, nFeatures, t.trans_data);
@@ -237,8 +327,10 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
         }
     }
 
-    t.partLogLikelyhood        = 0;
-    algorithmFPType * maxInRow = t.rowSum;
+    /* Log-sum-exp over the components: the loops below are kept branch-free to be vectorized */
+    t.partLogLikelyhood                = 0;
+    algorithmFPType * maxInRow         = t.rowSum;
+    const algorithmFPType expThreshold = exp_threshold<algorithmFPType>();
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
@@ -248,44 +340,36 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
 
     for (size_t k = 1; k < nComponents; k++)
     {
+        const algorithmFPType * pk = &t.p[k * nVectorsInCurrentBlock];
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            if (t.p[k * nVectorsInCurrentBlock + i] > maxInRow[i])
-            {
-                maxInRow[i] = t.p[k * nVectorsInCurrentBlock + i];
-            }
+            maxInRow[i] = (pk[i] > maxInRow[i]) ? pk[i] : maxInRow[i];
         }
     }
 
     for (size_t k = 0; k < nComponents; k++)
     {
+        algorithmFPType * pk = &t.p[k * nVectorsInCurrentBlock];
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            t.p[k * nVectorsInCurrentBlock + i] -= maxInRow[i];
-            if (t.p[k * nVectorsInCurrentBlock + i] < exp_threshold<algorithmFPType>())
-            {
-                t.p[k * nVectorsInCurrentBlock + i] = exp_threshold<algorithmFPType>();
-            }
+            const algorithmFPType shifted = pk[i] - maxInRow[i];
+            pk[i]                         = (shifted < expThreshold) ? expThreshold : shifted;
         }
     }
 
+    algorithmFPType sumOfMax = 0;
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
     {
-        t.partLogLikelyhood += maxInRow[i];
-    }
-
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-    {
+        sumOfMax += maxInRow[i];
         maxInRow[i] = 0; // same memory as t.rowSum, set to zero before computing row sum
     }
+    t.partLogLikelyhood = sumOfMax;
 
     Math<algorithmFPType, cpu>::vExp(nVectorsInCurrentBlock * nComponents, t.p, t.p);
 
@@ -357,7 +441,7 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_partial(const size_t nV
     const size_t nFeatures         = t.nFeatures;
     const size_t nElementsOnOneCov = t.covs->getOneCovSize();
     algorithmFPType * dataBlock    = const_cast<algorithmFPType *>(t.trans_data);
-    if (covType == diagonal)
+    if (covType != full)
     {
         dataBlock = const_cast<algorithmFPType *>(t.dataBlock);
     }
@@ -394,6 +478,11 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_merge(size_t iteration)
     {
         if (alpha[k] < MinVal<algorithmFPType>::get())
         {
+            if (allowEmptyComponents)
+            {
+                alpha[k] = 0;
+                continue;
+            }
             ErrorPtr e = Error::create(ErrorEMCovariance, Component, k);
             e->addIntDetail(Iteration, iteration + 1);
             return Status(e);
@@ -427,7 +516,8 @@ EMKernelTask<algorithmFPType, method, cpu>::EMKernelTask(NumericTable & dataTabl
       nVectors(dataTable.getNumberOfRows()),
       threshold(par.accuracyThreshold),
       maxIterations(par.maxIterations),
-      nComponents(par.nComponents)
+      nComponents(par.nComponents),
+      allowEmptyComponents(false)
 {
     algorithmFPType pi      = 3.1415926535897932384626433;
     logLikelyhoodCorrection = 0.5 * nVectors * nFeatures * Math<algorithmFPType, cpu>::sLog(2 * pi);
@@ -449,6 +539,10 @@ SharedPtr<GmmModel<algorithmFPType, cpu> > EMKernelTask<algorithmFPType, method,
     {
         covs = GmmModelPtr(new GmmModelDiagType(nFeatures, nComponents));
     }
+    else if (par.covarianceStorage == spherical)
+    {
+        covs = GmmModelPtr(new GmmModelSphericalType(nFeatures, nComponents));
+    }
     else
     {
         covs = GmmModelPtr(new GmmModelFullType(nFeatures, nComponents));
@@ -489,6 +583,15 @@ Status EMKernelTask<algorithmFPType, method, cpu>::initialize()
     covs = initializeCovariances();
     DAAL_CHECK(covs, ErrorMemoryAllocationFailed);
 
+    /* Coefficients of the matrix form of the E-step, it is not used in single precision */
+    precisions = nullptr;
+    if (par.covarianceStorage != full && !IsSameType<algorithmFPType, float>::value)
+    {
+        precisionsPtr.reset(2 * nComponents * nFeatures + nComponents + nFeatures);
+        precisions = precisionsPtr.get();
+        DAAL_CHECK(precisions, ErrorMemoryAllocationFailed);
+    }
+
     return Status();
 }
 
@@ -506,6 +609,57 @@ void EMKernelTask<algorithmFPType, method, cpu>::setResultToZero()
     covs->setToZero();
 }
 
+/**
+ * Function computes coefficients of the E-step for diagonal and spherical covariances:
+ * quadratic -0.5 / sigma, linear (mean - shift) / sigma and constant terms of the log density of each component
+ * in the data shifted by the mean of the component means.
+ * Covariances are expected to be inverted in place.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::computePrecisions()
+{
+    algorithmFPType * quadCoeff                = precisions;
+    algorithmFPType * linCoeff                 = quadCoeff + nComponents * nFeatures;
+    algorithmFPType * constCoeff               = linCoeff + nComponents * nFeatures;
+    algorithmFPType * shift                    = constCoeff + nComponents;
+    const algorithmFPType * logSqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
+
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        shift[j] = 0;
+    }
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            shift[j] += means[k * nFeatures + j];
+        }
+    }
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        shift[j] /= algorithmFPType(nComponents);
+    }
+
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        const algorithmFPType * invSigma = covs->getSigma(k);
+        const algorithmFPType * curMean  = &means[k * nFeatures];
+        algorithmFPType meanInvSigmaMean = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType shiftedMean = curMean[j] - shift[j];
+            quadCoeff[k * nFeatures + j]      = -0.5 * invSigma[j];
+            linCoeff[k * nFeatures + j]       = shiftedMean * invSigma[j];
+            meanInvSigmaMean += shiftedMean * shiftedMean * invSigma[j];
+        }
+        constCoeff[k] = logAlpha[k] + logSqrtInvDetSigma[k] - 0.5 * meanInvSigmaMean;
+    }
+}
+
 /**
  * Function merges partial cross products, sum of weights and means
  */
@@ -62,6 +62,7 @@ class EMKernelTask
     typedef SharedPtr<GmmModel<algorithmFPType, cpu> > GmmModelPtr;
     typedef GmmModelDiag<algorithmFPType, cpu> GmmModelDiagType;
     typedef GmmModelFull<algorithmFPType, cpu> GmmModelFullType;
+    typedef GmmModelSpherical<algorithmFPType, cpu> GmmModelSphericalType;
 
     SharedPtr<GmmModel<algorithmFPType, cpu> > initializeCovariances();
 
@@ -75,6 +76,7 @@ public:
     Status initialize();
     services::Status setStartValues();
     void setResultToZero();
+    void computePrecisions();
     Status stepM_merge(size_t iteration);
 
     static void stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
@@ -88,6 +90,7 @@ public:
     algorithmFPType * logAlpha;
     int * iterCounterArray;
     algorithmFPType * logLikelyhoodArray;
+    algorithmFPType * precisions;
 
     size_t blockSizeDefault;
     size_t nBlocks;
@@ -98,8 +101,10 @@ public:
     algorithmFPType logLikelyhoodCorrection;
     const DAAL_INT maxIterations;
     const algorithmFPType threshold;
+    bool allowEmptyComponents; /* Components with zero sum of weights get zero weight instead of the error */
     TArray<WriteRows<algorithmFPType, cpu, NumericTable>, cpu> covsPtr;
     GmmModelPtr covs;
+    TArray<algorithmFPType, cpu> precisionsPtr;
 
     WriteRows<algorithmFPType, cpu, NumericTable> weightsBD;
     WriteRows<algorithmFPType, cpu, NumericTable> meansBD;
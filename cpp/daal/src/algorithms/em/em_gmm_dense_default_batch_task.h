@@ -280,6 +280,30 @@ public:
                          algorithmFPType & w_m, size_t nFeatures);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class GmmModelSpherical : public GmmModelDiag<algorithmFPType, cpu>
+{
+public:
+    using GmmModel<algorithmFPType, cpu>::nFeatures;
+    using GmmModel<algorithmFPType, cpu>::sigma;
+    GmmModelSpherical(size_t _nFeatures, size_t _nComponents) : GmmModelDiag<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
+
+    void finalize(size_t k, algorithmFPType denominator)
+    {
+        /* Variance of the component is the mean of the diagonal elements of its covariance */
+        algorithmFPType variance = 0.0;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            variance += sigma[k][i];
+        }
+        variance /= denominator * nFeatures;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            sigma[k][i] = variance;
+        }
+    }
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct Task
 {
@@ -287,12 +311,13 @@ struct Task
 
     Task(NumericTable & _dataTable, size_t blockSizeDefault, size_t _nFeatures, size_t _nComponents,
          algorithmFPType * _logAlpha, //placed in alpha memory
-         algorithmFPType * _means, GmmModel<algorithmFPType, cpu> * _covs)
+         algorithmFPType * _means, GmmModel<algorithmFPType, cpu> * _covs, const algorithmFPType * _precisions)
         : dataTable(&_dataTable),
           dataBlock(nullptr),
           logAlpha(_logAlpha),
           means(_means),
           covs(_covs),
+          precisions(_precisions),
           invSigma(_covs->getSigma()),
           logSqrtInvDetSigma(_covs->getLogSqrtInvDetSigma()),
           nFeatures(_nFeatures),
@@ -379,6 +404,7 @@ struct Task
     algorithmFPType * means;
     algorithmFPType ** invSigma;
     algorithmFPType * logSqrtInvDetSigma;
+    const algorithmFPType * precisions; /* coefficients of the E-step for diagonal and spherical covariances */
     algorithmFPType partLogLikelyhood;
 
     algorithmFPType * wSums;
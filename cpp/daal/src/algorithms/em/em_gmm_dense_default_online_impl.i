@@ -0,0 +1,325 @@
+/* file: em_gmm_dense_default_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of online em algorithm
+//--
+
+#include "src/externals/service_math.h"
+#include "src/services/service_data_utils.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/em/em_gmm_dense_default_online_kernel.h"
+#include "src/algorithms/em/em_gmm_dense_default_batch_kernel.h"
+#include "src/algorithms/service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+/**
+ * Function updates running sufficient statistics of the Gaussian mixture model with the block of data:
+ * S = (1 - gamma) * S + gamma * s, where s are the statistics of the block computed with the model M(S),
+ * gamma = (t + 1 + offset)^(-decay) and t is the number of processed blocks including the current one.
+ * The initial model is used as the statistics of the zeroth block
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, NumericTable & initialWeights,
+                                                                       NumericTable & initialMeans, NumericTable ** initialCovariances,
+                                                                       NumericTable & sumOfResponsibilities, NumericTable & sumOfWeightedData,
+                                                                       NumericTable & sumOfWeightedCrossProducts, NumericTable & partialGoalFunction,
+                                                                       NumericTable & nProcessedBlocks, const OnlineParameter & par)
+{
+    const size_t nFeatures   = dataTable.getNumberOfColumns();
+    const size_t nVectors    = dataTable.getNumberOfRows();
+    const size_t nComponents = par.nComponents;
+    const size_t nCovRows    = (par.covarianceStorage == full) ? nFeatures : 1;
+
+    WriteRows<algorithmFPType, cpu> s0Rows(sumOfResponsibilities, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(s0Rows);
+    WriteRows<algorithmFPType, cpu> s1Rows(sumOfWeightedData, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(s1Rows);
+    WriteRows<algorithmFPType, cpu> s2Rows(sumOfWeightedCrossProducts, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(s2Rows);
+    WriteRows<algorithmFPType, cpu> goalRows(partialGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(goalRows);
+    WriteRows<int, cpu> nBlocksRows(nProcessedBlocks, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nBlocksRows);
+
+    algorithmFPType * s0   = s0Rows.get();
+    algorithmFPType * s1   = s1Rows.get();
+    algorithmFPType * s2   = s2Rows.get();
+    algorithmFPType & goal = goalRows.get()[0];
+    int & nBlocks          = nBlocksRows.get()[0];
+
+    services::Status s;
+    if (nBlocks == 0)
+    {
+        DAAL_CHECK_STATUS(s, setStatistics(initialWeights, initialMeans, initialCovariances, algorithmFPType(1), s0, s1, s2, nComponents, nFeatures,
+                                           par.covarianceStorage));
+        goal = 0;
+    }
+
+    /* Model of the current statistics is the starting point of the block, the one iteration of the batch algorithm
+     * over the block gives the responsibility-weighted statistics of the block as the weights, means and covariances */
+    typedef HomogenNumericTableCPU<algorithmFPType, cpu> TableType;
+    typedef HomogenNumericTableCPU<int, cpu> IntTableType;
+
+    services::SharedPtr<TableType> curWeights   = TableType::create(nComponents, 1, &s);
+    services::SharedPtr<TableType> curMeans     = TableType::create(nFeatures, nComponents, &s);
+    services::SharedPtr<TableType> blockWeights = TableType::create(nComponents, 1, &s);
+    services::SharedPtr<TableType> blockMeans   = TableType::create(nFeatures, nComponents, &s);
+    services::SharedPtr<TableType> blockGoal    = TableType::create(1, 1, &s);
+    services::SharedPtr<IntTableType> blockNIt  = IntTableType::create(1, 1, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    TArray<NumericTablePtr, cpu> covTables(2 * nComponents);
+    TArray<NumericTable *, cpu> covPtrs(2 * nComponents);
+    DAAL_CHECK_MALLOC(covTables.get() && covPtrs.get());
+    for (size_t i = 0; i < 2 * nComponents; i++)
+    {
+        covTables[i] = TableType::create(nFeatures, nCovRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        covPtrs[i] = covTables[i].get();
+    }
+    NumericTable ** curCovs   = covPtrs.get();
+    NumericTable ** blockCovs = covPtrs.get() + nComponents;
+
+    DAAL_CHECK_STATUS(s, computeModel(s0, s1, s2, *curWeights, *curMeans, curCovs, nComponents, nFeatures, par.covarianceStorage));
+
+    Parameter blockPar(par);
+    blockPar.maxIterations = 1;
+
+    EMKernelTask<algorithmFPType, method, cpu> task(dataTable, *curWeights, *curMeans, curCovs, *blockWeights, *blockMeans, blockCovs, *blockNIt,
+                                                    *blockGoal, blockPar);
+    task.allowEmptyComponents = true;
+    DAAL_CHECK_STATUS(s, task.compute());
+
+    nBlocks++;
+    const algorithmFPType gamma = Math<algorithmFPType, cpu>::sPowx(algorithmFPType(nBlocks) + 1 + par.stepSizeOffset, -par.stepSizeDecay);
+
+    DAAL_CHECK_STATUS(s, setStatistics(*blockWeights, *blockMeans, blockCovs, gamma, s0, s1, s2, nComponents, nFeatures, par.covarianceStorage));
+
+    ReadRows<algorithmFPType, cpu> blockGoalRows(*blockGoal, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(blockGoalRows);
+    goal = (1 - gamma) * goal + gamma * blockGoalRows.get()[0] / algorithmFPType(nVectors);
+    return s;
+}
+
+/**
+ * Function computes the parameters of the Gaussian mixture model from the running sufficient statistics
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
+    NumericTable & sumOfResponsibilities, NumericTable & sumOfWeightedData, NumericTable & sumOfWeightedCrossProducts,
+    NumericTable & partialGoalFunction, NumericTable & nProcessedBlocks, NumericTable & resultWeights, NumericTable & resultMeans,
+    NumericTable ** resultCovariances, NumericTable & resultNIterations, NumericTable & resultGoalFunction, const OnlineParameter & par)
+{
+    const size_t nFeatures   = sumOfWeightedData.getNumberOfColumns();
+    const size_t nComponents = par.nComponents;
+
+    ReadRows<algorithmFPType, cpu> s0Rows(sumOfResponsibilities, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(s0Rows);
+    ReadRows<algorithmFPType, cpu> s1Rows(sumOfWeightedData, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(s1Rows);
+    ReadRows<algorithmFPType, cpu> s2Rows(sumOfWeightedCrossProducts, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(s2Rows);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, computeModel(s0Rows.get(), s1Rows.get(), s2Rows.get(), resultWeights, resultMeans, resultCovariances, nComponents, nFeatures,
+                                      par.covarianceStorage));
+
+    ReadRows<algorithmFPType, cpu> goalRows(partialGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(goalRows);
+    WriteOnlyRows<algorithmFPType, cpu> resultGoalRows(resultGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resultGoalRows);
+    resultGoalRows.get()[0] = goalRows.get()[0];
+
+    ReadRows<int, cpu> nBlocksRows(nProcessedBlocks, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nBlocksRows);
+    WriteOnlyRows<int, cpu> resultNIterationsRows(resultNIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resultNIterationsRows);
+    resultNIterationsRows.get()[0] = nBlocksRows.get()[0];
+    return s;
+}
+
+/**
+ * Function blends the sufficient statistics of the model into the running ones:
+ * s0 = w, s1 = w * mu, s2 = w * (sigma + mu * mu^T)
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::setStatistics(NumericTable & weights, NumericTable & means,
+                                                                             NumericTable ** covariances, algorithmFPType gamma, algorithmFPType * s0,
+                                                                             algorithmFPType * s1, algorithmFPType * s2, const size_t nComponents,
+                                                                             const size_t nFeatures, const CovarianceStorageId covType)
+{
+    const size_t covSize                = (covType == full) ? nFeatures * nFeatures : nFeatures;
+    const size_t nCovRows               = (covType == full) ? nFeatures : 1;
+    const algorithmFPType oneMinusGamma = 1 - gamma;
+
+    ReadRows<algorithmFPType, cpu> weightsRows(weights, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(weightsRows);
+    ReadRows<algorithmFPType, cpu> meansRows(means, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(meansRows);
+    const algorithmFPType * w  = weightsRows.get();
+    const algorithmFPType * mu = meansRows.get();
+
+    ReadRows<algorithmFPType, cpu> covRows;
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        const algorithmFPType * sigma = covRows.set(covariances[k], 0, nCovRows);
+        DAAL_CHECK_BLOCK_STATUS(covRows);
+
+        const algorithmFPType wk   = w[k];
+        const algorithmFPType * mk = &mu[k * nFeatures];
+        algorithmFPType * s1k      = &s1[k * nFeatures];
+        algorithmFPType * s2k      = &s2[k * covSize];
+
+        s0[k] = oneMinusGamma * s0[k] + gamma * wk;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            s1k[j] = oneMinusGamma * s1k[j] + gamma * wk * mk[j];
+        }
+
+        if (covType == full)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    s2k[i * nFeatures + j] = oneMinusGamma * s2k[i * nFeatures + j] + gamma * wk * (sigma[i * nFeatures + j] + mk[i] * mk[j]);
+                }
+            }
+        }
+        else
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                s2k[j] = oneMinusGamma * s2k[j] + gamma * wk * (sigma[j] + mk[j] * mk[j]);
+            }
+        }
+    }
+    return services::Status();
+}
+
+/**
+ * Function computes the model from the sufficient statistics:
+ * w = s0 / sum(s0), mu = s1 / s0, sigma = s2 / s0 - mu * mu^T
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::computeModel(const algorithmFPType * s0, const algorithmFPType * s1,
+                                                                            const algorithmFPType * s2, NumericTable & weights, NumericTable & means,
+                                                                            NumericTable ** covariances, const size_t nComponents,
+                                                                            const size_t nFeatures, const CovarianceStorageId covType)
+{
+    const size_t covSize  = (covType == full) ? nFeatures * nFeatures : nFeatures;
+    const size_t nCovRows = (covType == full) ? nFeatures : 1;
+
+    WriteOnlyRows<algorithmFPType, cpu> weightsRows(weights, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(weightsRows);
+    WriteOnlyRows<algorithmFPType, cpu> meansRows(means, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(meansRows);
+    algorithmFPType * w  = weightsRows.get();
+    algorithmFPType * mu = meansRows.get();
+
+    algorithmFPType sumOfWeights = 0;
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        sumOfWeights += s0[k];
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> covRows;
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        if (s0[k] < MinVal<algorithmFPType>::get())
+        {
+            return Status(Error::create(ErrorEMCovariance, Component, k));
+        }
+        algorithmFPType * sigma = covRows.set(covariances[k], 0, nCovRows);
+        DAAL_CHECK_BLOCK_STATUS(covRows);
+
+        const algorithmFPType invWeight = algorithmFPType(1) / s0[k];
+        const algorithmFPType * s1k     = &s1[k * nFeatures];
+        const algorithmFPType * s2k     = &s2[k * covSize];
+        algorithmFPType * mk            = &mu[k * nFeatures];
+
+        w[k] = s0[k] / sumOfWeights;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mk[j] = s1k[j] * invWeight;
+        }
+
+        if (covType == full)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sigma[i * nFeatures + j] = s2k[i * nFeatures + j] * invWeight - mk[i] * mk[j];
+                }
+            }
+        }
+        else
+        {
+            algorithmFPType variance = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sigma[j] = s2k[j] * invWeight - mk[j] * mk[j];
+                variance += sigma[j];
+            }
+
+            if (covType == spherical)
+            {
+                variance /= nFeatures;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sigma[j] = variance;
+                }
+            }
+        }
+    }
+    return services::Status();
+}
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
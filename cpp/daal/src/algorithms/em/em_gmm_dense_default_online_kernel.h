@@ -0,0 +1,79 @@
+/* file: em_gmm_dense_default_online_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that calculate online em.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_ONLINE_KERNEL_H__
+#define __EM_GMM_DENSE_DEFAULT_ONLINE_KERNEL_H__
+
+#include "algorithms/em/em_gmm_online.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/em/em_gmm_dense_default_batch_kernel.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+/**
+ * Stepwise EM: the expectation step of the batch algorithm is run on the block of data with the model
+ * computed from the running sufficient statistics, then the statistics of the block are blended into the running ones
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class EMOnlineKernel : public Kernel
+{
+public:
+    EMOnlineKernel() {};
+
+    services::Status compute(NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans, NumericTable ** initialCovariances,
+                             NumericTable & sumOfResponsibilities, NumericTable & sumOfWeightedData, NumericTable & sumOfWeightedCrossProducts,
+                             NumericTable & partialGoalFunction, NumericTable & nProcessedBlocks, const OnlineParameter & par);
+
+    services::Status finalizeCompute(NumericTable & sumOfResponsibilities, NumericTable & sumOfWeightedData,
+                                     NumericTable & sumOfWeightedCrossProducts, NumericTable & partialGoalFunction, NumericTable & nProcessedBlocks,
+                                     NumericTable & resultWeights, NumericTable & resultMeans, NumericTable ** resultCovariances,
+                                     NumericTable & resultNIterations, NumericTable & resultGoalFunction, const OnlineParameter & par);
+
+protected:
+    static services::Status setStatistics(NumericTable & weights, NumericTable & means, NumericTable ** covariances, algorithmFPType gamma,
+                                          algorithmFPType * s0, algorithmFPType * s1, algorithmFPType * s2, const size_t nComponents,
+                                          const size_t nFeatures, const CovarianceStorageId covType);
+
+    static services::Status computeModel(const algorithmFPType * s0, const algorithmFPType * s1, const algorithmFPType * s2, NumericTable & weights,
+                                         NumericTable & means, NumericTable ** covariances, const size_t nComponents, const size_t nFeatures,
+                                         const CovarianceStorageId covType);
+};
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
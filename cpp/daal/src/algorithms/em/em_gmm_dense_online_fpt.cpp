@@ -0,0 +1,57 @@
+/* file: em_gmm_dense_online_fpt.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of EM Online constructor
+//--
+*/
+
+#include "algorithms/em/em_gmm_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+template <typename algorithmFPType, Method method>
+Online<algorithmFPType, method>::Online(const size_t nComponents)
+    : parameter(nComponents, services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >(
+                                 new covariance::Batch<algorithmFPType, covariance::defaultDense>()))
+{
+    initialize();
+}
+
+template <typename algorithmFPType, Method method>
+void Online<algorithmFPType, method>::initialize()
+{
+    Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+    _in                   = &input;
+    _par                  = &parameter;
+    _result               = ResultPtr(new Result());
+    _partialResult        = PartialResultPtr(new PartialResult());
+}
+
+template class Online<DAAL_FPTYPE, defaultDense>;
+
+} // namespace interface1
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
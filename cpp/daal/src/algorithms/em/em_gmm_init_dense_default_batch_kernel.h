@@ -59,7 +59,7 @@ public:
         : covType(_covType), nComponents(_nComponents), nFeatures(_nFeatures), sigma(new DataCollection())
     {
         nRows = nFeatures;
-        if (covType == em_gmm::diagonal)
+        if (covType != em_gmm::full)
         {
             nRows = 1;
         }
@@ -82,6 +82,19 @@ public:
                     sigmaArray[i] = varianceArray[i];
                 }
             }
+            else if (covType == em_gmm::spherical)
+            {
+                algorithmFPType meanVariance = 0.0;
+                for (size_t i = 0; i < nFeatures; i++)
+                {
+                    meanVariance += varianceArray[i];
+                }
+                meanVariance /= nFeatures;
+                for (size_t i = 0; i < nFeatures; i++)
+                {
+                    sigmaArray[i] = meanVariance;
+                }
+            }
             else
             {
                 for (size_t i = 0; i < nFeatures * nFeatures; i++)
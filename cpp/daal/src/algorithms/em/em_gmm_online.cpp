@@ -0,0 +1,132 @@
+/* file: em_gmm_online.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM algorithm interface in the online processing mode.
+//--
+*/
+
+#include "algorithms/em/em_gmm_types.h"
+#include "services/daal_defines.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID);
+
+OnlineParameter::OnlineParameter(const size_t _nComponents, const SharedPtr<covariance::BatchImpl> & _covariance, const double _stepSizeOffset,
+                                 const double _stepSizeDecay, const double _regularizationFactor, const CovarianceStorageId _covarianceStorage)
+    : Parameter(_nComponents, _covariance, 1, 0.0, _regularizationFactor, _covarianceStorage),
+      stepSizeOffset(_stepSizeOffset),
+      stepSizeDecay(_stepSizeDecay)
+{}
+
+OnlineParameter::OnlineParameter(const OnlineParameter & other)
+    : Parameter(other), stepSizeOffset(other.stepSizeOffset), stepSizeDecay(other.stepSizeDecay)
+{}
+
+services::Status OnlineParameter::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, Parameter::check());
+    DAAL_CHECK_EX(stepSizeOffset >= 0, ErrorIncorrectParameter, ParameterName, stepSizeOffsetStr());
+    DAAL_CHECK_EX(stepSizeDecay > 0.5 && stepSizeDecay <= 1.0, ErrorIncorrectParameter, ParameterName, stepSizeDecayStr());
+    return s;
+}
+
+/** Default constructor */
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the partial result of the EM for GMM algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the EM for GMM algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the numeric table with the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the partial result of the EM for GMM algorithm
+ * \param[in] input   %Input of the algorithm
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    const Input * algInput         = static_cast<const Input *>(input);
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    return checkImpl(algParameter->nComponents, algInput->get(data)->getNumberOfColumns(), algParameter);
+}
+
+/**
+ * Checks the partial result of the EM for GMM algorithm
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Parameter * par, int method) const
+{
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    NumericTablePtr weightedData   = get(sumOfWeightedData);
+    DAAL_CHECK_EX(weightedData, ErrorNullPartialResult, ArgumentName, sumOfWeightedDataStr());
+    return checkImpl(algParameter->nComponents, weightedData->getNumberOfColumns(), algParameter);
+}
+
+services::Status PartialResult::checkImpl(size_t nComponents, size_t nFeatures, const Parameter * par) const
+{
+    const size_t covSize  = (par->covarianceStorage == full) ? nFeatures * nFeatures : nFeatures;
+    int unexpectedLayouts = packed_mask;
+
+    services::Status s;
+    s |= checkNumericTable(get(sumOfResponsibilities).get(), sumOfResponsibilitiesStr(), unexpectedLayouts, 0, nComponents, 1);
+    if (!s) return s;
+    s |= checkNumericTable(get(sumOfWeightedData).get(), sumOfWeightedDataStr(), unexpectedLayouts, 0, nFeatures, nComponents);
+    if (!s) return s;
+    s |= checkNumericTable(get(sumOfWeightedCrossProducts).get(), sumOfWeightedCrossProductsStr(), unexpectedLayouts, 0, covSize, nComponents);
+    if (!s) return s;
+    s |= checkNumericTable(get(partialGoalFunction).get(), partialGoalFunctionStr(), unexpectedLayouts, 0, 1, 1);
+    if (!s) return s;
+    s |= checkNumericTable(get(nProcessedBlocks).get(), nProcessedBlocksStr(), unexpectedLayouts, 0, 1, 1);
+    return s;
+}
+
+} // namespace interface1
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,88 @@
+/* file: em_gmm_online.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM interface in the online processing mode.
+//--
+*/
+
+#ifndef __EM_ONLINE_
+#define __EM_ONLINE_
+
+#include "algorithms/em/em_gmm_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+/**
+ * Allocates memory for storing partial results of the EM for GMM algorithm
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    Input * algInput               = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+
+    const size_t nFeatures   = algInput->get(data)->getNumberOfColumns();
+    const size_t nComponents = algParameter->nComponents;
+    const size_t covSize     = (algParameter->covarianceStorage == full) ? nFeatures * nFeatures : nFeatures;
+
+    services::Status status;
+
+    set(sumOfResponsibilities, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, 0, &status));
+    set(sumOfWeightedData, HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, NumericTable::doAllocate, 0, &status));
+    set(sumOfWeightedCrossProducts, HomogenNumericTable<algorithmFPType>::create(covSize, nComponents, NumericTable::doAllocate, 0, &status));
+    set(partialGoalFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, 0, &status));
+    set(nProcessedBlocks, HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, 0, &status));
+    return status;
+}
+
+/**
+ * Initializes partial results of the EM for GMM algorithm. The statistics are set from the input
+ * parameters of the model on the first block of data, hence zero number of processed blocks marks them as empty
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(sumOfResponsibilities)->assign((algorithmFPType)0.0))
+    DAAL_CHECK_STATUS(s, get(sumOfWeightedData)->assign((algorithmFPType)0.0))
+    DAAL_CHECK_STATUS(s, get(sumOfWeightedCrossProducts)->assign((algorithmFPType)0.0))
+    DAAL_CHECK_STATUS(s, get(partialGoalFunction)->assign((algorithmFPType)0.0))
+    DAAL_CHECK_STATUS(s, get(nProcessedBlocks)->assign((int)0))
+    return s;
+}
+
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -28,6 +28,7 @@
 #include "src/externals/service_memory.h"
 #include "src/data_management/service_numeric_table.h"
 #include "src/services/service_defines.h"
+#include "src/services/service_algo_utils.h"
 
 #include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
 #include "src/algorithms/kmeans/kmeans_lloyd_postprocessing.h"
@@ -48,7 +49,8 @@ namespace kmeans
 namespace internal
 {
 template <Method method, typename algorithmFPType, CpuType cpu>
-Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par)
+Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(services::HostAppIface * pHost, const NumericTable * const * a,
+                                                                const NumericTable * const * r, const Parameter * par)
 {
     Status s;
     NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
@@ -224,6 +226,13 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
             }
         }
         inClusters = clusters;
+
+        /* Stop at the iteration boundary on the host application request; the centroids computed so far are returned */
+        if (services::internal::isCancelled(s, pHost, kIter + 1, oldTargetFunc))
+        {
+            kIter++;
+            break;
+        }
     }
 
     if (!nIter)
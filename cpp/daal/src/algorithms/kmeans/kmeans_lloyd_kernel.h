@@ -28,6 +28,7 @@
 #include "src/algorithms/kernel.h"
 #include "data_management/data/numeric_table.h"
 #include "services/daal_defines.h"
+#include "services/host_app.h"
 
 namespace daal
 {
@@ -43,7 +44,7 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 class KMeansBatchKernel : public Kernel
 {
 public:
-    services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
+    services::Status compute(services::HostAppIface * pHost, const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -126,6 +126,31 @@ struct tls_moments_data_t
     algorithmFPType * max;
 #endif
 
+    /* Size of the arrays of one partial result in bytes */
+    static size_t arraysSize(const size_t nFeatures)
+    {
+        size_t nArrays = 0;
+#ifdef _MEAN_ENABLE_
+        nArrays++;
+#endif
+#ifdef _SUM_ENABLE_
+        nArrays++;
+#endif
+#ifdef _SUM2_ENABLE_
+        nArrays++;
+#endif
+#if defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+        nArrays++;
+#endif
+#ifdef _MIN_ENABLE_
+        nArrays++;
+#endif
+#ifdef _MAX_ENABLE_
+        nArrays++;
+#endif
+        return nArrays * nFeatures * sizeof(algorithmFPType);
+    }
+
     tls_moments_data_t(size_t nFeatures)
     {
         malloc_errors = 0;
@@ -187,6 +212,48 @@ struct tls_moments_data_t
 #endif /* #if (defined _MIN_ENABLE_ || defined _MAX_ENABLE_) */
     }
 
+    /* Merges the partial result computed on the next rows of the data set */
+    void merge(const tls_moments_data_t & other, size_t nFeatures)
+    {
+        if (malloc_errors || other.malloc_errors)
+        {
+            malloc_errors += other.malloc_errors;
+            return;
+        }
+
+        const algorithmFPType n1_p_n2 = nvectors + other.nvectors;
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+        const algorithmFPType delta_scale = nvectors * other.nvectors / n1_p_n2;
+        const algorithmFPType mean_scale  = algorithmFPType(1.0) / n1_p_n2;
+#endif
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+            const algorithmFPType delta = other.mean[j] - mean[j];
+            mean[j]                     = (mean[j] * nvectors + other.mean[j] * other.nvectors) * mean_scale; /* merging means */
+#endif
+#if defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+            varc[j] += other.varc[j] + delta * delta * delta_scale; /* merging centered sums of squares */
+#endif
+#ifdef _SUM_ENABLE_
+            sum[j] += other.sum[j]; /* merging sums */
+#endif
+#ifdef _SUM2_ENABLE_
+            sum2[j] += other.sum2[j]; /* merging sum2 */
+#endif
+#ifdef _MIN_ENABLE_
+            if (other.min[j] < min[j]) min[j] = other.min[j]; /* merging min */
+#endif
+#ifdef _MAX_ENABLE_
+            if (other.max[j] > max[j]) max[j] = other.max[j]; /* merging max */
+#endif
+        }
+        nvectors = n1_p_n2;
+    }
+
     ~tls_moments_data_t()
     {
 #ifdef _MEAN_ENABLE_
@@ -241,22 +308,31 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
     common_moments_data_t<algorithmFPType, cpu> _cd(dataTable, result);
     if (_cd.malloc_errors) return Status(daal::services::ErrorMemoryAllocationFailed);
 
-    /* Rows and features splitting by blocks */
-    const size_t blockSize          = getDefaultBatchModeBlockSize<cpu>(_cd.nVectors);
-    const size_t numRowsInBlock     = (_cd.nVectors > blockSize) ? blockSize : _cd.nVectors;
+    /* Rows splitting by blocks of the size that does not depend on the number of threads */
+    const size_t numRowsInBlock     = (_cd.nVectors > reproducibleBlockSize) ? reproducibleBlockSize : _cd.nVectors;
     const size_t numRowsBlocks      = _cd.nVectors / numRowsInBlock;
     const size_t numRowsInLastBlock = numRowsInBlock + (_cd.nVectors - numRowsBlocks * numRowsInBlock);
 
     DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.compute);
-    /* TLS buffers initialization */
-    daal::tls<tls_moments_data_t<algorithmFPType, cpu> *> tls_data([&]() { return new tls_moments_data_t<algorithmFPType, cpu>(_cd.nFeatures); });
 
     SafeStatus safeStat;
+    tls_moments_data_t<algorithmFPType, cpu> * _tdReduced = nullptr;
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.ProcessBlocks);
-        /* Compute partial results for each TLS buffer */
-        daal::threader_for(numRowsBlocks, numRowsBlocks, [&](int iBlock) {
-            struct tls_moments_data_t<algorithmFPType, cpu> * _td = tls_data.local();
+        /* Compute partial results for the chunks of blocks and merge them in the fixed order to get reproducible estimates */
+        auto createPartial = [&]() {
+            tls_moments_data_t<algorithmFPType, cpu> * _td = new tls_moments_data_t<algorithmFPType, cpu>(_cd.nFeatures);
+            if (!_td)
+            {
+                safeStat.add(daal::services::ErrorMemoryAllocationFailed);
+            }
+            return _td;
+        };
+        auto mergePartials = [&](tls_moments_data_t<algorithmFPType, cpu> * _tdDst, tls_moments_data_t<algorithmFPType, cpu> * _tdSrc) {
+            _tdDst->merge(*_tdSrc, _cd.nFeatures);
+            delete _tdSrc;
+        };
+        auto processBlock = [&](tls_moments_data_t<algorithmFPType, cpu> * _td, size_t iBlock) {
             if (_td->malloc_errors)
             {
                 return;
@@ -314,8 +390,14 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
                 }
                 _td->nvectors++;
             }
-        });
+        };
+
+        /* The number of partial results is limited for the data sets with many features */
+        const size_t maxChunks = daal::threader_reduce_deterministic_max_chunks(tls_moments_data_t<algorithmFPType, cpu>::arraysSize(_cd.nFeatures));
+        _tdReduced = daal::threader_reduce_deterministic<tls_moments_data_t<algorithmFPType, cpu> *>(numRowsBlocks, createPartial, processBlock,
+                                                                                                      mergePartials, maxChunks);
     } /* end for  DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.ProcessBlocks); */
+    if (!_tdReduced) return Status(daal::services::ErrorMemoryAllocationFailed);
 
     /* Number of already merged values */
     algorithmFPType n_current = 0;
@@ -336,8 +418,8 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
 
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.MergeBlocks);
-        /* Merge results by TLS buffers */
-        tls_data.reduce([&](tls_moments_data_t<algorithmFPType, cpu> * _td) {
+        /* Merge the reduced partial result into the result */
+        auto mergeToResult = [&](tls_moments_data_t<algorithmFPType, cpu> * _td) {
             if (_td->malloc_errors)
             {
                 bMemoryAllocationFailed = true;
@@ -445,7 +527,8 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
             n_current += _td->nvectors;
 
             delete _td;
-        });
+        };
+        mergeToResult(_tdReduced);
 
         if (bMemoryAllocationFailed) return Status(daal::services::ErrorMemoryAllocationFailed);
 
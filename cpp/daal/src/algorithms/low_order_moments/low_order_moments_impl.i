@@ -45,15 +45,9 @@ namespace low_order_moments
 {
 namespace internal
 {
-template <CpuType cpu>
-inline size_t getDefaultBatchModeBlockSize(size_t numberOfRows)
-{
-    const static size_t MAX_BLOCK_SIZE = 512;
-    const static size_t MIN_BLOCK_SIZE = 256;
-
-    const size_t numberOfThreads = threader_get_threads_number();
-    return (numberOfRows / MAX_BLOCK_SIZE) < numberOfThreads ? MIN_BLOCK_SIZE : MAX_BLOCK_SIZE;
-}
+/* Number of rows in the blocks whose partial results are merged in the fixed order.
+   It does not depend on the number of threads, so the estimates are bitwise reproducible */
+const size_t reproducibleBlockSize = 256;
 
 /* Multiple instances for defaultDense method optimized implementations */
 /* for different estimates sets: all, minmax, meanvariance */
@@ -452,9 +446,8 @@ Status computeMinMaxAndSumOfSquared(const size_t nFeatures, const size_t nVector
         DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
     }
 
-    /* Split rows by blocks */
-    const size_t blockSize          = getDefaultBatchModeBlockSize<cpu>(nVectors);
-    const size_t numRowsInBlock     = (nVectors > blockSize) ? blockSize : nVectors;
+    /* Split rows by blocks of the size that does not depend on the number of threads */
+    const size_t numRowsInBlock     = (nVectors > reproducibleBlockSize) ? reproducibleBlockSize : nVectors;
     const size_t nBlocks            = nVectors / numRowsInBlock;
     const size_t numRowsInLastBlock = numRowsInBlock + (nVectors - nBlocks * numRowsInBlock);
 
@@ -501,28 +494,22 @@ Status computeMinMaxAndSumOfSquared(const size_t nFeatures, const size_t nVector
         TArrayScalable<algorithmFPType, cpu> _array;
     };
 
-    /* TLS data initialization */
+    /* Partial results for the chunks of blocks are merged in the fixed order to get reproducible sums of squares */
     SafeStatus safeStat;
-    daal::tls<TslData *> tslData([nFeatures, &safeStat]() {
+    auto createPartial = [nFeatures, &safeStat]() {
         auto tlsData = TslData::create(nFeatures);
         if (!tlsData)
         {
             safeStat.add(services::ErrorMemoryAllocationFailed);
         }
         return tlsData;
-    });
-
-    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
-        struct TslData * localTslData = tslData.local();
-        if (!localTslData)
-        {
-            return;
-        }
+    };
 
+    auto processBlock = [&](TslData * localTslData, size_t iBlock) {
         const size_t startRows = iBlock * numRowsInBlock;
         const size_t chunkRows = (iBlock < (nBlocks - 1)) ? numRowsInBlock : numRowsInLastBlock;
 
-        for (size_t i = startRows; i < chunkRows; i++)
+        for (size_t i = startRows; i < startRows + chunkRows; i++)
         {
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
@@ -535,27 +522,54 @@ Status computeMinMaxAndSumOfSquared(const size_t nFeatures, const size_t nVector
                 localTslData->sumSq[j] += value * value;
             }
         }
-    });
+    };
 
-    tslData.reduce([&](TslData * localTslData) {
+    auto mergePartials = [&](TslData * dstTslData, TslData * srcTslData) {
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t j = 0; j < nFeatures; j++)
         {
-            if (localTslData->min[j] < min[j])
+            if (srcTslData->min[j] < dstTslData->min[j])
             {
-                min[j] = localTslData->min[j];
+                dstTslData->min[j] = srcTslData->min[j];
             }
 
-            if (localTslData->max[j] > max[j])
+            if (srcTslData->max[j] > dstTslData->max[j])
             {
-                max[j] = localTslData->max[j];
+                dstTslData->max[j] = srcTslData->max[j];
             }
-            sumSq[j] += localTslData->sumSq[j];
+            dstTslData->sumSq[j] += srcTslData->sumSq[j];
+        }
+
+        delete srcTslData;
+    };
+
+    /* The number of partial results is limited for the data sets with many features */
+    const size_t maxChunks   = daal::threader_reduce_deterministic_max_chunks(3 * nFeatures * sizeof(algorithmFPType));
+    TslData * reducedTslData = daal::threader_reduce_deterministic<TslData *>(nBlocks, createPartial, processBlock, mergePartials, maxChunks);
+    if (!safeStat || !reducedTslData)
+    {
+        delete reducedTslData;
+        return Status(services::ErrorMemoryAllocationFailed);
+    }
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if (reducedTslData->min[j] < min[j])
+        {
+            min[j] = reducedTslData->min[j];
+        }
+
+        if (reducedTslData->max[j] > max[j])
+        {
+            max[j] = reducedTslData->max[j];
         }
+        sumSq[j] += reducedTslData->sumSq[j];
+    }
 
-        delete localTslData;
-    });
+    delete reducedTslData;
     return Status();
 }
 
@@ -171,6 +171,7 @@ private:
 
 public:
     bool continueLineSearch;
+    algorithmFPType objectiveValue;                 /*!< Objective function value or squared gradient norm reported to the host app */
     IndicesStatus batchIndicesStatus;               /*!< Status of the objective function indices for gradient computation */
     IndicesStatus correctionPairBatchIndicesStatus; /*!< Status of the objective function indices for Hessian computation */
     int * batchIndices;                             /*!< Array that contains the batch indices */
@@ -152,6 +152,11 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
                 s |= task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration, epoch, correctionIndex);
                 return s;
             }
+            if (services::internal::isCancelled(s, pHost, curIteration + 1, task.objectiveValue))
+            {
+                s |= task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration + 1, epoch, correctionIndex);
+                return s;
+            }
         }
 
         for (size_t j = 0; j < task.argumentSize; j++)
@@ -212,6 +217,11 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(
             s |= task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration, epoch, correctionIndex);
             return s;
         }
+        if (services::internal::isCancelled(s, pHost, curIteration + 1, task.objectiveValue))
+        {
+            s |= task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration + 1, epoch, correctionIndex);
+            return s;
+        }
     }
     return task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration, epoch - 1, correctionIndex);
 }
@@ -382,8 +392,20 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument(size_t iIteration, size_t
                                                           this->argumentSize * sizeof(algorithmFPType));
         DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
     }
+    const algorithmFPType gradientNorm2 = dotProduct<algorithmFPType, cpu>(this->argumentSize, gradient, gradient);
+    if (useWolfeConditions)
+    {
+        ReadRows<algorithmFPType, cpu> mtValue(*ntValue, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtValue);
+        objectiveValue = mtValue.get()[0];
+    }
+    else
+    {
+        objectiveValue = gradientNorm2;
+    }
+
     /* Check accuracy */
-    if (dotProduct<algorithmFPType, cpu>(this->argumentSize, gradient, gradient)
+    if (gradientNorm2
         < accuracyThreshold
               * daal::internal::Math<algorithmFPType, cpu>::sMax(one, dotProduct<algorithmFPType, cpu>(this->argumentSize, argument, argument)))
     {
@@ -652,7 +674,8 @@ LBFGSTask<algorithmFPType, cpu>::LBFGSTask(const Parameter * parameter, NumericT
       correctionPairBatchIndices(nullptr),
       correctionPairBatchIndicesStatus(all),
       nStepLength(parameter->stepLengthSequence->getNumberOfColumns()),
-      _rng()
+      _rng(),
+      objectiveValue(0)
 {}
 
 /**
@@ -0,0 +1,50 @@
+/* file: saga_dense_hogwild_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of saga calculation.
+//--
+
+#include "src/algorithms/optimization_solver/saga/saga_batch_container.h"
+#include "src/algorithms/optimization_solver/saga/saga_dense_hogwild_kernel.h"
+#include "src/algorithms/optimization_solver/saga/saga_dense_hogwild_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace saga
+{
+namespace interface2
+{
+template class BatchContainer<DAAL_FPTYPE, hogwild, DAAL_CPU>;
+}
+
+namespace internal
+{
+template class SagaKernel<DAAL_FPTYPE, hogwild, DAAL_CPU>;
+}
+
+} // namespace saga
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,366 @@
+/* file: saga_dense_hogwild_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of asynchronous saga algorithm
+//
+// Remi Leblond, Fabian Pedregosa, Simon Lacoste-Julien
+// ASAGA: Asynchronous Parallel SAGA
+//--
+*/
+
+#ifndef __SAGA_DENSE_HOGWILD_IMPL_I__
+#define __SAGA_DENSE_HOGWILD_IMPL_I__
+
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_utils.h"
+#include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
+#include "src/threading/threading.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+#include "algorithms/optimization_solver/saga/saga_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace saga
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
+
+/* Number of updates that every thread applies between two convergence checks */
+const size_t hogwildUpdatesPerThread = 64;
+
+template <typename algorithmFPType, CpuType cpu>
+SagaHogwildThreadTask<algorithmFPType, cpu> * SagaHogwildThreadTask<algorithmFPType, cpu>::create(const sum_of_functions::BatchPtr & function,
+                                                                                                size_t argumentSize)
+{
+    SagaHogwildThreadTask<algorithmFPType, cpu> * task = new SagaHogwildThreadTask<algorithmFPType, cpu>();
+    if (!task) return nullptr;
+
+    task->snapshot.reset(argumentSize);
+    task->point.reset(argumentSize);
+    task->batchIndex.reset(1);
+    task->summDelta.reset(argumentSize);
+    task->function           = function->clone();
+    task->proximalProjection = function->clone();
+    if (!task->snapshot.get() || !task->point.get() || !task->batchIndex.get() || !task->summDelta.get() || !task->function.get()
+        || !task->proximalProjection.get())
+    {
+        delete task;
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < argumentSize; i++) task->summDelta[i] = 0;
+
+    Status s;
+    NumericTablePtr argumentTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(task->point.get(), 1, argumentSize, &s);
+    NumericTablePtr batchIndices  = HomogenNumericTableCPU<int, cpu>::create(task->batchIndex.get(), 1, 1, &s);
+    if (!s)
+    {
+        delete task;
+        return nullptr;
+    }
+
+    task->function->sumOfFunctionsInput->set(sum_of_functions::argument, argumentTable);
+    task->function->sumOfFunctionsParameter->batchIndices     = batchIndices;
+    task->function->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::gradient;
+    task->function->enableChecks(false);
+
+    task->proximalProjection->sumOfFunctionsInput->set(sum_of_functions::argument, argumentTable);
+    task->proximalProjection->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::proximalProjection;
+    task->proximalProjection->enableChecks(false);
+    return task;
+}
+
+/**
+ *  \brief Kernel for asynchronous Saga calculation.
+ *  Every thread reads a snapshot of the shared argument, computes the Saga step and the proximal projection
+ *  in the snapshot and adds the resulting difference to the shared argument without locks.
+ *  The terms of a round are split between threads by the term index, so every row of the table of saved gradients
+ *  is written by one thread only. Every thread accumulates the changes of the sum of gradients it makes, and the changes
+ *  are added to the shared sum after the round: the sum equals the sum of the saved gradients at the end of every round,
+ *  and within the round every thread sees the shared sum from the beginning of the round plus its own changes.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SagaKernel<algorithmFPType, hogwild, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                    NumericTable * nIterations, NumericTable * gradientsTableInput,
+                                                                    NumericTable * gradientsTableResult, Parameter * parameter,
+                                                                    engines::BatchBase & engine)
+{
+    services::Status s;
+    const size_t sizeArgument = inputArgument->getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> workValueBD(*minimum, 0, sizeArgument);
+    DAAL_CHECK_BLOCK_STATUS(workValueBD);
+    algorithmFPType * workValue = workValueBD.get();
+
+    ReadRows<algorithmFPType, cpu> initialPointBD(*inputArgument, 0, sizeArgument);
+    DAAL_CHECK_BLOCK_STATUS(initialPointBD);
+    int result = daal::services::internal::daal_memcpy_s(workValue, sizeArgument * sizeof(algorithmFPType), initialPointBD.get(),
+                                                         sizeArgument * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    WriteRows<int, cpu> nIterationsPerformed(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsPerformed);
+    *nIterationsPerformed.get() = 0;
+
+    const size_t maxIterations      = parameter->nIterations;
+    const algorithmFPType tolerance = parameter->accuracyThreshold;
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t n                      = function->sumOfFunctionsParameter->numberOfTerms;
+    const algorithmFPType inverse_n     = algorithmFPType(1) / algorithmFPType(n);
+
+    NumericTablePtr ntlearningRate = parameter->learningRateSequence;
+    ReadRows<algorithmFPType, cpu> learningRateBD;
+    algorithmFPType autoStep = 0;
+    if (ntlearningRate)
+    {
+        learningRateBD.set(*ntlearningRate, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(learningRateBD);
+    }
+    else
+    {
+        NumericTablePtr argumentTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(workValue, 1, sizeArgument, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        sum_of_functions::BatchPtr getAutoStep = function->clone();
+        getAutoStep->sumOfFunctionsInput->set(sum_of_functions::argument, argumentTable);
+        getAutoStep->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::lipschitzConstant;
+        getAutoStep->sumOfFunctionsParameter->batchIndices     = HomogenNumericTableCPU<int, cpu>::create(nullptr, n, 1);
+        DAAL_CHECK_STATUS(s, getAutoStep->computeNoThrow());
+        NumericTablePtr lipschitzPtr = getAutoStep->getResult()->get(optimization_solver::objective_function::lipschitzConstantIdx);
+        if (lipschitzPtr)
+        {
+            ReadRows<algorithmFPType, cpu> lipschitz(*lipschitzPtr, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(lipschitz);
+            autoStep = algorithmFPType(1) / (*lipschitz.get());
+        }
+        else
+        {
+            autoStep = 0.0001; //default value
+        }
+    }
+    const algorithmFPType * learningRateArray = ntlearningRate ? learningRateBD.get() : nullptr;
+    const size_t learningRateLength           = ntlearningRate ? ntlearningRate->getNumberOfColumns() : 0;
+
+    algorithmFPType * savedGradients = nullptr;
+    TArray<algorithmFPType, cpu> savedGradientsPtr;
+    WriteRows<algorithmFPType, cpu> gradientsTableBD;
+    if (gradientsTableResult || gradientsTableInput)
+    {
+        gradientsTableBD.set(*(gradientsTableResult ? gradientsTableResult : gradientsTableInput), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(gradientsTableBD);
+        savedGradients = gradientsTableBD.get();
+    }
+    else
+    {
+        savedGradients = savedGradientsPtr.reset(n * sizeArgument);
+        DAAL_CHECK_MALLOC(savedGradients);
+    }
+
+    const size_t nThreads  = parameter->deterministic ? 1 : threader_get_threads_number();
+    const size_t roundSize = nThreads * hogwildUpdatesPerThread;
+
+    TArray<algorithmFPType, cpu> summGradsPtr(sizeArgument);
+    TArray<algorithmFPType, cpu> previousPtr(sizeArgument);
+    algorithmFPType * summGrads = summGradsPtr.get();
+    algorithmFPType * previous  = previousPtr.get();
+    DAAL_CHECK_MALLOC(summGrads && previous);
+
+    NumericTablePtr batchIndicesNT = parameter->batchIndices;
+    ReadRows<int, cpu> batchIndicesBD;
+    if (batchIndicesNT)
+    {
+        batchIndicesBD.set(*batchIndicesNT, 0, batchIndicesNT->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(batchIndicesBD);
+    }
+    RngTask<int, cpu> rngTask(nullptr, roundSize);
+    DAAL_CHECK_MALLOC(batchIndicesNT || rngTask.init(n, engine));
+
+    /* Thread tasks are released at the end of the kernel, there is no early return below */
+    daal::tls<SagaHogwildThreadTask<algorithmFPType, cpu> *> tlsTask([=]() -> SagaHogwildThreadTask<algorithmFPType, cpu> * {
+        return SagaHogwildThreadTask<algorithmFPType, cpu>::create(function, sizeArgument);
+    });
+
+    SafeStatus safeStat;
+    /* compute table of gradients in the start point if gradientsTableInput is absent */
+    if (!gradientsTableInput)
+    {
+        const size_t blockSize = 256;
+        const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            SagaHogwildThreadTask<algorithmFPType, cpu> * local = tlsTask.local();
+            DAAL_CHECK_MALLOC_THR(local);
+            int result = daal::services::internal::daal_memcpy_s(local->point.get(), sizeArgument * sizeof(algorithmFPType), workValue,
+                                                                 sizeArgument * sizeof(algorithmFPType));
+            DAAL_CHECK_THR(!result, services::ErrorMemoryCopyFailedInternal);
+
+            const size_t iEnd = daal::services::internal::min<cpu, size_t>(n, (iBlock + 1) * blockSize);
+            for (size_t k = iBlock * blockSize; k < iEnd; k++)
+            {
+                local->batchIndex[0] = k;
+                DAAL_CHECK_STATUS_THR(local->function->computeNoThrow());
+                NumericTable * gradientNT = local->function->getResult()->get(optimization_solver::objective_function::gradientIdx).get();
+                ReadRows<algorithmFPType, cpu> gradientBD(*gradientNT, 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+                result = daal::services::internal::daal_memcpy_s(savedGradients + k * sizeArgument, sizeArgument * sizeof(algorithmFPType),
+                                                                 gradientBD.get(), sizeArgument * sizeof(algorithmFPType));
+                DAAL_CHECK_THR(!result, services::ErrorMemoryCopyFailedInternal);
+            }
+        });
+        s |= safeStat.detach();
+    }
+
+    /* compute sum of gradients */
+    for (size_t i = 0; i < sizeArgument; i++) summGrads[i] = 0;
+    for (size_t k = 0; k < n; k++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < sizeArgument; i++)
+        {
+            summGrads[i] += savedGradients[k * sizeArgument + i];
+        }
+    }
+
+    services::internal::HostAppHelper host(pHost, 10);
+    size_t iterationsPerformed = 0;
+    while (s.ok() && !host.isCancelled(s, 1) && iterationsPerformed < maxIterations)
+    {
+        const size_t nUpdates = daal::services::internal::min<cpu, size_t>(roundSize, maxIterations - iterationsPerformed);
+        const int * indices   = nullptr;
+        if (batchIndicesNT)
+        {
+            indices = batchIndicesBD.get() + iterationsPerformed;
+        }
+        else
+        {
+            s = rngTask.getWithReplacement(indices);
+            DAAL_CHECK_BREAK(!s);
+        }
+
+        result |= daal::services::internal::daal_memcpy_s(previous, sizeArgument * sizeof(algorithmFPType), workValue,
+                                                          sizeArgument * sizeof(algorithmFPType));
+
+        const size_t nBlocks        = daal::services::internal::min<cpu, size_t>(nThreads, nUpdates);
+        const size_t firstIteration = iterationsPerformed;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            SagaHogwildThreadTask<algorithmFPType, cpu> * local = tlsTask.local();
+            DAAL_CHECK_MALLOC_THR(local);
+            algorithmFPType * snapshot  = local->snapshot.get();
+            algorithmFPType * point     = local->point.get();
+            algorithmFPType * summDelta = local->summDelta.get();
+
+            for (size_t i = 0; i < nUpdates; i++)
+            {
+                const size_t term = indices[i];
+                if (term % nBlocks != iBlock) continue;
+
+                const size_t displacement = term * sizeArgument;
+                const algorithmFPType stepLength =
+                    learningRateLength ? learningRateArray[(firstIteration + i) % learningRateLength] : autoStep;
+                const algorithmFPType inverseStepLength = algorithmFPType(1) / stepLength;
+
+                /* inconsistent read of the shared argument */
+                for (size_t k = 0; k < sizeArgument; k++)
+                {
+                    snapshot[k] = workValue[k];
+                    point[k]    = snapshot[k];
+                }
+
+                local->batchIndex[0] = term;
+                DAAL_CHECK_STATUS_THR(local->function->computeNoThrow());
+                NumericTable * gradientNT = local->function->getResult()->get(optimization_solver::objective_function::gradientIdx).get();
+                ReadRows<algorithmFPType, cpu> gradientBD(*gradientNT, 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+                const algorithmFPType * gradient = gradientBD.get();
+
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < sizeArgument; k++)
+                {
+                    const algorithmFPType delta = gradient[k] - savedGradients[displacement + k];
+                    summDelta[k] += delta;
+                    point[k] = (snapshot[k] - stepLength * (delta + (summGrads[k] + summDelta[k]) * inverse_n)) * inverseStepLength;
+                    savedGradients[displacement + k] = gradient[k];
+                }
+
+                DAAL_CHECK_STATUS_THR(local->proximalProjection->computeNoThrow());
+                NumericTable * proxNT =
+                    local->proximalProjection->getResult()->get(optimization_solver::objective_function::proximalProjectionIdx).get();
+                ReadRows<algorithmFPType, cpu> proxBD(*proxNT, 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(proxBD);
+                const algorithmFPType * prox = proxBD.get();
+
+                /* lock-free update of the shared argument */
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < sizeArgument; k++)
+                {
+                    workValue[k] += stepLength * prox[k] - snapshot[k];
+                }
+            }
+        });
+        s |= safeStat.detach();
+
+        tlsTask.reduce([&](SagaHogwildThreadTask<algorithmFPType, cpu> * local) -> void {
+            if (!local) return;
+            algorithmFPType * summDelta = local->summDelta.get();
+            for (size_t k = 0; k < sizeArgument; k++)
+            {
+                summGrads[k] += summDelta[k];
+                summDelta[k] = 0;
+            }
+        });
+        DAAL_CHECK_BREAK(!s);
+        iterationsPerformed += nUpdates;
+
+        bool continueCheck = false;
+        for (size_t k = 0; k < sizeArgument; k++)
+        {
+            continueCheck |=
+                (daal::internal::Math<algorithmFPType, cpu>::sFabs(previous[k] - workValue[k])
+                 >= tolerance * daal::internal::Math<algorithmFPType, cpu>::sMax(1, daal::internal::Math<algorithmFPType, cpu>::sFabs(workValue[k])));
+        }
+        DAAL_CHECK_BREAK(!continueCheck);
+    }
+
+    tlsTask.reduce([](SagaHogwildThreadTask<algorithmFPType, cpu> * local) -> void { delete local; });
+
+    *nIterationsPerformed.get() = iterationsPerformed;
+    return (!result) ? s : Status(ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace internal
+
+} // namespace saga
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
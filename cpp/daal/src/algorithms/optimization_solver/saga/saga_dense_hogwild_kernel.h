@@ -0,0 +1,75 @@
+/* file: saga_dense_hogwild_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculate asynchronous saga.
+//--
+
+#ifndef __SAGA_DENSE_HOGWILD_KERNEL_H__
+#define __SAGA_DENSE_HOGWILD_KERNEL_H__
+
+#include "src/algorithms/optimization_solver/saga/saga_dense_default_kernel.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace saga
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class SagaKernel<algorithmFPType, hogwild, cpu> : public Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
+                             NumericTable * gradientsTableInput, NumericTable * gradientsTableResult, Parameter * parameter,
+                             engines::BatchBase & engine);
+};
+
+/**
+ * Per-thread state of the asynchronous saga: own copies of the objective function
+ * which are computed in the thread-local snapshot of the argument
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SagaHogwildThreadTask
+{
+    static SagaHogwildThreadTask<algorithmFPType, cpu> * create(const sum_of_functions::BatchPtr & function, size_t argumentSize);
+
+    sum_of_functions::BatchPtr function;           /* Computes the gradient of one term */
+    sum_of_functions::BatchPtr proximalProjection; /* Computes the proximal projection of the updated point */
+    TArray<algorithmFPType, cpu> snapshot;         /* Copy of the shared argument the update is computed for */
+    TArray<algorithmFPType, cpu> point;            /* Argument of the objective functions */
+    TArray<int, cpu> batchIndex;
+    TArray<algorithmFPType, cpu> summDelta; /* Changes of the sum of gradients made by the thread in the current round */
+};
+
+} // namespace internal
+
+} // namespace saga
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -149,6 +149,16 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 }
 
 } // namespace interface2
+
+namespace interface3
+{
+Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold,
+                     const data_management::NumericTablePtr batchIndices, const size_t batchSize,
+                     const data_management::NumericTablePtr learningRateSequence, size_t seed, bool deterministic)
+    : interface2::Parameter(function, nIterations, accuracyThreshold, batchIndices, batchSize, learningRateSequence, seed),
+      deterministic(deterministic)
+{}
+} // namespace interface3
 } // namespace saga
 } // namespace optimization_solver
 } // namespace algorithms
@@ -0,0 +1,311 @@
+/* file: sgd_dense_hogwild_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of asynchronous lock-free sgd algorithm
+//
+// Feng Niu, Benjamin Recht, Christopher Re, Stephen J. Wright
+// HOGWILD!: A Lock-Free Approach to Parallelizing Stochastic Gradient Descent
+//--
+*/
+
+#ifndef __SGD_DENSE_HOGWILD_IMPL_I__
+#define __SGD_DENSE_HOGWILD_IMPL_I__
+
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_utils.h"
+#include "src/services/service_data_utils.h"
+#include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
+#include "src/threading/threading.h"
+#include "src/externals/service_ittnotify.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+DAAL_ITTNOTIFY_DOMAIN(sgd.dense.hogwild);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+/* Number of updates that every thread applies between two synchronization points */
+const size_t hogwildUpdatesPerThread = 64;
+
+template <typename algorithmFPType, CpuType cpu>
+SGDHogwildThreadTask<algorithmFPType, cpu> * SGDHogwildThreadTask<algorithmFPType, cpu>::create(const sum_of_functions::BatchPtr & function,
+                                                                                              const NumericTablePtr & argument, size_t batchSize,
+                                                                                              bool useBatchIndices)
+{
+    SGDHogwildThreadTask<algorithmFPType, cpu> * task = new SGDHogwildThreadTask<algorithmFPType, cpu>();
+    if (!task) return nullptr;
+
+    task->function = function->clone();
+    if (!task->function.get())
+    {
+        delete task;
+        return nullptr;
+    }
+    task->function->enableChecks(false);
+    task->function->sumOfFunctionsInput->set(sum_of_functions::argument, argument);
+
+    if (useBatchIndices)
+    {
+        Status s;
+        task->ntBatchIndices.reset(new HomogenNumericTableCPU<int, cpu>(NULL, batchSize, 1, s));
+        if (!task->ntBatchIndices.get() || !s)
+        {
+            delete task;
+            return nullptr;
+        }
+        task->function->sumOfFunctionsParameter->batchIndices = task->ntBatchIndices;
+    }
+    return task;
+}
+
+/**
+ *  \brief Kernel for asynchronous SGD calculation.
+ *  Iterations are processed by rounds. The first update of a round is computed sequentially and is used
+ *  for the convergence check, the rest of the round is split between threads which update the shared
+ *  argument without any synchronization.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, hogwild, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                   NumericTable * nIterations, Parameter<hogwild> * parameter,
+                                                                   NumericTable * learningRateSequence, NumericTable * batchIndices,
+                                                                   OptionalArgument * optionalArgument, OptionalArgument * optionalResult,
+                                                                   engines::BatchBase & engine)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(SGDKernel(hogwild).compute);
+
+    services::Status s;
+    const size_t argumentSize = inputArgument->getNumberOfRows();
+    const size_t nIter        = parameter->nIterations;
+    const size_t batchSize    = parameter->batchSize;
+
+    WriteRows<algorithmFPType, cpu> workValueBD(*minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(workValueBD);
+    algorithmFPType * workValue = workValueBD.get();
+    {
+        ReadRows<algorithmFPType, cpu> startValueBD(*inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(startValueBD);
+        if (workValue != startValueBD.get())
+        {
+            int result = daal::services::internal::daal_memcpy_s(workValue, argumentSize * sizeof(algorithmFPType), startValueBD.get(),
+                                                                 argumentSize * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        }
+    }
+
+    WriteRows<int, cpu> nIterationsBD(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD);
+    int * nProceededIterations = nIterationsBD.get();
+    nProceededIterations[0]    = 0;
+
+    /* if nIter == 0, set result as start point, the number of executed iters to 0 */
+    if (nIter == 0) return s;
+    DAAL_CHECK(nIter <= services::internal::MaxVal<int>::get(), ErrorIterativeSolverIncorrectMaxNumberOfIterations)
+
+    NumericTable * lastIterationInput =
+        (optionalArgument) ? NumericTable::cast(optionalArgument->get(iterative_solver::lastIteration)).get() : nullptr;
+    NumericTable * lastIterationResult = (optionalResult) ? NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get() : nullptr;
+
+    size_t startIteration = 0;
+    if (lastIterationInput)
+    {
+        ReadRows<int, cpu> lastIterationInputBD(lastIterationInput, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationInputBD);
+        startIteration = lastIterationInputBD.get()[0];
+    }
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t nTerms                 = function->sumOfFunctionsParameter->numberOfTerms;
+    const IndicesStatus indicesStatus   = (batchIndices ? user : (batchSize < nTerms ? random : all));
+    const bool useBatchIndices          = (indicesStatus == user || indicesStatus == random);
+
+    const size_t nThreads  = parameter->deterministic ? 1 : threader_get_threads_number();
+    const size_t roundSize = nThreads * hogwildUpdatesPerThread;
+
+    ReadRows<int, cpu> predefinedBatchIndicesBD(batchIndices, 0, nIter);
+    using namespace iterative_solver::internal;
+    RngTask<int, cpu> rngTask(nullptr, batchSize);
+    DAAL_CHECK_MALLOC(indicesStatus != random || rngTask.init(nTerms, engine));
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, roundSize, batchSize);
+    TArray<int, cpu> aRoundIndices(indicesStatus == random ? roundSize * batchSize : 0);
+    DAAL_CHECK_MALLOC(indicesStatus != random || aRoundIndices.get());
+
+    ReadRows<algorithmFPType, cpu> learningRateBD(*learningRateSequence, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(learningRateBD);
+    const algorithmFPType * learningRateArray = learningRateBD.get();
+    const size_t learningRateLength           = learningRateSequence->getNumberOfColumns();
+    const double accuracyThreshold            = parameter->accuracyThreshold;
+
+    /* All threads compute gradients in the same memory that is updated in place */
+    NumericTablePtr ntWorkValue = HomogenNumericTableCPU<algorithmFPType, cpu>::create(workValue, 1, argumentSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    NumericTablePtr previousArgument     = function->sumOfFunctionsInput->get(sum_of_functions::argument);
+    NumericTablePtr previousBatchIndices = function->sumOfFunctionsParameter->batchIndices;
+
+    SharedPtr<HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
+    if (useBatchIndices)
+    {
+        ntBatchIndices = HomogenNumericTableCPU<int, cpu>::create(nullptr, batchSize, 1, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, ntWorkValue);
+    function->sumOfFunctionsParameter->batchIndices = ntBatchIndices;
+
+    daal::tls<SGDHogwildThreadTask<algorithmFPType, cpu> *> tlsTask([=]() -> SGDHogwildThreadTask<algorithmFPType, cpu> * {
+        return SGDHogwildThreadTask<algorithmFPType, cpu>::create(function, ntWorkValue, batchSize, useBatchIndices);
+    });
+
+    services::internal::HostAppHelper host(pHost, 10);
+    size_t nProceededIters = 0;
+    while (s.ok() && nProceededIters < nIter)
+    {
+        const size_t nUpdates    = daal::services::internal::min<cpu, size_t>(roundSize, nIter - nProceededIters);
+        const int * roundIndices = nullptr;
+        if (indicesStatus == user)
+        {
+            roundIndices = predefinedBatchIndicesBD.get() + nProceededIters * batchSize;
+        }
+        else if (indicesStatus == random)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(generateUniform);
+            /* Indices are generated sequentially to keep the sequence independent of the number of threads */
+            for (size_t i = 0; s.ok() && i < nUpdates; i++)
+            {
+                const int * pValues = nullptr;
+                s                   = rngTask.get(pValues);
+                if (s)
+                {
+                    int result = daal::services::internal::daal_memcpy_s(aRoundIndices.get() + i * batchSize, batchSize * sizeof(int), pValues,
+                                                                         batchSize * sizeof(int));
+                    if (result) s = Status(ErrorMemoryCopyFailedInternal);
+                }
+            }
+            DAAL_CHECK_BREAK(!s);
+            roundIndices = aRoundIndices.get();
+        }
+
+        /* The first update of the round is sequential: it is used for the convergence check */
+        if (useBatchIndices) ntBatchIndices->setArray(const_cast<int *>(roundIndices), batchSize);
+        s = function->computeNoThrow();
+        if (!s || host.isCancelled(s, 1)) break;
+
+        NumericTable * gradient = function->getResult()->get(objective_function::gradientIdx).get();
+        if (nIter != 1)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(convergence_check);
+
+            algorithmFPType pointNorm, gradientNorm;
+            s = vectorNorm(workValue, argumentSize, pointNorm);
+            s |= vectorNorm(gradient, gradientNorm);
+            DAAL_CHECK_BREAK(!s);
+
+            const algorithmFPType one(1.0);
+            const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+            DAAL_CHECK_BREAK(gradientNorm < gradientThreshold);
+        }
+        {
+            ReadRows<algorithmFPType, cpu> gradientBD(*gradient, 0, argumentSize);
+            /* Leave the loop rather than return: the thread tasks and the input of the function are restored below */
+            s = gradientBD.status();
+            DAAL_CHECK_BREAK(!s);
+            const algorithmFPType * gradientArray = gradientBD.get();
+            const algorithmFPType learningRate    = learningRateArray[(startIteration + nProceededIters) % learningRateLength];
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < argumentSize; j++)
+            {
+                workValue[j] -= learningRate * gradientArray[j];
+            }
+        }
+
+        /* The rest of the round is split between threads, every thread updates the argument without locks */
+        const size_t nAsyncUpdates = nUpdates - 1;
+        if (nAsyncUpdates)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(asyncUpdates);
+
+            const size_t nBlocks         = daal::services::internal::min<cpu, size_t>(nThreads, nAsyncUpdates);
+            const size_t nUpdatesInBlock = nAsyncUpdates / nBlocks + !!(nAsyncUpdates % nBlocks);
+            const size_t firstIteration  = startIteration + nProceededIters;
+
+            SafeStatus safeStat;
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+                SGDHogwildThreadTask<algorithmFPType, cpu> * local = tlsTask.local();
+                DAAL_CHECK_MALLOC_THR(local);
+
+                const size_t iStart = 1 + iBlock * nUpdatesInBlock;
+                const size_t iEnd   = daal::services::internal::min<cpu, size_t>(nUpdates, iStart + nUpdatesInBlock);
+                for (size_t i = iStart; i < iEnd; i++)
+                {
+                    if (useBatchIndices) local->ntBatchIndices->setArray(const_cast<int *>(roundIndices + i * batchSize), batchSize);
+                    DAAL_CHECK_STATUS_THR(local->function->computeNoThrow());
+
+                    NumericTable * localGradient = local->function->getResult()->get(objective_function::gradientIdx).get();
+                    ReadRows<algorithmFPType, cpu> gradientBD(*localGradient, 0, argumentSize);
+                    DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+                    const algorithmFPType * gradientArray = gradientBD.get();
+                    const algorithmFPType learningRate    = learningRateArray[(firstIteration + i) % learningRateLength];
+
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < argumentSize; j++)
+                    {
+                        workValue[j] -= learningRate * gradientArray[j];
+                    }
+                }
+            });
+            s |= safeStat.detach();
+        }
+        nProceededIters += nUpdates;
+    }
+
+    tlsTask.reduce([](SGDHogwildThreadTask<algorithmFPType, cpu> * local) -> void { delete local; });
+
+    function->sumOfFunctionsParameter->batchIndices = previousBatchIndices;
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, previousArgument);
+
+    nProceededIterations[0] = (int)nProceededIters;
+    if (lastIterationResult)
+    {
+        WriteRows<int, cpu> lastIterationResultBD(lastIterationResult, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationResultBD);
+        lastIterationResultBD.get()[0] = startIteration + nProceededIters;
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace sgd
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -91,7 +91,7 @@ protected:
     void * _impl;
 };
 
-template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableMalloc<T, cpu> >
+template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableScratchMalloc<T, cpu> >
 class TlsMem : public daal::tls<T *>
 {
 public:
@@ -105,7 +105,7 @@ public:
     }
 };
 
-template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableMalloc<T, cpu> >
+template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableScratchMalloc<T, cpu> >
 class StaticTlsMem : public daal::static_tls<T *>
 {
 public:
@@ -119,7 +119,7 @@ public:
     }
 };
 
-template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableMalloc<T, cpu> >
+template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableScratchMalloc<T, cpu> >
 class LsMem : public daal::ls<T *>
 {
 public:
@@ -134,10 +134,10 @@ public:
 };
 
 template <typename algorithmFPType, CpuType cpu>
-class TlsSum : public daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> >
+class TlsSum : public daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableScratchCalloc<algorithmFPType, cpu> >
 {
 public:
-    typedef daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > super;
+    typedef daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableScratchCalloc<algorithmFPType, cpu> > super;
     TlsSum(size_t n) : super(n) {}
     void reduceTo(algorithmFPType * res, size_t n)
     {
@@ -158,10 +158,10 @@ public:
 };
 
 template <typename algorithmFPType, CpuType cpu>
-class StaticTlsSum : public daal::StaticTlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> >
+class StaticTlsSum : public daal::StaticTlsMem<algorithmFPType, cpu, services::internal::ScalableScratchCalloc<algorithmFPType, cpu> >
 {
 public:
-    typedef daal::StaticTlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > super;
+    typedef daal::StaticTlsMem<algorithmFPType, cpu, services::internal::ScalableScratchCalloc<algorithmFPType, cpu> > super;
     StaticTlsSum(size_t n) : super(n) {}
     void reduceTo(algorithmFPType * res, size_t n)
     {
@@ -26,6 +26,7 @@
 #include "src/algorithms/svm/svm_train_boser_kernel.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "src/algorithms/svm/oneapi/svm_train_thunder_kernel_oneapi.h"
+#include "src/services/service_algo_utils.h"
 
 namespace daal
 {
@@ -86,6 +87,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     kernelPar.shrinkingStep     = par->shrinkingStep;
     kernelPar.doShrinking       = par->doShrinking;
     kernelPar.cacheSize         = par->cacheSize;
+    kernelPar.hostApp           = daal::services::internal::hostApp(*input);
 
     daal::services::Environment::env & env = *_env;
 
@@ -27,6 +27,7 @@
 #include "data_management/data/numeric_table.h"
 #include "algorithms/model.h"
 #include "services/daal_defines.h"
+#include "services/host_app.h"
 #include "algorithms/svm/svm_train_types.h"
 #include "src/algorithms/kernel.h"
 
@@ -56,6 +57,8 @@ struct KernelParameter : svm::Parameter
     double epsilon  = 0.1;
     double nu       = 0.5;
     SvmType svmType = SvmType::classification;
+
+    services::HostAppIface * hostApp = nullptr; /*!< Host application notified and checked for cancellation after each iteration */
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
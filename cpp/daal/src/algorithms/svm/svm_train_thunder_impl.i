@@ -48,6 +48,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/services/service_utils.h"
 #include "src/services/service_data_utils.h"
+#include "src/services/service_algo_utils.h"
 #include "src/externals/service_ittnotify.h"
 #include "src/externals/service_blas.h"
 #include "src/externals/service_math.h"
@@ -134,9 +135,11 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
     TArray<char, cpu> I(nWS);
     DAAL_CHECK_MALLOC(I.get());
 
-    size_t defaultCacheSize = services::internal::min<cpu, size_t>(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
-    defaultCacheSize        = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
-    auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
+    /* The cache is shrunk to the memory left in the scratch budget, so that the training takes the slower path instead of failing */
+    const size_t cacheBudget = services::internal::min<cpu, size_t>(cacheSize, services::internal::getAvailableScratchMemory());
+    size_t defaultCacheSize  = services::internal::min<cpu, size_t>(nVectors, cacheBudget / nVectors / sizeof(algorithmFPType));
+    defaultCacheSize         = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
+    auto cachePtr            = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
     DAAL_CHECK_STATUS_VAR(status);
 
     if (svmType == SvmType::nu_classification || svmType == SvmType::nu_regression)
@@ -167,6 +170,9 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
         DAAL_CHECK_STATUS(status, updateGrad(kernelSOARes, deltaAlpha.get(), grad, nVectors, nTrainVectors, nWS));
         if (checkStopCondition(diff, diffPrev, accuracyThreshold, sameLocalDiff) && iter >= nNoChanges) break;
         diffPrev = diff;
+
+        /* Stop at the iteration boundary on the host application request; the model is built from the current coefficients */
+        if (services::internal::isCancelled(status, svmPar.hostApp, iter + 1, diff)) break;
     }
 
     cachePtr->clear();
@@ -23,6 +23,7 @@
 
 #include "services/internal/daal_kernel_defines.h"
 #include "src/externals/service_dispatch.h"
+#include "src/threading/threading.h"
 #include "src/data_management/data_conversion_cpu.h"
 #include "data_management/data/internal/conversion.h"
 
@@ -177,6 +178,40 @@ DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int idx1, int id
     return table[idx1][idx2];
 }
 
+/* Number of rows in the block of rows gathered by one thread */
+const size_t gatherRowsInBlock = 1024;
+
+template <typename T>
+static void vectorGatherRowsFunc(size_t nrows, size_t ncols, const GatherColumn * columns, size_t rowOffset, T * dst, size_t dstNCols)
+{
+#define DAAL_VECTOR_GATHER_ROWS_CPU(cpuId, ...) vectorGatherRowsCpu<T, cpuId>(__VA_ARGS__);
+
+    DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_VECTOR_GATHER_ROWS_CPU, nrows, ncols, columns, rowOffset, dst, dstNCols);
+
+#undef DAAL_VECTOR_GATHER_ROWS_CPU
+}
+
+template <typename T>
+DAAL_EXPORT void vectorGatherRows(size_t nrows, size_t ncols, const GatherColumn * columns, T * dst, size_t dstNCols)
+{
+    if (nrows * ncols < parallelGatherMinSize || nrows <= gatherRowsInBlock)
+    {
+        vectorGatherRowsFunc<T>(nrows, ncols, columns, 0, dst, dstNCols);
+        return;
+    }
+
+    const size_t nBlocks = (nrows + gatherRowsInBlock - 1) / gatherRowsInBlock;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t rowOffset    = iBlock * gatherRowsInBlock;
+        const size_t nRowsInBlock = (rowOffset + gatherRowsInBlock < nrows) ? gatherRowsInBlock : nrows - rowOffset;
+        vectorGatherRowsFunc<T>(nRowsInBlock, ncols, columns, rowOffset, dst, dstNCols);
+    });
+}
+
+template DAAL_EXPORT void vectorGatherRows<float>(size_t nrows, size_t ncols, const GatherColumn * columns, float * dst, size_t dstNCols);
+template DAAL_EXPORT void vectorGatherRows<double>(size_t nrows, size_t ncols, const GatherColumn * columns, double * dst, size_t dstNCols);
+template DAAL_EXPORT void vectorGatherRows<int>(size_t nrows, size_t ncols, const GatherColumn * columns, int * dst, size_t dstNCols);
+
 } // namespace internal
 namespace data_feature_utils
 {
@@ -175,6 +175,88 @@ DAAL_CONVERT_DOWN_FUNCS(vectorConvertFuncCpu, (size_t n, const void * src, void
 DAAL_CONVERT_UP_FUNCS(vectorStrideConvertFuncCpu, (size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride))
 DAAL_CONVERT_DOWN_FUNCS(vectorStrideConvertFuncCpu, (size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride))
 
+/* Number of rows and columns in the tile that is converted column by column and stored row by row */
+const size_t gatherTileRows    = 64;
+const size_t gatherTileColumns = 8;
+
+template <typename TSrc, typename T, CpuType cpu>
+DAAL_FORCEINLINE void gatherColumnToTile(size_t n, const char * src, size_t srcByteStride, T * tileColumn)
+{
+    if (srcByteStride == sizeof(TSrc))
+    {
+        const TSrc * const values = reinterpret_cast<const TSrc *>(src);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            tileColumn[i] = static_cast<T>(values[i]);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            tileColumn[i] = static_cast<T>(*reinterpret_cast<const TSrc *>(src + i * srcByteStride));
+        }
+    }
+}
+
+template <typename T, CpuType cpu>
+DAAL_FORCEINLINE void gatherColumnToTile(int indexType, size_t n, const char * src, size_t srcByteStride, T * tileColumn)
+{
+    switch (indexType)
+    {
+    case features::DAAL_FLOAT32: gatherColumnToTile<float, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_FLOAT64: gatherColumnToTile<double, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT32_S: gatherColumnToTile<int, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT32_U: gatherColumnToTile<unsigned int, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT64_S: gatherColumnToTile<DAAL_INT64, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT64_U: gatherColumnToTile<DAAL_UINT64, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT8_S: gatherColumnToTile<char, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT8_U: gatherColumnToTile<unsigned char, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT16_S: gatherColumnToTile<short, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    case features::DAAL_INT16_U: gatherColumnToTile<unsigned short, T, cpu>(n, src, srcByteStride, tileColumn); break;
+    default: DAAL_ASSERT(false);
+    }
+}
+
+template <typename T, CpuType cpu>
+void vectorGatherRowsCpu(size_t nrows, size_t ncols, const GatherColumn * columns, size_t rowOffset, void * dst, size_t dstNCols)
+{
+    T tile[gatherTileColumns][gatherTileRows];
+    T * const rows = static_cast<T *>(dst);
+
+    for (size_t i = 0; i < nrows; i += gatherTileRows)
+    {
+        const size_t nTileRows = (i + gatherTileRows < nrows) ? gatherTileRows : nrows - i;
+        for (size_t j = 0; j < ncols; j += gatherTileColumns)
+        {
+            const size_t nTileColumns = (j + gatherTileColumns < ncols) ? gatherTileColumns : ncols - j;
+            for (size_t k = 0; k < nTileColumns; ++k)
+            {
+                const GatherColumn & column = columns[j + k];
+                gatherColumnToTile<T, cpu>(column.indexType, nTileRows, column.ptr + (rowOffset + i) * column.byteStride, column.byteStride, tile[k]);
+            }
+
+            for (size_t r = 0; r < nTileRows; ++r)
+            {
+                T * const row = rows + (rowOffset + i + r) * dstNCols + j;
+                for (size_t k = 0; k < nTileColumns; ++k)
+                {
+                    row[k] = tile[k][r];
+                }
+            }
+        }
+    }
+}
+
+template void vectorGatherRowsCpu<float, DAAL_CPU>(size_t nrows, size_t ncols, const GatherColumn * columns, size_t rowOffset, void * dst,
+                                                   size_t dstNCols);
+template void vectorGatherRowsCpu<double, DAAL_CPU>(size_t nrows, size_t ncols, const GatherColumn * columns, size_t rowOffset, void * dst,
+                                                    size_t dstNCols);
+template void vectorGatherRowsCpu<int, DAAL_CPU>(size_t nrows, size_t ncols, const GatherColumn * columns, size_t rowOffset, void * dst,
+                                                 size_t dstNCols);
+
 template <typename T, CpuType cpu>
 void vectorAssignValueToArrayCpu(void * const ptr, const size_t n, const void * const value)
 {
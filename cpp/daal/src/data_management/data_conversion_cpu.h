@@ -19,6 +19,7 @@
 #define __KERNEL_DATA_MANAGEMENT_DATA_CONVERSION_CPU_H__
 
 #include "src/services/service_defines.h"
+#include "data_management/data/internal/conversion.h"
 
 namespace daal
 {
@@ -41,6 +42,9 @@ void vectorConvertFuncCpu(size_t n, const void * src, void * dst);
 template <typename T1, typename T2, CpuType cpu>
 void vectorStrideConvertFuncCpu(size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride);
 
+template <typename T, CpuType cpu>
+void vectorGatherRowsCpu(size_t nrows, size_t ncols, const GatherColumn * columns, size_t rowOffset, void * dst, size_t dstNCols);
+
 template <typename T, CpuType cpu>
 void vectorAssignValueToArrayCpu(void * const ptr, const size_t n, const void * const value);
 
@@ -0,0 +1,293 @@
+/* file: mapped_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+
+#include "data_management/data/mapped_numeric_table.h"
+#include "services/daal_memory.h"
+#include "src/services/service_mapped_file.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+namespace
+{
+const char mappedFileSignature[8]    = { 'D', 'A', 'A', 'L', 'C', 'O', 'L', 'F' };
+const unsigned int mappedFileVersion = 1;
+const unsigned int columnAlignment   = 64;
+const size_t rowsInWriteBlock        = 65536;
+
+struct MappedFileHeader
+{
+    char signature[8];
+    unsigned int version;
+    unsigned int alignment;
+    DAAL_UINT64 nRows;
+    DAAL_UINT64 nColumns;
+    DAAL_UINT64 dictionaryOffset;
+    DAAL_UINT64 reserved;
+};
+
+struct MappedFileFeature
+{
+    int indexType;
+    int featureType;
+    DAAL_UINT64 categoryNumber;
+    DAAL_UINT64 typeSize;
+    DAAL_UINT64 offset;
+};
+
+size_t getTypeSize(int indexType)
+{
+    switch (indexType)
+    {
+    case features::DAAL_FLOAT32:
+    case features::DAAL_INT32_S:
+    case features::DAAL_INT32_U: return 4;
+    case features::DAAL_FLOAT64:
+    case features::DAAL_INT64_S:
+    case features::DAAL_INT64_U: return 8;
+    case features::DAAL_INT8_S:
+    case features::DAAL_INT8_U: return 1;
+    case features::DAAL_INT16_S:
+    case features::DAAL_INT16_U: return 2;
+    default: return 0;
+    }
+}
+
+features::PMMLNumType getPMMLType(int indexType)
+{
+    switch (indexType)
+    {
+    case features::DAAL_FLOAT32: return features::DAAL_GEN_FLOAT;
+    case features::DAAL_FLOAT64: return features::DAAL_GEN_DOUBLE;
+    case features::DAAL_INT32_S:
+    case features::DAAL_INT32_U:
+    case features::DAAL_INT64_S:
+    case features::DAAL_INT64_U:
+    case features::DAAL_INT8_S:
+    case features::DAAL_INT8_U:
+    case features::DAAL_INT16_S:
+    case features::DAAL_INT16_U: return features::DAAL_GEN_INTEGER;
+    default: return features::DAAL_GEN_UNKNOWN;
+    }
+}
+
+DAAL_UINT64 alignOffset(DAAL_UINT64 offset)
+{
+    return (offset + columnAlignment - 1) / columnAlignment * columnAlignment;
+}
+
+class FileCloser
+{
+public:
+    FileCloser(FILE * file) : _file(file) {}
+    ~FileCloser()
+    {
+        if (_file) fclose(_file);
+    }
+
+    /* Closes the file and returns false if the buffered data was not written */
+    bool close()
+    {
+        const bool isClosed = (fclose(_file) == 0);
+        _file               = NULL;
+        return isClosed;
+    }
+
+private:
+    FILE * _file;
+};
+
+services::Status writeBytes(FILE * file, const void * ptr, size_t size)
+{
+    return (fwrite(ptr, 1, size, file) == size) ? services::Status() : services::Status(services::ErrorOnFileWrite);
+}
+
+services::Status writePadding(FILE * file, DAAL_UINT64 position, DAAL_UINT64 offset)
+{
+    const char zeros[columnAlignment] = { 0 };
+    DAAL_ASSERT(offset >= position && offset - position < columnAlignment);
+    return writeBytes(file, zeros, static_cast<size_t>(offset - position));
+}
+
+} // namespace
+
+MappedNumericTable::MappedNumericTable(NumericTableDictionaryPtr ddict, size_t nRows, services::Status & st)
+    : SOANumericTable(ddict, nRows, notAllocate, st)
+{}
+
+services::Status MappedNumericTable::mapColumns(const services::SharedPtr<byte> & file, const size_t * offsets)
+{
+    const size_t ncols = getNumberOfColumns();
+    for (size_t i = 0; i < ncols; ++i)
+    {
+        _arrays[i] = services::SharedPtr<byte>(file, file.get() + offsets[i]);
+    }
+    _arraysInitialized = ncols;
+    _partialMemStatus  = userAllocated;
+    _memStatus         = userAllocated;
+    return generatesOffsets();
+}
+
+services::SharedPtr<MappedNumericTable> MappedNumericTable::create(const char * path, services::Status * stat)
+{
+    services::Status defaultSt;
+    services::Status & st = (stat ? *stat : defaultSt);
+
+    size_t fileSize = 0;
+    const services::SharedPtr<byte> file = services::internal::mapFile(path, fileSize, st);
+    if (!st) return services::SharedPtr<MappedNumericTable>();
+
+    const MappedFileHeader * header = reinterpret_cast<const MappedFileHeader *>(file.get());
+    bool isValid                    = (fileSize >= sizeof(MappedFileHeader));
+    for (size_t i = 0; isValid && i < sizeof(mappedFileSignature); ++i)
+    {
+        isValid = (header->signature[i] == mappedFileSignature[i]);
+    }
+    isValid = isValid && header->version == mappedFileVersion && header->nColumns > 0
+              && header->dictionaryOffset % sizeof(DAAL_UINT64) == 0 && header->dictionaryOffset <= fileSize
+              && header->nColumns <= (fileSize - header->dictionaryOffset) / sizeof(MappedFileFeature);
+    if (!isValid)
+    {
+        st.add(services::ErrorIncorrectMappedFileFormat);
+        return services::SharedPtr<MappedNumericTable>();
+    }
+
+    const size_t ncols = static_cast<size_t>(header->nColumns);
+    const size_t nrows = static_cast<size_t>(header->nRows);
+    const MappedFileFeature * fileFeatures =
+        reinterpret_cast<const MappedFileFeature *>(file.get() + static_cast<size_t>(header->dictionaryOffset));
+
+    NumericTableDictionaryPtr ddict = NumericTableDictionary::create(ncols, DictionaryIface::notEqual, &st);
+    services::Collection<size_t> offsets(ncols);
+    if (!st || !offsets.data())
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<MappedNumericTable>();
+    }
+
+    for (size_t i = 0; i < ncols; ++i)
+    {
+        const MappedFileFeature & fileFeature = fileFeatures[i];
+        const size_t typeSize                 = getTypeSize(fileFeature.indexType);
+        isValid = typeSize > 0 && fileFeature.typeSize == typeSize && fileFeature.offset % typeSize == 0 && fileFeature.offset <= fileSize
+                  && nrows <= (fileSize - fileFeature.offset) / typeSize
+                  && (fileFeature.featureType == features::DAAL_CATEGORICAL || fileFeature.featureType == features::DAAL_ORDINAL
+                      || fileFeature.featureType == features::DAAL_CONTINUOUS);
+        if (!isValid)
+        {
+            st.add(services::ErrorIncorrectMappedFileFormat);
+            return services::SharedPtr<MappedNumericTable>();
+        }
+
+        NumericTableFeature & f = (*ddict)[i];
+        f.indexType             = static_cast<features::IndexNumType>(fileFeature.indexType);
+        f.pmmlType              = getPMMLType(fileFeature.indexType);
+        f.featureType           = static_cast<features::FeatureType>(fileFeature.featureType);
+        f.typeSize              = typeSize;
+        f.categoryNumber        = static_cast<size_t>(fileFeature.categoryNumber);
+        offsets[i]              = static_cast<size_t>(fileFeature.offset);
+    }
+
+    services::SharedPtr<MappedNumericTable> table(new MappedNumericTable(ddict, nrows, st));
+    if (!table)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return table;
+    }
+    if (st) st |= table->mapColumns(file, offsets.data());
+    if (!st) table.reset();
+    return table;
+}
+
+services::Status MappedNumericTable::writeFile(const char * path, NumericTable & table)
+{
+    const size_t ncols = table.getNumberOfColumns();
+    const size_t nrows = table.getNumberOfRows();
+    DAAL_CHECK(ncols > 0, services::ErrorIncorrectNumberOfFeatures);
+
+    NumericTableDictionaryPtr ddict = table.getDictionarySharedPtr();
+    services::Collection<MappedFileFeature> fileFeatures(ncols);
+    DAAL_CHECK_MALLOC(fileFeatures.data());
+
+    MappedFileHeader header;
+    daal::services::internal::daal_memcpy_s(header.signature, sizeof(header.signature), mappedFileSignature, sizeof(mappedFileSignature));
+    header.version          = mappedFileVersion;
+    header.alignment        = columnAlignment;
+    header.nRows            = nrows;
+    header.nColumns         = ncols;
+    header.dictionaryOffset = sizeof(MappedFileHeader);
+    header.reserved         = 0;
+
+    DAAL_UINT64 offset = alignOffset(header.dictionaryOffset + ncols * sizeof(MappedFileFeature));
+    for (size_t j = 0; j < ncols; ++j)
+    {
+        MappedFileFeature & fileFeature = fileFeatures[j];
+        const NumericTableFeature * f   = ddict ? &(*ddict)[j] : NULL;
+        const bool isDefined            = f && getTypeSize(f->indexType) > 0;
+
+        fileFeature.indexType      = isDefined ? f->indexType : features::DAAL_FLOAT64;
+        fileFeature.featureType    = f ? f->featureType : features::DAAL_CONTINUOUS;
+        fileFeature.categoryNumber = f ? f->categoryNumber : 0;
+        fileFeature.typeSize       = getTypeSize(fileFeature.indexType);
+        fileFeature.offset         = offset;
+        offset                     = alignOffset(offset + nrows * fileFeature.typeSize);
+    }
+
+    FILE * file = path ? fopen(path, "wb") : NULL;
+    DAAL_CHECK(file, services::ErrorOnFileOpen);
+    FileCloser closer(file);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, writeBytes(file, &header, sizeof(header)));
+    DAAL_CHECK_STATUS(s, writeBytes(file, fileFeatures.data(), ncols * sizeof(MappedFileFeature)));
+    DAAL_UINT64 position = header.dictionaryOffset + ncols * sizeof(MappedFileFeature);
+
+    services::Collection<double> buffer(rowsInWriteBlock);
+    DAAL_CHECK_MALLOC(buffer.data());
+
+    for (size_t j = 0; j < ncols; ++j)
+    {
+        const MappedFileFeature & fileFeature = fileFeatures[j];
+        DAAL_CHECK_STATUS(s, writePadding(file, position, fileFeature.offset));
+
+        internal::vectorConvertFuncType downCast = internal::getVectorDownCast(fileFeature.indexType, internal::getConversionDataType<double>());
+        DAAL_CHECK(downCast, services::ErrorDataTypeNotSupported);
+
+        for (size_t i = 0; i < nrows; i += rowsInWriteBlock)
+        {
+            const size_t n = (i + rowsInWriteBlock < nrows) ? rowsInWriteBlock : nrows - i;
+            BlockDescriptor<double> block;
+            DAAL_CHECK_STATUS(s, table.getBlockOfColumnValues(j, i, n, readOnly, block));
+            downCast(n, block.getBlockPtr(), buffer.data());
+            DAAL_CHECK_STATUS(s, table.releaseBlockOfColumnValues(block));
+            DAAL_CHECK_STATUS(s, writeBytes(file, buffer.data(), n * static_cast<size_t>(fileFeature.typeSize)));
+        }
+        position = fileFeature.offset + nrows * fileFeature.typeSize;
+    }
+
+    DAAL_CHECK(closer.close(), services::ErrorOnFileWrite);
+    return s;
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -23,6 +23,7 @@
 
 #include "src/externals/service_memory.h"
 #include "src/externals/service_service.h"
+#include "src/threading/threading.h"
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
@@ -47,6 +48,48 @@ void * daal::services::daal_calloc(size_t size, size_t alignment)
     return ptr;
 }
 
+void * daal::services::internal::daal_numa_partitioned_calloc(size_t size, size_t alignment)
+{
+    const size_t pageSize = 4096;
+    void * ptr            = daal::services::daal_malloc(size, alignment < pageSize ? pageSize : alignment);
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+
+    /* The pages are split into one contiguous range per NUMA node. Each range is zeroed by the threads
+       of the task arena constrained to its node, so under the first-touch policy of the OS the pages of the range
+       are placed on this node. Without the information about the NUMA nodes the block is zeroed in parallel */
+    char * cptr          = (char *)ptr;
+    const size_t nPages  = size / pageSize + !!(size % pageSize);
+    const size_t nNodes  = _daal_get_numa_nodes_number();
+    const size_t nRanges = nNodes ? nNodes : 1;
+
+    const size_t nPagesPerRange = nPages / nRanges + !!(nPages % nRanges);
+    for (size_t iRange = 0; iRange < nRanges; ++iRange)
+    {
+        const size_t begin = iRange * nPagesPerRange * pageSize;
+        if (begin >= size) break;
+        const size_t end = (size - begin > nPagesPerRange * pageSize) ? begin + nPagesPerRange * pageSize : size;
+
+        void * nodeArena     = nNodes ? _daal_get_task_arena(0, _daal_get_numa_node_id(iRange)) : nullptr;
+        void * previousArena = nodeArena ? _daal_set_thread_task_arena(nodeArena) : nullptr;
+
+        const size_t nRangePages    = (end - begin) / pageSize + !!((end - begin) % pageSize);
+        const size_t nPagesPerBlock = 16;
+        const size_t nBlocks        = nRangePages / nPagesPerBlock + !!(nRangePages % nPagesPerBlock);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t blockBegin = begin + iBlock * nPagesPerBlock * pageSize;
+            const size_t blockEnd   = (end - blockBegin > nPagesPerBlock * pageSize) ? blockBegin + nPagesPerBlock * pageSize : end;
+            daal::services::internal::service_memset_seq<char, sse2>(cptr + blockBegin, '\0', blockEnd - blockBegin);
+        });
+
+        if (nodeArena) _daal_set_thread_task_arena(previousArena);
+    }
+
+    return ptr;
+}
+
 void daal::services::daal_free(void * ptr)
 {
     daal::internal::Service<>::serv_free(ptr);
@@ -28,6 +28,9 @@
 #include "services/daal_memory.h"
 #include "src/services/service_defines.h"
 #include "src/threading/threading.h"
+#include "services/scratch_allocator.h"
+
+#include <atomic>
 
 namespace daal
 {
@@ -100,6 +103,112 @@ void service_scalable_free(T * ptr)
     threaded_scalable_free(ptr);
 }
 
+/* Temporary buffers of the algorithms are allocated by the scratch allocator installed in the environment if any */
+DAAL_EXPORT void * scratch_malloc(size_t size, size_t alignment, bool scalable);
+
+DAAL_EXPORT void scratch_free(void * ptr, bool scalable);
+
+/* Marks the scope of the computation, the scratch allocator is reset when the outermost scope is left.
+   The scope accounts the temporary buffers allocated by the thread that entered it and by the threads
+   that run the parallel loops started in the scope, the threading layer passes the scope to them */
+class DAAL_EXPORT ScratchComputeScope
+{
+public:
+    ScratchComputeScope();
+    ~ScratchComputeScope();
+
+    /* Statistics of the temporary buffers allocated in the scope since it was entered */
+    ScratchMemoryStatistics getStatistics() const;
+
+    /* True if an allocation failed because of the memory budget in the scope since it was entered */
+    bool isBudgetExceeded() const;
+
+private:
+    friend void * scratch_malloc(size_t size, size_t alignment, bool scalable);
+    friend void scratch_free(void * ptr, bool scalable);
+
+    ScratchComputeScope * _parent;
+    size_t _id;
+    size_t _rootId;
+    std::atomic<size_t> _currentBytes;
+    std::atomic<size_t> _peakBytes;
+    std::atomic<size_t> _nAllocations;
+    std::atomic<size_t> _nBudgetFailures;
+
+    ScratchComputeScope(const ScratchComputeScope &);
+    ScratchComputeScope & operator=(const ScratchComputeScope &);
+};
+
+/* Size of the temporary buffers that can be allocated before the memory budget is exceeded */
+DAAL_EXPORT size_t getAvailableScratchMemory();
+
+/* Installs the arena allocator owned by the library unless another scratch allocator is installed */
+DAAL_EXPORT void enableDefaultScratchArena();
+
+template <typename T, CpuType cpu>
+T * service_scratch_malloc(size_t size, size_t alignment = 64)
+{
+    return (T *)scratch_malloc(size * sizeof(T), alignment, false);
+}
+
+template <typename T, CpuType cpu>
+T * service_scratch_calloc(size_t size, size_t alignment = 64)
+{
+    T * ptr = (T *)scratch_malloc(size * sizeof(T), alignment, false);
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+
+    char * const cptr        = (char *)ptr;
+    const size_t sizeInBytes = size * sizeof(T);
+
+    for (size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+
+    return ptr;
+}
+
+template <typename T, CpuType cpu>
+void service_scratch_free(T * ptr)
+{
+    scratch_free(ptr, false);
+}
+
+template <typename T, CpuType cpu>
+T * service_scalable_scratch_malloc(size_t size, size_t alignment = 64)
+{
+    return (T *)scratch_malloc(size * sizeof(T), alignment, true);
+}
+
+template <typename T, CpuType cpu>
+T * service_scalable_scratch_calloc(size_t size, size_t alignment = 64)
+{
+    T * ptr = (T *)scratch_malloc(size * sizeof(T), alignment, true);
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+
+    char * const cptr        = (char *)ptr;
+    const size_t sizeInBytes = size * sizeof(T);
+
+    for (size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+
+    return ptr;
+}
+
+template <typename T, CpuType cpu>
+void service_scalable_scratch_free(T * ptr)
+{
+    scratch_free(ptr, true);
+}
+
 template <typename T, CpuType cpu>
 T * service_memset(T * const ptr, const T value, const size_t num)
 {
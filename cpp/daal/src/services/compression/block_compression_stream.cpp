@@ -0,0 +1,949 @@
+/* file: block_compression_stream.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the block-parallel (de-)compression stream interface.
+//
+//  Compressed data is a sequence of frames. A frame consists of
+//      - BlockFrameHeader,
+//      - index of nBlocks BlockFrameEntry records,
+//      - compressed blocks, each block is an independent stream of the compressor.
+//  All offsets in the index are given relative to the beginning of the frame.
+//--
+*/
+
+#include "data_management/compression/compression_stream.h"
+#include "data_management/compression/zlibcompression.h"
+#include "data_management/compression/lzocompression.h"
+#include "data_management/compression/rlecompression.h"
+#include "data_management/compression/bzip2compression.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace
+{
+const char blockFrameSignature[8]     = { 'D', 'A', 'A', 'L', 'B', 'L', 'K', 'Z' };
+const DAAL_UINT64 blockFrameVersion   = 1;
+const size_t blockFrameInitialReserve = 1024 * 64;
+
+struct BlockFrameHeader
+{
+    char signature[8];
+    DAAL_UINT64 version;
+    DAAL_UINT64 nBlocks;
+    DAAL_UINT64 rawSize;
+    DAAL_UINT64 frameSize;
+};
+
+struct BlockFrameEntry
+{
+    DAAL_UINT64 rawOffset;
+    DAAL_UINT64 rawSize;
+    DAAL_UINT64 compressedOffset;
+    DAAL_UINT64 compressedSize;
+};
+
+/* Growable array of bytes allocated by daal_malloc */
+class ByteBuffer
+{
+public:
+    ByteBuffer() : _ptr(NULL), _size(0), _capacity(0) {}
+
+    ~ByteBuffer()
+    {
+        if (_ptr)
+        {
+            daal::services::daal_free(_ptr);
+        }
+        _ptr = NULL;
+    }
+
+    byte * data() const { return _ptr; }
+    size_t size() const { return _size; }
+
+    bool reserve(size_t capacity)
+    {
+        if (capacity <= _capacity)
+        {
+            return true;
+        }
+        size_t newCapacity = (_capacity * 2 > capacity ? _capacity * 2 : capacity);
+        byte * newPtr      = (byte *)daal::services::daal_malloc(newCapacity);
+        if (!newPtr)
+        {
+            return false;
+        }
+        if (_size && daal::services::internal::daal_memcpy_s(newPtr, newCapacity, _ptr, _size))
+        {
+            daal::services::daal_free(newPtr);
+            return false;
+        }
+        if (_ptr)
+        {
+            daal::services::daal_free(_ptr);
+        }
+        _ptr      = newPtr;
+        _capacity = newCapacity;
+        return true;
+    }
+
+    bool append(const byte * ptr, size_t size)
+    {
+        if (!reserve(_size + size))
+        {
+            return false;
+        }
+        if (daal::services::internal::daal_memcpy_s(_ptr + _size, _capacity - _size, ptr, size))
+        {
+            return false;
+        }
+        _size += size;
+        return true;
+    }
+
+    void setSize(size_t size) { _size = size; }
+
+    /* Removes first size bytes from the buffer */
+    void erase(size_t size)
+    {
+        const size_t left = _size - size;
+        for (size_t i = 0; i < left; i++)
+        {
+            _ptr[i] = _ptr[size + i];
+        }
+        _size = left;
+    }
+
+    void clear() { _size = 0; }
+
+private:
+    byte * _ptr;
+    size_t _size;
+    size_t _capacity;
+
+    ByteBuffer(const ByteBuffer &);
+    ByteBuffer & operator=(const ByteBuffer &);
+};
+
+/* Creates the copy of the compressor or decompressor provided by the library, returns NULL for other types */
+template <template <CompressionMethod> class Codec, CompressionMethod method, typename Impl>
+Impl * cloneCodec(Impl * prototype)
+{
+    Codec<method> * typed = dynamic_cast<Codec<method> *>(prototype);
+    if (!typed)
+    {
+        return NULL;
+    }
+    Codec<method> * codec = new Codec<method>();
+    codec->parameter      = typed->parameter;
+    return codec;
+}
+
+template <template <CompressionMethod> class Codec, typename Impl>
+Impl * createCodec(Impl * prototype)
+{
+    Impl * codec = cloneCodec<Codec, zlib>(prototype);
+    if (!codec) codec = cloneCodec<Codec, lzo>(prototype);
+    if (!codec) codec = cloneCodec<Codec, rle>(prototype);
+    if (!codec) codec = cloneCodec<Codec, bzip2>(prototype);
+    return codec;
+}
+
+/* Calls process(codec, iBlock) for every block. Blocks are processed in parallel by the copies of the prototype
+ * or sequentially by the prototype itself if it cannot be copied */
+template <template <CompressionMethod> class Codec, typename Impl, typename Func>
+void processBlocks(Impl * prototype, size_t nBlocks, services::ErrorCollection & errors, const Func & process)
+{
+    services::Collection<Impl *> codecs(nBlocks);
+    bool isCloned = (codecs.size() == nBlocks);
+    for (size_t i = 0; i < codecs.size(); i++)
+    {
+        codecs[i] = (isCloned ? createCodec<Codec>(prototype) : NULL);
+        isCloned  = isCloned && codecs[i];
+    }
+
+    if (isCloned)
+    {
+        daal::threader_for(nBlocks, nBlocks, [&](int iBlock) { process(codecs[iBlock], (size_t)iBlock); });
+    }
+    else
+    {
+        for (size_t i = 0; i < nBlocks && prototype->getErrors()->size() == 0; i++)
+        {
+            process(prototype, i);
+        }
+        if (prototype->getErrors()->size() != 0)
+        {
+            errors.add(*(prototype->getErrors()));
+        }
+    }
+
+    for (size_t i = 0; i < codecs.size(); i++)
+    {
+        if (codecs[i] && codecs[i]->getErrors()->size() != 0)
+        {
+            errors.add(*(codecs[i]->getErrors()));
+        }
+        delete codecs[i];
+    }
+}
+
+struct CompressedBlock
+{
+    CompressedBlock() : size(0), rawSize(0) {}
+
+    services::SharedPtr<byte> data;
+    size_t size;
+    size_t rawSize;
+};
+
+/* Compresses the block as an independent stream. Leaves block.data empty on failure */
+void compressBlock(CompressorImpl * compressor, const byte * in, size_t inSize, CompressedBlock & block)
+{
+    size_t capacity = inSize + (inSize >> 3) + 1024;
+    byte * buffer   = (byte *)daal::services::daal_malloc(capacity);
+    if (!buffer)
+    {
+        return;
+    }
+
+    size_t used = 0;
+    compressor->setInputDataBlock(const_cast<byte *>(in), inSize, 0);
+    while (compressor->getErrors()->size() == 0)
+    {
+        compressor->run(buffer, capacity - used, used);
+        if (compressor->getErrors()->size() != 0)
+        {
+            break;
+        }
+        used += compressor->getUsedOutputDataBlockSize();
+        if (!compressor->isOutputDataBlockFull())
+        {
+            block.data    = services::SharedPtr<byte>(buffer, services::ServiceDeleter());
+            block.size    = used;
+            block.rawSize = inSize;
+            return;
+        }
+
+        const size_t newCapacity = capacity * 2;
+        byte * newBuffer         = (byte *)daal::services::daal_malloc(newCapacity);
+        if (!newBuffer || daal::services::internal::daal_memcpy_s(newBuffer, newCapacity, buffer, used))
+        {
+            if (newBuffer)
+            {
+                daal::services::daal_free(newBuffer);
+            }
+            break;
+        }
+        daal::services::daal_free(buffer);
+        buffer   = newBuffer;
+        capacity = newCapacity;
+    }
+    daal::services::daal_free(buffer);
+}
+
+/* Decompresses the independent stream of the block, returns true if exactly rawSize bytes are decompressed */
+bool decompressBlock(DecompressorImpl * decompressor, const byte * in, size_t inSize, byte * out, size_t rawSize)
+{
+    size_t used = 0;
+    decompressor->setInputDataBlock(const_cast<byte *>(in), inSize, 0);
+    do
+    {
+        if (decompressor->getErrors()->size() != 0)
+        {
+            return false;
+        }
+        decompressor->run(out, rawSize - used, used);
+        if (decompressor->getErrors()->size() != 0)
+        {
+            return false;
+        }
+        used += decompressor->getUsedOutputDataBlockSize();
+    } while (decompressor->isOutputDataBlockFull() && used < rawSize);
+
+    return (used == rawSize);
+}
+
+typedef services::Collection<CompressedBlock> CompressedBlockCollection;
+
+struct BlockCompressionState
+{
+    BlockCompressionState(CompressorImpl * compr, size_t blockSize)
+        : compressor(compr), blockSize(blockSize), batchSize(blockSize * daal::threader_get_threads_number()), readPos(0)
+    {}
+
+    CompressorImpl * compressor;
+    size_t blockSize;
+    size_t batchSize;                      /* Size of raw data compressed in one parallel pass */
+    ByteBuffer pending;                    /* Raw data that does not fill the batch yet */
+    CompressedBlockCollection frameBlocks; /* Compressed blocks of the open frame */
+    DataBlockCollection ready;             /* Closed frames that are not read yet */
+    size_t readPos;                        /* Read offset in the first ready block */
+};
+
+void compressBlocks(BlockCompressionState & state, services::ErrorCollection & errors, const byte * ptr, size_t size)
+{
+    const size_t blockSize = state.blockSize;
+    const size_t nBlocks   = (size + blockSize - 1) / blockSize;
+
+    CompressedBlockCollection blocks(nBlocks);
+    if (blocks.size() != nBlocks)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    processBlocks<Compressor>(state.compressor, nBlocks, errors, [&](CompressorImpl * compressor, size_t iBlock) {
+        const size_t offset = iBlock * blockSize;
+        compressBlock(compressor, ptr + offset, (size - offset < blockSize ? size - offset : blockSize), blocks[iBlock]);
+    });
+    if (errors.size() != 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        if (!blocks[i].data)
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        state.frameBlocks.push_back(blocks[i]);
+    }
+}
+
+void closeFrame(BlockCompressionState & state, services::ErrorCollection & errors)
+{
+    if (state.pending.size())
+    {
+        compressBlocks(state, errors, state.pending.data(), state.pending.size());
+        state.pending.clear();
+    }
+
+    const size_t nBlocks = state.frameBlocks.size();
+    if (errors.size() != 0 || nBlocks == 0)
+    {
+        return;
+    }
+
+    const size_t indexSize = sizeof(BlockFrameHeader) + nBlocks * sizeof(BlockFrameEntry);
+    byte * index           = (byte *)daal::services::daal_malloc(indexSize);
+    if (!index)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    services::SharedPtr<byte> indexPtr(index, services::ServiceDeleter());
+
+    BlockFrameEntry * entries = (BlockFrameEntry *)(index + sizeof(BlockFrameHeader));
+    DAAL_UINT64 rawOffset        = 0;
+    DAAL_UINT64 compressedOffset = indexSize;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        entries[i].rawOffset        = rawOffset;
+        entries[i].rawSize          = state.frameBlocks[i].rawSize;
+        entries[i].compressedOffset = compressedOffset;
+        entries[i].compressedSize   = state.frameBlocks[i].size;
+        rawOffset += state.frameBlocks[i].rawSize;
+        compressedOffset += state.frameBlocks[i].size;
+    }
+
+    BlockFrameHeader * header = (BlockFrameHeader *)index;
+    for (size_t i = 0; i < sizeof(blockFrameSignature); i++)
+    {
+        header->signature[i] = blockFrameSignature[i];
+    }
+    header->version   = blockFrameVersion;
+    header->nBlocks   = nBlocks;
+    header->rawSize   = rawOffset;
+    header->frameSize = compressedOffset;
+
+    state.ready.push_back(DataBlockPtr(new DataBlock(indexPtr, indexSize)));
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        state.ready.push_back(DataBlockPtr(new DataBlock(state.frameBlocks[i].data, state.frameBlocks[i].size)));
+    }
+    state.frameBlocks.clear();
+}
+
+struct BlockEntry
+{
+    BlockEntry() : compressedOffset(0), compressedSize(0), rawOffset(0), rawSize(0) {}
+
+    size_t compressedOffset; /* Offset in the input buffer */
+    size_t compressedSize;   /* Size of the compressed block */
+    size_t rawOffset;        /* Offset in the decompressed data of all parsed frames */
+    size_t rawSize;          /* Size of the decompressed block */
+};
+
+struct BlockDecompressionState
+{
+    explicit BlockDecompressionState(DecompressorImpl * decompr) : decompressor(decompr), parsedSize(0), rawSize(0), nDecompressed(0), readPos(0) {}
+
+    DecompressorImpl * decompressor;
+    ByteBuffer input;                        /* Received compressed data */
+    size_t parsedSize;                       /* Size of the complete frames at the beginning of the input */
+    services::Collection<BlockEntry> blocks; /* Blocks of the parsed frames */
+    size_t rawSize;                          /* Size of decompressed data of the parsed frames */
+    ByteBuffer output;                       /* Decompressed data of the first nDecompressed blocks */
+    size_t nDecompressed;                    /* Number of decompressed blocks */
+    size_t readPos;                          /* Read offset in the decompressed data */
+};
+
+/* Reads the headers and block indices of the complete frames received by the stream */
+void parseFrames(BlockDecompressionState & state, services::ErrorCollection & errors)
+{
+    const size_t headerSize = sizeof(BlockFrameHeader);
+    const size_t entrySize  = sizeof(BlockFrameEntry);
+
+    while (errors.size() == 0 && state.input.size() - state.parsedSize >= headerSize)
+    {
+        const byte * frame    = state.input.data() + state.parsedSize;
+        const size_t leftSize = state.input.size() - state.parsedSize;
+
+        BlockFrameHeader header;
+        daal::services::internal::daal_memcpy_s(&header, headerSize, frame, headerSize);
+
+        bool isValid = (header.version == blockFrameVersion && header.frameSize >= headerSize
+                        && header.nBlocks <= (header.frameSize - headerSize) / entrySize);
+        for (size_t i = 0; i < sizeof(blockFrameSignature); i++)
+        {
+            isValid = isValid && (header.signature[i] == blockFrameSignature[i]);
+        }
+        if (!isValid)
+        {
+            errors.add(services::ErrorCompressionIncorrectBlockFrame);
+            return;
+        }
+        if (leftSize < header.frameSize)
+        {
+            return;
+        }
+
+        const size_t indexSize = headerSize + header.nBlocks * entrySize;
+        services::Collection<BlockEntry> blocks;
+        DAAL_UINT64 rawOffset = 0;
+        for (size_t i = 0; i < header.nBlocks; i++)
+        {
+            BlockFrameEntry entry;
+            daal::services::internal::daal_memcpy_s(&entry, entrySize, frame + headerSize + i * entrySize, entrySize);
+            if (entry.rawOffset != rawOffset || entry.rawSize == 0 || entry.compressedSize == 0 || entry.compressedOffset < indexSize
+                || entry.compressedOffset > header.frameSize || entry.compressedSize > header.frameSize - entry.compressedOffset)
+            {
+                errors.add(services::ErrorCompressionIncorrectBlockFrame);
+                return;
+            }
+
+            BlockEntry block;
+            block.compressedOffset = state.parsedSize + entry.compressedOffset;
+            block.compressedSize   = entry.compressedSize;
+            block.rawOffset        = state.rawSize + entry.rawOffset;
+            block.rawSize          = entry.rawSize;
+            blocks.push_back(block);
+            rawOffset += entry.rawSize;
+        }
+        if (rawOffset != header.rawSize)
+        {
+            errors.add(services::ErrorCompressionIncorrectBlockFrame);
+            return;
+        }
+
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            state.blocks.push_back(blocks[i]);
+        }
+        state.rawSize += rawOffset;
+        state.parsedSize += header.frameSize;
+    }
+}
+
+/* Decompresses blocks [begin, end) so that the data of the block i is stored at out + blocks[i].rawOffset - outOffset */
+void decompressBlocks(BlockDecompressionState & state, services::ErrorCollection & errors, size_t begin, size_t end, byte * out, size_t outOffset)
+{
+    const size_t nBlocks = end - begin;
+    services::Collection<bool> isDecompressed(nBlocks);
+    if (isDecompressed.size() != nBlocks)
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    const byte * in = state.input.data();
+    processBlocks<Decompressor>(state.decompressor, nBlocks, errors, [&](DecompressorImpl * decompressor, size_t i) {
+        const BlockEntry & block = state.blocks[begin + i];
+        isDecompressed[i] = decompressBlock(decompressor, in + block.compressedOffset, block.compressedSize, out + block.rawOffset - outOffset,
+                                            block.rawSize);
+    });
+    if (errors.size() != 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        if (!isDecompressed[i])
+        {
+            errors.add(services::ErrorCompressionIncorrectBlockFrame);
+            return;
+        }
+    }
+}
+
+void decompressAll(BlockDecompressionState & state, services::ErrorCollection & errors)
+{
+    const size_t nBlocks = state.blocks.size();
+    if (state.nDecompressed == nBlocks)
+    {
+        return;
+    }
+    if (!state.output.reserve(state.rawSize))
+    {
+        errors.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    decompressBlocks(state, errors, state.nDecompressed, nBlocks, state.output.data(), 0);
+    if (errors.size() != 0)
+    {
+        return;
+    }
+    state.output.setSize(state.rawSize);
+    state.nDecompressed = nBlocks;
+}
+
+/* Drops the frames whose decompressed data is read */
+void releaseReadFrames(BlockDecompressionState & state)
+{
+    if (state.readPos < state.rawSize)
+    {
+        return;
+    }
+    state.input.erase(state.parsedSize);
+    state.parsedSize = 0;
+    state.blocks.clear();
+    state.rawSize = 0;
+    state.output.clear();
+    state.nDecompressed = 0;
+    state.readPos       = 0;
+}
+
+} // namespace
+
+namespace interface1
+{
+BlockCompressionStream::BlockCompressionStream(CompressorImpl * compr, const BlockCompressionParameter & par)
+    : CompressionStream(compr, par.blockSize), _impl(NULL)
+{
+    if (getErrors()->size() != 0)
+    {
+        return;
+    }
+    BlockCompressionState * state = new BlockCompressionState(compr, par.blockSize);
+    if (!state->pending.reserve(blockFrameInitialReserve))
+    {
+        getErrors()->add(services::ErrorMemoryAllocationFailed);
+    }
+    _impl = (void *)state;
+}
+
+BlockCompressionStream::~BlockCompressionStream()
+{
+    delete (BlockCompressionState *)_impl;
+    _impl = NULL;
+}
+
+void BlockCompressionStream::push_back(DataBlock * block)
+{
+    if (getErrors()->size() != 0)
+    {
+        return;
+    }
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        getErrors()->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getSize() == 0)
+    {
+        getErrors()->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+
+    BlockCompressionState & state = *(BlockCompressionState *)_impl;
+    services::ErrorCollection & errors = *getErrors();
+
+    const byte * ptr = block->getPtr();
+    size_t size      = block->getSize();
+    while (size && errors.size() == 0)
+    {
+        if (state.pending.size() == 0 && size >= state.blockSize)
+        {
+            /* Compress the whole blocks directly from the input */
+            size_t compressSize = size - size % state.blockSize;
+            compressSize        = (compressSize > state.batchSize ? state.batchSize : compressSize);
+            compressBlocks(state, errors, ptr, compressSize);
+            ptr += compressSize;
+            size -= compressSize;
+            continue;
+        }
+
+        const size_t freeSize = state.batchSize - state.pending.size();
+        const size_t copySize = (size > freeSize ? freeSize : size);
+        if (!state.pending.append(ptr, copySize))
+        {
+            errors.add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        ptr += copySize;
+        size -= copySize;
+
+        if (state.pending.size() == state.batchSize)
+        {
+            compressBlocks(state, errors, state.pending.data(), state.pending.size());
+            state.pending.clear();
+        }
+    }
+}
+
+DataBlockCollectionPtr BlockCompressionStream::getCompressedBlocksCollection()
+{
+    DataBlockCollectionPtr retBlocks = DataBlockCollectionPtr(new DataBlockCollection);
+    if (getErrors()->size() != 0)
+    {
+        return retBlocks;
+    }
+
+    BlockCompressionState & state = *(BlockCompressionState *)_impl;
+    closeFrame(state, *getErrors());
+
+    for (size_t i = 0; i < state.ready.size(); i++)
+    {
+        if (i == 0 && state.readPos)
+        {
+            const services::SharedPtr<byte> & data = state.ready[0]->getSharedPtr();
+            retBlocks->push_back(DataBlockPtr(
+                new DataBlock(services::SharedPtr<byte>(data, data.get() + state.readPos), state.ready[0]->getSize() - state.readPos)));
+            continue;
+        }
+        retBlocks->push_back(state.ready[i]);
+    }
+    state.ready.clear();
+    state.readPos = 0;
+    return retBlocks;
+}
+
+size_t BlockCompressionStream::getCompressedDataSize()
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+
+    BlockCompressionState & state = *(BlockCompressionState *)_impl;
+    closeFrame(state, *getErrors());
+
+    size_t compressedDataSize = 0;
+    for (size_t i = 0; i < state.ready.size(); i++)
+    {
+        compressedDataSize += state.ready[i]->getSize();
+    }
+    return compressedDataSize - state.readPos;
+}
+
+size_t BlockCompressionStream::copyCompressedArray(byte * ptr, size_t size)
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+    if (ptr == NULL)
+    {
+        getErrors()->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        getErrors()->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+
+    BlockCompressionState & state = *(BlockCompressionState *)_impl;
+    closeFrame(state, *getErrors());
+
+    size_t readSize = 0;
+    while (readSize < size && state.ready.size())
+    {
+        const size_t availSize = state.ready[0]->getSize() - state.readPos;
+        const size_t copySize  = (size - readSize > availSize ? availSize : size - readSize);
+
+        if (daal::services::internal::daal_memcpy_s(ptr + readSize, size - readSize, state.ready[0]->getPtr() + state.readPos, copySize))
+        {
+            getErrors()->add(services::ErrorMemoryCopyFailedInternal);
+            return readSize;
+        }
+        readSize += copySize;
+        state.readPos += copySize;
+
+        if (state.readPos == state.ready[0]->getSize())
+        {
+            state.ready.erase(0);
+            state.readPos = 0;
+        }
+    }
+    return readSize;
+}
+
+BlockDecompressionStream::BlockDecompressionStream(DecompressorImpl * decompr) : DecompressionStream(decompr), _impl(NULL)
+{
+    if (getErrors()->size() != 0)
+    {
+        return;
+    }
+    _impl = (void *)new BlockDecompressionState(decompr);
+}
+
+BlockDecompressionStream::~BlockDecompressionStream()
+{
+    delete (BlockDecompressionState *)_impl;
+    _impl = NULL;
+}
+
+void BlockDecompressionStream::push_back(DataBlock * block)
+{
+    if (getErrors()->size() != 0)
+    {
+        return;
+    }
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        getErrors()->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getSize() == 0)
+    {
+        getErrors()->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    if (!state.input.append(block->getPtr(), block->getSize()))
+    {
+        getErrors()->add(services::ErrorMemoryCopyFailedInternal);
+    }
+}
+
+DataBlockCollectionPtr BlockDecompressionStream::getDecompressedBlocksCollection()
+{
+    DataBlockCollectionPtr retBlocks = DataBlockCollectionPtr(new DataBlockCollection);
+    if (getErrors()->size() != 0)
+    {
+        return retBlocks;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    decompressAll(state, *getErrors());
+    if (getErrors()->size() != 0 || state.readPos == state.rawSize)
+    {
+        return retBlocks;
+    }
+
+    const size_t size = state.rawSize - state.readPos;
+    byte * data       = (byte *)daal::services::daal_malloc(size);
+    if (!data)
+    {
+        getErrors()->add(services::ErrorMemoryAllocationFailed);
+        return retBlocks;
+    }
+    services::SharedPtr<byte> dataPtr(data, services::ServiceDeleter());
+    if (daal::services::internal::daal_memcpy_s(data, size, state.output.data() + state.readPos, size))
+    {
+        getErrors()->add(services::ErrorMemoryCopyFailedInternal);
+        return retBlocks;
+    }
+    retBlocks->push_back(DataBlockPtr(new DataBlock(dataPtr, size)));
+
+    state.readPos = state.rawSize;
+    releaseReadFrames(state);
+    return retBlocks;
+}
+
+size_t BlockDecompressionStream::getDecompressedDataSize()
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    return state.rawSize - state.readPos;
+}
+
+size_t BlockDecompressionStream::copyDecompressedArray(byte * ptr, size_t size)
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+    if (ptr == NULL)
+    {
+        getErrors()->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        getErrors()->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    if (getErrors()->size() != 0 || state.readPos == state.rawSize)
+    {
+        return 0;
+    }
+
+    if (state.nDecompressed == 0 && size >= state.rawSize)
+    {
+        /* The whole data fits into the external array, decompress directly to it */
+        decompressBlocks(state, *getErrors(), 0, state.blocks.size(), ptr, 0);
+        if (getErrors()->size() != 0)
+        {
+            return 0;
+        }
+        const size_t readSize = state.rawSize;
+        state.readPos         = state.rawSize;
+        releaseReadFrames(state);
+        return readSize;
+    }
+
+    decompressAll(state, *getErrors());
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+
+    const size_t availSize = state.rawSize - state.readPos;
+    const size_t readSize  = (size > availSize ? availSize : size);
+    if (daal::services::internal::daal_memcpy_s(ptr, size, state.output.data() + state.readPos, readSize))
+    {
+        getErrors()->add(services::ErrorMemoryCopyFailedInternal);
+        return 0;
+    }
+    state.readPos += readSize;
+    releaseReadFrames(state);
+    return readSize;
+}
+
+size_t BlockDecompressionStream::getNumberOfBlocks()
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    return state.blocks.size();
+}
+
+size_t BlockDecompressionStream::getDecompressedBlockSize(size_t iBlock)
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    if (iBlock >= state.blocks.size())
+    {
+        getErrors()->add(services::ErrorIncorrectIndex);
+        return 0;
+    }
+    return state.blocks[iBlock].rawSize;
+}
+
+size_t BlockDecompressionStream::copyDecompressedBlock(size_t iBlock, byte * ptr, size_t size)
+{
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+    if (ptr == NULL)
+    {
+        getErrors()->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    if (getErrors()->size() != 0)
+    {
+        return 0;
+    }
+    if (iBlock >= state.blocks.size())
+    {
+        getErrors()->add(services::ErrorIncorrectIndex);
+        return 0;
+    }
+
+    const BlockEntry & block = state.blocks[iBlock];
+    if (size < block.rawSize)
+    {
+        getErrors()->add(services::ErrorIncorrectSizeOfArray);
+        return 0;
+    }
+
+    if (iBlock < state.nDecompressed)
+    {
+        if (daal::services::internal::daal_memcpy_s(ptr, size, state.output.data() + block.rawOffset, block.rawSize))
+        {
+            getErrors()->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+        return block.rawSize;
+    }
+
+    decompressBlocks(state, *getErrors(), iBlock, iBlock + 1, ptr, block.rawOffset);
+    return (getErrors()->size() != 0 ? 0 : block.rawSize);
+}
+
+void BlockDecompressionStream::closeInput()
+{
+    if (getErrors()->size() != 0)
+    {
+        return;
+    }
+
+    BlockDecompressionState & state = *(BlockDecompressionState *)_impl;
+    parseFrames(state, *getErrors());
+    if (getErrors()->size() == 0 && state.parsedSize != state.input.size())
+    {
+        /* The frame is truncated: more data is not expected */
+        getErrors()->add(services::ErrorCompressionIncorrectBlockFrame);
+    }
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -378,7 +378,14 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments)                 \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries)           \
     DECLARE_DAAL_STRING_CONST(gramMatrix)                        \
-    DECLARE_DAAL_STRING_CONST(lassoParameters)
+    DECLARE_DAAL_STRING_CONST(lassoParameters)                   \
+    DECLARE_DAAL_STRING_CONST(sumOfResponsibilities)             \
+    DECLARE_DAAL_STRING_CONST(sumOfWeightedData)                 \
+    DECLARE_DAAL_STRING_CONST(sumOfWeightedCrossProducts)        \
+    DECLARE_DAAL_STRING_CONST(partialGoalFunction)               \
+    DECLARE_DAAL_STRING_CONST(nProcessedBlocks)                  \
+    DECLARE_DAAL_STRING_CONST(stepSizeOffset)                    \
+    DECLARE_DAAL_STRING_CONST(stepSizeDecay)
 
 /**
  *  Intel(R) oneAPI Data Analytics Library namespace
@@ -173,6 +173,16 @@ DAAL_EXPORT void daal::services::Environment::setNumberOfThreads(const size_t nu
     daal::setNumberOfThreads(numThreads, &_globalControl);
 }
 
+DAAL_EXPORT daal::services::Status daal::services::Environment::setThreadTaskArena(size_t maxConcurrency, int numaNode)
+{
+    initNumberOfThreads();
+    if (!_daal_set_thread_task_arena_limits(static_cast<int>(maxConcurrency), numaNode))
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, "numaNode"));
+    }
+    return services::Status();
+}
+
 DAAL_EXPORT size_t daal::services::Environment::getNumberOfThreads() const
 {
     return daal::threader_get_threads_number();
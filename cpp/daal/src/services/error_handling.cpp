@@ -719,6 +719,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorMemoryAllocationFailed, "Memory allocation failed");
     add(ErrorEmptyDataBlock, "Empty data block");
     add(ErrorMemoryCopyFailedInternal, "Memory copy internal error");
+    add(ErrorScratchMemoryBudgetExceeded, "Temporary buffers of the computation exceed the memory budget set in the environment");
 
     // Workflow errors: -3000..-3999
     add(ErrorIncorrectCombinationOfComputationModeAndStep, "Incorrect combination of computation mode and computation step");
@@ -876,6 +877,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormat, "Input compressed stream is in wrong format or corrupted");
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+    add(ErrorCompressionIncorrectBlockFrame, "Input compressed stream is not a valid block-compressed frame or its block index is corrupted");
 
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
@@ -918,6 +920,8 @@ void ErrorMessageCollection::parseResourceFile()
     // Decision forest error: -20000..-20099
     add(ErrorDFBootstrapVarImportanceIncompatible, "Parameter 'bootstrap' is incompatible with requested variable importance type");
     add(ErrorDFBootstrapOOBIncompatible, "Parameter 'bootstrap' is incompatible with requested OOB result (no out-of-bag observations)");
+    add(ErrorDFIncorrectModelFileFormat, "File is not in the flat format of the decision forest model or is corrupted");
+    add(ErrorDFMappedModelIsReadOnly, "Decision forest model mapped from the file cannot be modified");
 
     // K-Nearest Neighbors errors: -21000..21999
     add(ErrorKNNInternal, "K-Nearest Neighbors internal error");
@@ -926,6 +930,9 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorGbtIncorrectNumberOfTrees, "Number of trees in the model is not consistent with the number of classes");
     add(ErrorGbtPredictIncorrectNumberOfIterations, "Number of iterations value in GBT parameter is not consistent with the model");
 
+    // Data management errors: -80001..
+    add(ErrorIncorrectMappedFileFormat, "File is not in the columnar format of the mapped numeric table or is corrupted");
+
     //Math errors: -90000..-90099
     add(ErrorDataSourseNotAvailable, "ErrorDataSourseNotAvailable");
     add(ErrorHandlesSQL, "ErrorHandlesSQL");
@@ -933,6 +940,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorOnFileWrite, "Error on file write");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
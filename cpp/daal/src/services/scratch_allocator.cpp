@@ -0,0 +1,533 @@
+/* file: scratch_allocator.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the allocator of temporary buffers used by the algorithms
+//--
+*/
+
+#include "services/scratch_allocator.h"
+#include "services/env_detect.h"
+#include "src/externals/service_memory.h"
+#include "src/algorithms/service_threading.h"
+
+#include <atomic>
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+namespace
+{
+/* Sizes of the cached blocks grow geometrically with four classes per power of two */
+const size_t nArenaSizeClasses  = 160;
+const size_t minArenaBlockSpace = 64;
+
+/* Header stored right before the block returned to the caller */
+struct ArenaBlock
+{
+    ArenaBlock * next;
+    byte * base;
+    size_t sizeClass; /* nArenaSizeClasses for the blocks that are not cached */
+};
+
+size_t arenaClassCapacity(size_t sizeClass)
+{
+    return (size_t)(4 + (sizeClass & 3)) << (sizeClass >> 2);
+}
+
+/* Returns the smallest size class that can hold the block of the given size */
+size_t arenaSizeClass(size_t size)
+{
+    if (size <= 4) return 0;
+
+    size_t exponent = 0;
+    while (((size - 1) >> exponent) > 7) ++exponent;
+    return exponent * 4 + ((size - 1) >> exponent) - 3;
+}
+
+/* Free lists of the blocks released by the threads with the same thread index */
+struct ArenaShard
+{
+    ArenaShard()
+    {
+        for (size_t i = 0; i < nArenaSizeClasses; ++i) freeLists[i] = nullptr;
+    }
+
+    std::atomic<ArenaBlock *> freeLists[nArenaSizeClasses];
+    daal::Mutex mutex;
+
+    ArenaBlock * pop(size_t sizeClass, size_t alignment)
+    {
+        if (!freeLists[sizeClass].load(std::memory_order_relaxed)) return nullptr;
+        AUTOLOCK(mutex);
+
+        ArenaBlock * prev = nullptr;
+        for (ArenaBlock * block = freeLists[sizeClass].load(std::memory_order_relaxed); block; prev = block, block = block->next)
+        {
+            if (reinterpret_cast<size_t>(block + 1) % alignment) continue;
+            if (prev)
+                prev->next = block->next;
+            else
+                freeLists[sizeClass].store(block->next, std::memory_order_relaxed);
+            return block;
+        }
+        return nullptr;
+    }
+
+    void push(ArenaBlock * block)
+    {
+        AUTOLOCK(mutex);
+        block->next = freeLists[block->sizeClass].load(std::memory_order_relaxed);
+        freeLists[block->sizeClass].store(block, std::memory_order_relaxed);
+    }
+
+    void release()
+    {
+        for (size_t i = 0; i < nArenaSizeClasses; ++i)
+        {
+            ArenaBlock * block = freeLists[i].load(std::memory_order_relaxed);
+            while (block)
+            {
+                ArenaBlock * next = block->next;
+                daal::services::daal_free(block->base);
+                block = next;
+            }
+            freeLists[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+};
+
+struct ArenaImpl
+{
+    ArenaImpl(size_t maxReservedSize, size_t nShards) : maxReservedSize(maxReservedSize), nShards(nShards), reservedSize(0)
+    {
+        shards = new ArenaShard[nShards];
+    }
+
+    ~ArenaImpl()
+    {
+        if (!shards) return;
+        for (size_t i = 0; i < nShards; ++i) shards[i].release();
+        delete[] shards;
+    }
+
+    size_t maxReservedSize;
+    size_t nShards;
+    ArenaShard * shards;
+    std::atomic<size_t> reservedSize;
+
+    ArenaShard & currentShard()
+    {
+        const int index = daal::threader_get_max_current_thread_index();
+        return shards[(index > 0 ? (size_t)index : 0) % nShards];
+    }
+
+    /* Reserves the space for a new cached block unless it exceeds the limit */
+    bool reserve(size_t size)
+    {
+        size_t reserved = reservedSize.load(std::memory_order_relaxed);
+        do
+        {
+            if (size > maxReservedSize || reserved > maxReservedSize - size) return false;
+        } while (!reservedSize.compare_exchange_weak(reserved, reserved + size, std::memory_order_relaxed));
+        return true;
+    }
+
+    ArenaBlock * newBlock(size_t capacity, size_t sizeClass, size_t alignment)
+    {
+        const size_t blockAlignment = alignment > minArenaBlockSpace ? alignment : minArenaBlockSpace;
+        byte * base                 = static_cast<byte *>(daal::services::daal_malloc(blockAlignment + capacity, blockAlignment));
+        if (!base) return nullptr;
+
+        ArenaBlock * block = reinterpret_cast<ArenaBlock *>(base + blockAlignment) - 1;
+        block->next        = nullptr;
+        block->base        = base;
+        block->sizeClass   = sizeClass;
+        return block;
+    }
+};
+
+} // namespace
+
+ScratchArenaAllocator::ScratchArenaAllocator(size_t maxReservedSize, services::Status & st) : _impl(nullptr)
+{
+    if (maxReservedSize == 0)
+    {
+        st.add(services::ErrorIncorrectParameter);
+        return;
+    }
+    const int nThreads = daal::threader_get_max_threads_number();
+    ArenaImpl * impl   = new ArenaImpl(maxReservedSize, nThreads > 0 ? (size_t)nThreads : 1);
+    if (!impl || !impl->shards)
+    {
+        delete impl;
+        st.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    _impl = impl;
+}
+
+ScratchArenaAllocator::~ScratchArenaAllocator()
+{
+    delete static_cast<ArenaImpl *>(_impl);
+}
+
+services::SharedPtr<ScratchArenaAllocator> ScratchArenaAllocator::create(size_t maxReservedSize, services::Status * stat)
+{
+    services::Status defaultSt;
+    services::Status & st = (stat ? *stat : defaultSt);
+    services::SharedPtr<ScratchArenaAllocator> result(new ScratchArenaAllocator(maxReservedSize, st));
+    if (!result)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+    }
+    if (!st)
+    {
+        result.reset();
+    }
+    return result;
+}
+
+void * ScratchArenaAllocator::allocate(size_t size, size_t alignment)
+{
+    ArenaImpl * impl = static_cast<ArenaImpl *>(_impl);
+    if (size > ((size_t)-1) - 2 * minArenaBlockSpace - alignment) return nullptr;
+
+    const size_t sizeClass = arenaSizeClass(size);
+    if (sizeClass >= nArenaSizeClasses)
+    {
+        ArenaBlock * block = impl->newBlock(size, nArenaSizeClasses, alignment);
+        return block ? block + 1 : nullptr;
+    }
+
+    /* Blocks released by the thread with the same index are reused first, then a new block is cached
+       while the reserved size allows it, then the blocks released by the other threads are reused */
+    ArenaShard & shard = impl->currentShard();
+    ArenaBlock * block = shard.pop(sizeClass, alignment);
+    if (block) return block + 1;
+
+    const size_t capacity = arenaClassCapacity(sizeClass);
+    if (impl->reserve(capacity))
+    {
+        block = impl->newBlock(capacity, sizeClass, alignment);
+        if (!block) impl->reservedSize.fetch_sub(capacity, std::memory_order_relaxed);
+        return block ? block + 1 : nullptr;
+    }
+
+    for (size_t i = 0; i < impl->nShards && !block; ++i)
+    {
+        block = impl->shards[i].pop(sizeClass, alignment);
+    }
+
+    /* Blocks over the limit of the reserved size are released on deallocation */
+    if (!block) block = impl->newBlock(size, nArenaSizeClasses, alignment);
+    return block ? block + 1 : nullptr;
+}
+
+void ScratchArenaAllocator::deallocate(void * ptr)
+{
+    ArenaImpl * impl = static_cast<ArenaImpl *>(_impl);
+    if (!ptr) return;
+
+    ArenaBlock * block = static_cast<ArenaBlock *>(ptr) - 1;
+    if (block->sizeClass == nArenaSizeClasses)
+        daal::services::daal_free(block->base);
+    else
+        impl->currentShard().push(block);
+}
+
+void ScratchArenaAllocator::reset()
+{
+    /* Cached blocks are kept for the next computation, their total size is bounded by the limit of the reserved size */
+}
+
+size_t ScratchArenaAllocator::getReservedSize() const
+{
+    ArenaImpl * impl = static_cast<ArenaImpl *>(_impl);
+    return impl->reservedSize.load(std::memory_order_relaxed);
+}
+
+} // namespace interface1
+
+namespace internal
+{
+namespace
+{
+/* Header stored in front of each temporary buffer, it keeps the allocator the buffer came from, its size
+   and the computation scopes that accounted it */
+struct ScratchHeader
+{
+    ScratchAllocatorIface * allocator;
+    size_t offset;
+    size_t size;
+    size_t scopeId;
+    size_t rootScopeId;
+    bool isHugePages;
+    bool isAccounted;
+};
+
+const size_t minScratchAlignment = 64;
+
+/* Innermost computation scope of the thread, the threading layer keeps it for the threads that run parallel loops */
+ScratchComputeScope * currentScratchScope()
+{
+    return static_cast<ScratchComputeScope *>(_daal_get_scratch_scope());
+}
+
+void updateMaximum(std::atomic<size_t> & maximum, size_t value)
+{
+    size_t current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+struct ScratchState
+{
+    ScratchState()
+        : allocator(nullptr),
+          budget(0),
+          currentBytes(0),
+          peakBytes(0),
+          nAllocations(0),
+          nScopes(0),
+          nComputations(0)
+    {}
+
+    ScratchAllocatorIfacePtr installed;
+    std::atomic<ScratchAllocatorIface *> allocator;
+    std::atomic<size_t> budget;
+    std::atomic<size_t> currentBytes;
+    std::atomic<size_t> peakBytes;
+    std::atomic<size_t> nAllocations;
+    std::atomic<size_t> nScopes;
+    size_t nComputations;
+    daal::Mutex mutex; /* Guards the installation of the allocator and the computation scopes */
+
+    /* Buffers are accounted only while a scratch allocator or a memory budget is set */
+    bool isAccounted() const { return allocator.load(std::memory_order_relaxed) || budget.load(std::memory_order_relaxed); }
+
+    /* Accounts the buffer if it fits into the budget */
+    bool acquire(size_t size)
+    {
+        const size_t limit = budget.load(std::memory_order_relaxed);
+        size_t current     = currentBytes.load(std::memory_order_relaxed);
+        if (limit)
+        {
+            do
+            {
+                if (size > limit || current > limit - size)
+                {
+                    return false;
+                }
+            } while (!currentBytes.compare_exchange_weak(current, current + size, std::memory_order_relaxed));
+            current += size;
+        }
+        else
+        {
+            current = currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        }
+
+        nAllocations.fetch_add(1, std::memory_order_relaxed);
+        updateMaximum(peakBytes, current);
+        return true;
+    }
+
+    void release(size_t size) { currentBytes.fetch_sub(size, std::memory_order_relaxed); }
+
+    ScratchMemoryStatistics getStatistics() const
+    {
+        ScratchMemoryStatistics statistics;
+        statistics.currentBytes = currentBytes.load(std::memory_order_relaxed);
+        statistics.peakBytes    = peakBytes.load(std::memory_order_relaxed);
+        statistics.nAllocations = nAllocations.load(std::memory_order_relaxed);
+        return statistics;
+    }
+};
+
+ScratchState & scratchState()
+{
+    static ScratchState state;
+    return state;
+}
+
+} // namespace
+
+void * scratch_malloc(size_t size, size_t alignment, bool scalable)
+{
+    ScratchState & state = scratchState();
+    if (alignment < minScratchAlignment) alignment = minScratchAlignment;
+    if (size > ((size_t)-1) - alignment) return nullptr;
+
+    ScratchComputeScope * const scope = currentScratchScope();
+    const bool isAccounted            = state.isAccounted();
+    if (isAccounted && !state.acquire(size))
+    {
+        if (scope) scope->_nBudgetFailures.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    ScratchAllocatorIface * allocator = state.allocator.load(std::memory_order_relaxed);
+    const bool isHugePages            = !allocator && daal_huge_pages_enabled(size);
+    byte * ptr                        = static_cast<byte *>(allocator   ? allocator->allocate(size + alignment, alignment) :
+                                                 isHugePages ? daal_huge_pages_calloc(size + alignment, alignment) :
+                                                 scalable    ? daal::threaded_scalable_malloc(size + alignment, alignment) :
+                                                               daal::services::daal_malloc(size + alignment, alignment));
+    if (!ptr)
+    {
+        if (isAccounted) state.release(size);
+        return nullptr;
+    }
+
+    ScratchHeader & header = reinterpret_cast<ScratchHeader *>(ptr + alignment)[-1];
+    header.allocator       = allocator;
+    header.offset          = alignment;
+    header.size            = size;
+    header.scopeId         = 0;
+    header.rootScopeId     = 0;
+    header.isHugePages     = isHugePages;
+    header.isAccounted     = isAccounted;
+
+    if (isAccounted && scope)
+    {
+        header.scopeId     = scope->_id;
+        header.rootScopeId = scope->_rootId;
+        for (ScratchComputeScope * s = scope; s; s = s->_parent)
+        {
+            const size_t current = s->_currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+            s->_nAllocations.fetch_add(1, std::memory_order_relaxed);
+            updateMaximum(s->_peakBytes, current);
+        }
+    }
+    return ptr + alignment;
+}
+
+void scratch_free(void * ptr, bool scalable)
+{
+    if (!ptr) return;
+
+    const ScratchHeader & header = static_cast<ScratchHeader *>(ptr)[-1];
+    byte * const block           = static_cast<byte *>(ptr) - header.offset;
+    if (header.isAccounted) scratchState().release(header.size);
+
+    /* The scopes of the same computation that are still active and were entered before the allocation accounted the buffer */
+    ScratchComputeScope * scope = currentScratchScope();
+    if (header.rootScopeId && scope && scope->_rootId == header.rootScopeId)
+    {
+        for (; scope; scope = scope->_parent)
+        {
+            if (scope->_id <= header.scopeId) scope->_currentBytes.fetch_sub(header.size, std::memory_order_relaxed);
+        }
+    }
+    if (header.allocator)
+        header.allocator->deallocate(block);
+    else if (header.isHugePages)
+        daal_huge_pages_free(block);
+    else if (scalable)
+        daal::threaded_scalable_free(block);
+    else
+        daal::services::daal_free(block);
+}
+
+ScratchComputeScope::ScratchComputeScope()
+    : _parent(currentScratchScope()), _currentBytes(0), _peakBytes(0), _nAllocations(0), _nBudgetFailures(0)
+{
+    ScratchState & state = scratchState();
+    _id                  = state.nScopes.fetch_add(1, std::memory_order_relaxed) + 1;
+    _rootId              = _parent ? _parent->_rootId : _id;
+    _daal_set_scratch_scope(this);
+
+    AUTOLOCK(state.mutex);
+    ++state.nComputations;
+}
+
+ScratchComputeScope::~ScratchComputeScope()
+{
+    ScratchState & state = scratchState();
+    _daal_set_scratch_scope(_parent);
+    if (_parent) _parent->_nBudgetFailures.fetch_add(_nBudgetFailures.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    AUTOLOCK(state.mutex);
+    ScratchAllocatorIface * allocator = state.allocator.load(std::memory_order_relaxed);
+    if (--state.nComputations == 0 && allocator) allocator->reset();
+}
+
+ScratchMemoryStatistics ScratchComputeScope::getStatistics() const
+{
+    ScratchMemoryStatistics statistics;
+    statistics.currentBytes = _currentBytes.load(std::memory_order_relaxed);
+    statistics.peakBytes    = _peakBytes.load(std::memory_order_relaxed);
+    statistics.nAllocations = _nAllocations.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+bool ScratchComputeScope::isBudgetExceeded() const
+{
+    return _nBudgetFailures.load(std::memory_order_relaxed) != 0;
+}
+
+size_t getAvailableScratchMemory()
+{
+    ScratchState & state = scratchState();
+    const size_t budget  = state.budget.load(std::memory_order_relaxed);
+    const size_t current = state.currentBytes.load(std::memory_order_relaxed);
+    if (!budget) return (size_t)-1;
+    return (current < budget) ? budget - current : 0;
+}
+
+void enableDefaultScratchArena()
+{
+    ScratchState & state = scratchState();
+    if (state.allocator.load(std::memory_order_acquire)) return;
+
+    ScratchArenaAllocatorPtr arena = ScratchArenaAllocator::create();
+    AUTOLOCK(state.mutex);
+    if (!state.allocator.load(std::memory_order_relaxed) && state.nComputations == 0 && arena)
+    {
+        state.installed = arena;
+        state.allocator.store(arena.get(), std::memory_order_release);
+    }
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+DAAL_EXPORT daal::services::Status daal::services::Environment::setScratchAllocator(const ScratchAllocatorIfacePtr & allocator)
+{
+    internal::ScratchState & state = internal::scratchState();
+    AUTOLOCK(state.mutex);
+    DAAL_CHECK(state.nComputations == 0, services::ErrorIncorrectParameter);
+
+    state.installed = allocator;
+    state.allocator.store(allocator.get(), std::memory_order_release);
+    return services::Status();
+}
+
+DAAL_EXPORT void daal::services::Environment::setScratchMemoryBudget(size_t budget)
+{
+    internal::scratchState().budget.store(budget, std::memory_order_relaxed);
+}
+
+DAAL_EXPORT daal::services::ScratchMemoryStatistics daal::services::Environment::getScratchMemoryStatistics() const
+{
+    return internal::scratchState().getStatistics();
+}
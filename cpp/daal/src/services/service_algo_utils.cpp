@@ -49,6 +49,14 @@ bool isCancelled(services::Status & s, services::HostAppIface * pHostApp)
     return true;
 }
 
+bool isCancelled(services::Status & s, services::HostAppIface * pHostApp, size_t nIterations, double objectiveFunctionValue)
+{
+    if (!pHostApp) return false;
+    HostAppIface2 * pHostApp2 = dynamic_cast<HostAppIface2 *>(pHostApp);
+    if (pHostApp2) pHostApp2->onIteration(nIterations, objectiveFunctionValue);
+    return isCancelled(s, pHostApp);
+}
+
 HostAppHelper::HostAppHelper(HostAppIface * hostApp, size_t maxJobsBeforeCheck)
     : _hostApp(hostApp), _maxJobsBeforeCheck(maxJobsBeforeCheck), _nJobsAfterLastCheck(0)
 {}
@@ -45,6 +45,7 @@ DAAL_EXPORT services::HostAppIface * hostApp(algorithms::interface1::Input & inp
 void setHostApp(const services::SharedPtr<services::HostAppIface> & pHostApp, algorithms::interface1::Input & inp);
 services::HostAppIfacePtr getHostApp(daal::algorithms::interface1::Input & inp);
 bool isCancelled(services::Status & s, services::HostAppIface * pHostApp);
+bool isCancelled(services::Status & s, services::HostAppIface * pHostApp, size_t nIterations, double objectiveFunctionValue);
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Helper class handling cancellation status depending on the number of jobs to be done
@@ -95,6 +95,36 @@ struct ScalableCalloc
     static void deallocate(T * ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+/* CPU specific allocators of temporary buffers that go through the scratch allocator of the environment */
+
+template <typename T, CpuType cpu>
+struct ScratchMalloc
+{
+    static T * allocate(size_t n) { return service_scratch_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ScratchCalloc
+{
+    static T * allocate(size_t n) { return service_scratch_calloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ScalableScratchMalloc
+{
+    static T * allocate(size_t n) { return service_scalable_scratch_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scalable_scratch_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ScalableScratchCalloc
+{
+    static T * allocate(size_t n) { return service_scalable_scratch_calloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scalable_scratch_free<T, cpu>(ptr); }
+};
+
 /* CPU specific deleters */
 
 template <typename T, CpuType cpu>
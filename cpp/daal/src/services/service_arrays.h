@@ -105,16 +105,16 @@ private:
 };
 
 template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
-using TArray = DynamicArray<T, DAALMalloc<T, cpu>, ConstructionPolicy, cpu>;
+using TArray = DynamicArray<T, ScratchMalloc<T, cpu>, ConstructionPolicy, cpu>;
 
 template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
-using TArrayCalloc = DynamicArray<T, DAALCalloc<T, cpu>, ConstructionPolicy, cpu>;
+using TArrayCalloc = DynamicArray<T, ScratchCalloc<T, cpu>, ConstructionPolicy, cpu>;
 
 template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
-using TArrayScalable = DynamicArray<T, ScalableMalloc<T, cpu>, ConstructionPolicy, cpu>;
+using TArrayScalable = DynamicArray<T, ScalableScratchMalloc<T, cpu>, ConstructionPolicy, cpu>;
 
 template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
-using TArrayScalableCalloc = DynamicArray<T, ScalableCalloc<T, cpu>, ConstructionPolicy, cpu>;
+using TArrayScalableCalloc = DynamicArray<T, ScalableScratchCalloc<T, cpu>, ConstructionPolicy, cpu>;
 
 template <typename T, size_t staticBufferSize, typename Allocator, typename ConstructionPolicy, CpuType cpu>
 class StaticallyBufferedDynamicArray
@@ -188,7 +188,7 @@ private:
 };
 
 template <typename T, size_t staticBufferSize, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
-using TNArray = StaticallyBufferedDynamicArray<T, staticBufferSize, DAALMalloc<T, cpu>, ConstructionPolicy, cpu>;
+using TNArray = StaticallyBufferedDynamicArray<T, staticBufferSize, ScratchMalloc<T, cpu>, ConstructionPolicy, cpu>;
 
 } // namespace internal
 } // namespace services
@@ -0,0 +1,137 @@
+/* file: service_huge_pages.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the memory blocks backed by huge pages
+//--
+*/
+
+#include "services/daal_memory.h"
+#include "services/env_detect.h"
+
+#if defined(__linux__)
+    #define DAAL_HUGE_PAGES_LINUX
+    #include <sys/mman.h>
+#endif
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+const size_t hugePageSize = 2 * 1024 * 1024;
+const size_t maxAlignment = 4096;
+
+size_t hugePagesThreshold = 0;
+
+/* Header stored in front of each block, it keeps the mapping the block belongs to.
+   The mapped size is zero if the block is allocated by daal_malloc */
+struct HugePagesHeader
+{
+    byte * base;
+    size_t mappedSize;
+};
+
+#ifdef DAAL_HUGE_PAGES_LINUX
+byte * mapHugePages(size_t mappedSize)
+{
+    #if defined(MAP_HUGETLB)
+    void * ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) return static_cast<byte *>(ptr);
+    #endif
+
+    /* No huge pages are reserved in the system: the region is aligned to 2MB,
+       so that the OS can back it with transparent huge pages */
+    const size_t reservedSize = mappedSize + hugePageSize;
+    void * reserved           = mmap(nullptr, reservedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) return nullptr;
+
+    byte * const begin = static_cast<byte *>(reserved);
+    byte * const end   = begin + reservedSize;
+    byte * const base  = begin + (hugePageSize - reinterpret_cast<size_t>(begin) % hugePageSize) % hugePageSize;
+    if (base > begin) munmap(begin, base - begin);
+    if (end > base + mappedSize) munmap(base + mappedSize, end - (base + mappedSize));
+
+    #if defined(MADV_HUGEPAGE)
+    madvise(base, mappedSize, MADV_HUGEPAGE);
+    #endif
+    return base;
+}
+#endif
+
+} // namespace
+
+void * daal_huge_pages_calloc(size_t size, size_t alignment)
+{
+    if (alignment < sizeof(HugePagesHeader)) alignment = sizeof(HugePagesHeader);
+    if (alignment > maxAlignment || size > ((size_t)-1) - alignment - 2 * hugePageSize) return nullptr;
+
+    const size_t blockSize = size + alignment;
+    byte * base            = nullptr;
+    size_t mappedSize      = 0;
+
+#ifdef DAAL_HUGE_PAGES_LINUX
+    /* Anonymous mappings are zero-filled by the OS */
+    mappedSize = (blockSize + hugePageSize - 1) / hugePageSize * hugePageSize;
+    base       = mapHugePages(mappedSize);
+    if (!base) mappedSize = 0;
+#endif
+
+    if (!base)
+    {
+        base = static_cast<byte *>(daal::services::daal_calloc(blockSize, alignment));
+        if (!base) return nullptr;
+    }
+
+    HugePagesHeader & header = reinterpret_cast<HugePagesHeader *>(base + alignment)[-1];
+    header.base              = base;
+    header.mappedSize        = mappedSize;
+    return base + alignment;
+}
+
+void daal_huge_pages_free(void * ptr)
+{
+    if (!ptr) return;
+
+    const HugePagesHeader & header = static_cast<HugePagesHeader *>(ptr)[-1];
+#ifdef DAAL_HUGE_PAGES_LINUX
+    if (header.mappedSize)
+    {
+        munmap(header.base, header.mappedSize);
+        return;
+    }
+#endif
+    daal::services::daal_free(header.base);
+}
+
+bool daal_huge_pages_enabled(size_t size)
+{
+    return hugePagesThreshold && size >= hugePagesThreshold;
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+DAAL_EXPORT void daal::services::Environment::setHugePagesThreshold(size_t threshold)
+{
+    internal::hugePagesThreshold = threshold;
+}
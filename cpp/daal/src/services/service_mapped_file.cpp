@@ -0,0 +1,162 @@
+/* file: service_mapped_file.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the memory regions backed by files on local disk
+//--
+*/
+
+#include "src/services/service_mapped_file.h"
+#include "services/daal_memory.h"
+
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__APPLE__)
+    #define DAAL_MAPPED_FILE_POSIX
+    #include <fcntl.h>
+    #include <stdlib.h>
+    #include <string.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+#ifdef DAAL_MAPPED_FILE_POSIX
+
+static const char tempFileTemplate[] = "/daal_XXXXXX";
+
+services::Status MappedTempFile::create(const char * directory, size_t size)
+{
+    release();
+    if (!size) return services::Status();
+
+    if (!directory || !directory[0]) directory = getenv("TMPDIR");
+    if (!directory || !directory[0]) directory = "/tmp";
+
+    const size_t dirLength  = strlen(directory);
+    const size_t pathLength = dirLength + sizeof(tempFileTemplate);
+    char * path             = static_cast<char *>(daal_malloc(pathLength));
+    DAAL_CHECK_MALLOC(path);
+    daal_memcpy_s(path, pathLength, directory, dirLength);
+    daal_memcpy_s(path + dirLength, pathLength - dirLength, tempFileTemplate, sizeof(tempFileTemplate));
+
+    const int fd = mkstemp(path);
+    if (fd != -1) unlink(path);
+    daal_free(path);
+    DAAL_CHECK(fd != -1, services::ErrorOnFileOpen);
+
+    /* Reserve the disk blocks in advance, otherwise the first access to a page
+       that does not fit the disk terminates the process */
+    #if defined(__linux__)
+    const bool isReserved = (posix_fallocate(fd, 0, static_cast<off_t>(size)) == 0);
+    #else
+    const bool isReserved = (ftruncate(fd, static_cast<off_t>(size)) == 0);
+    #endif
+    void * ptr = isReserved ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    close(fd);
+    DAAL_CHECK(ptr != MAP_FAILED, services::ErrorMemoryAllocationFailed);
+
+    _ptr  = ptr;
+    _size = size;
+    return services::Status();
+}
+
+void MappedTempFile::release()
+{
+    if (_ptr) munmap(_ptr, _size);
+    _ptr  = nullptr;
+    _size = 0;
+}
+
+class MappedFileDeleter : public services::DeleterIface
+{
+public:
+    MappedFileDeleter(size_t size) : _size(size) {}
+
+    void operator()(const void * ptr) DAAL_C11_OVERRIDE { munmap(const_cast<void *>(ptr), _size); }
+
+private:
+    size_t _size;
+};
+
+services::SharedPtr<byte> mapFile(const char * path, size_t & size, services::Status & st)
+{
+    size = 0;
+    const int fd = path ? open(path, O_RDONLY) : -1;
+    if (fd == -1)
+    {
+        st.add(services::ErrorOnFileOpen);
+        return services::SharedPtr<byte>();
+    }
+
+    struct stat info;
+    const bool isRead = (fstat(fd, &info) == 0) && (info.st_size > 0);
+
+    /* The private writable mapping keeps the numeric table API writable without modifying the file.
+       Unmodified pages stay shared with the page cache and are not charged against the commit limit */
+    int flags = MAP_PRIVATE;
+    #if defined(MAP_NORESERVE)
+    flags |= MAP_NORESERVE;
+    #endif
+    void * ptr = isRead ? mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, flags, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (!isRead)
+    {
+        st.add(services::ErrorOnFileRead);
+        return services::SharedPtr<byte>();
+    }
+    if (ptr == MAP_FAILED)
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return services::SharedPtr<byte>();
+    }
+
+    size = static_cast<size_t>(info.st_size);
+    return services::SharedPtr<byte>(static_cast<byte *>(ptr), MappedFileDeleter(size));
+}
+
+#else
+
+services::Status MappedTempFile::create(const char * directory, size_t size)
+{
+    release();
+    return size ? services::Status(services::ErrorMethodNotImplemented) : services::Status();
+}
+
+void MappedTempFile::release()
+{
+    _ptr  = nullptr;
+    _size = 0;
+}
+
+services::SharedPtr<byte> mapFile(const char * path, size_t & size, services::Status & st)
+{
+    size = 0;
+    st.add(services::ErrorMethodNotImplemented);
+    return services::SharedPtr<byte>();
+}
+
+#endif
+
+} // namespace internal
+} // namespace services
+} // namespace daal
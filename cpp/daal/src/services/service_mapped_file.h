@@ -0,0 +1,87 @@
+/* file: service_mapped_file.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the memory regions backed by files on local disk
+//--
+*/
+
+#ifndef __SERVICE_MAPPED_FILE_H__
+#define __SERVICE_MAPPED_FILE_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/**
+ * Read-write memory region that is mapped to an unnamed temporary file.
+ * The pages of the region are loaded from the file and evicted from the main memory by the OS on demand,
+ * the file is removed from the disk when the region is released.
+ */
+class MappedTempFile
+{
+public:
+    MappedTempFile() : _ptr(nullptr), _size(0) {}
+    ~MappedTempFile() { release(); }
+
+    /**
+     * Creates the region of the given size
+     * \param[in] directory Directory the temporary file is created in.
+     *                      If it is nullptr or empty then TMPDIR environment variable or /tmp is used
+     * \param[in] size      Size of the region in bytes
+     */
+    services::Status create(const char * directory, size_t size);
+
+    /* Unmaps the region and frees its disk space */
+    void release();
+
+    void * get() const { return _ptr; }
+    size_t size() const { return _size; }
+
+private:
+    MappedTempFile(const MappedTempFile &);
+    MappedTempFile & operator=(const MappedTempFile &);
+
+    void * _ptr;
+    size_t _size;
+};
+
+/**
+ * Maps the existing file into memory.
+ * The pages of the region are loaded on demand and shared with the page cache of the OS,
+ * so the processes that map the same file do not duplicate its data in the main memory.
+ * Writes to the region are private to the process and never reach the file.
+ * \param[in]  path  Path to the file
+ * \param[out] size  Size of the region in bytes
+ * \param[out] st    Status of the mapping
+ * \return Region of the file that is unmapped when the last reference to it is released
+ */
+services::SharedPtr<byte> mapFile(const char * path, size_t & size, services::Status & st);
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
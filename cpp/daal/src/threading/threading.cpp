@@ -34,6 +34,7 @@
     #include <tbb/scalable_allocator.h>
     #include <tbb/global_control.h>
     #include <tbb/task_arena.h>
+    #include <vector>
     #include "services/daal_atomic_int.h"
 
     #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
@@ -46,6 +47,134 @@ using namespace daal::services;
     #include "src/algorithms/service_qsort.h"
 #endif
 
+namespace
+{
+/* Computation scope of the temporary buffers of the thread, the threading primitives pass the scope
+   of the calling thread to the threads that run their bodies */
+thread_local void * threadScratchScope = nullptr;
+
+struct ScratchScopeGuard
+{
+    explicit ScratchScopeGuard(void * scope) : _previous(threadScratchScope) { threadScratchScope = scope; }
+    ~ScratchScopeGuard() { threadScratchScope = _previous; }
+
+    void * _previous;
+
+private:
+    ScratchScopeGuard(const ScratchScopeGuard &);
+    ScratchScopeGuard & operator=(const ScratchScopeGuard &);
+};
+} // namespace
+
+#if defined(__DO_TBB_LAYER__)
+namespace
+{
+/* NUMA nodes the arenas can be constrained to, empty if the TBBBind library is not available */
+std::vector<int> getNumaNodes()
+{
+    std::vector<int> result;
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (nodes[i] >= 0) result.push_back(nodes[i]);
+    }
+    #endif
+    return result;
+}
+
+bool isNumaNodeAvailable(int numaNode)
+{
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    /* Without the TBBBind library the only reported node is tbb::task_arena::automatic */
+    const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (nodes[i] == numaNode) return true;
+    }
+    #endif
+    return false;
+}
+
+tbb::task_arena * createTaskArena(int maxConcurrency, int numaNode)
+{
+    const int concurrency = (maxConcurrency > 0) ? maxConcurrency : tbb::task_arena::automatic;
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    tbb::task_arena::constraints constraints;
+    constraints.max_concurrency = concurrency;
+    if (numaNode >= 0) constraints.numa_id = numaNode;
+    return new tbb::task_arena(constraints);
+    #else
+    return new tbb::task_arena(concurrency);
+    #endif
+}
+
+/* Task arena the threading primitives called by the thread outside of parallel regions are executed in.
+ * The arenas the thread used are kept until the thread exits, so the repeated computations do not create them again */
+struct ThreadTaskArena
+{
+    struct CachedArena
+    {
+        int maxConcurrency;
+        int numaNode;
+        tbb::task_arena * arena;
+    };
+
+    tbb::task_arena * arena = nullptr;
+    std::vector<CachedArena> cachedArenas;
+    bool isActive = false;
+
+    ~ThreadTaskArena()
+    {
+        for (size_t i = 0; i < cachedArenas.size(); ++i) delete cachedArenas[i].arena;
+    }
+
+    /* Returns the arena with the given constraints, nullptr if the NUMA node is not available */
+    tbb::task_arena * getArena(int maxConcurrency, int numaNode)
+    {
+        if (maxConcurrency < 0) maxConcurrency = 0;
+        if (numaNode < 0) numaNode = -1;
+        for (size_t i = 0; i < cachedArenas.size(); ++i)
+        {
+            if (cachedArenas[i].maxConcurrency == maxConcurrency && cachedArenas[i].numaNode == numaNode) return cachedArenas[i].arena;
+        }
+        if (numaNode >= 0 && !isNumaNodeAvailable(numaNode)) return nullptr;
+
+        const CachedArena cached = { maxConcurrency, numaNode, createTaskArena(maxConcurrency, numaNode) };
+        cachedArenas.push_back(cached);
+        return cached.arena;
+    }
+};
+
+ThreadTaskArena & getThreadTaskArena()
+{
+    static thread_local ThreadTaskArena threadArena;
+    return threadArena;
+}
+
+/* Executes the function in the task arena of the calling thread if the thread is not already inside of it */
+template <typename F>
+void executeInThreadTaskArena(const F & f)
+{
+    ThreadTaskArena & threadArena = getThreadTaskArena();
+    if (!threadArena.arena || threadArena.isActive)
+    {
+        f();
+        return;
+    }
+
+    struct ActiveFlag
+    {
+        ActiveFlag(bool & flag) : _flag(flag) { _flag = true; }
+        ~ActiveFlag() { _flag = false; }
+        bool & _flag;
+    } activeFlag(threadArena.isActive);
+
+    threadArena.arena->execute(f);
+}
+} // namespace
+#endif
+
 DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -95,12 +224,16 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalCo
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
-        int i;
-        for (i = r.begin(); i < r.end(); i++)
-        {
-            func(i, a);
-        }
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
+            const ScratchScopeGuard guard(scope);
+            int i;
+            for (i = r.begin(); i < r.end(); i++)
+            {
+                func(i, a);
+            }
+        });
     });
 #elif defined(__DO_SEQ_LAYER__)
     int i;
@@ -114,12 +247,16 @@ DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a,
 DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::functype_int64 func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, n, 1), [&](tbb::blocked_range<int64_t> r) {
-        int64_t i;
-        for (i = r.begin(); i < r.end(); i++)
-        {
-            func(i, a);
-        }
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::parallel_for(tbb::blocked_range<int64_t>(0, n, 1), [&](tbb::blocked_range<int64_t> r) {
+            const ScratchScopeGuard guard(scope);
+            int64_t i;
+            for (i = r.begin(); i < r.end(); i++)
+            {
+                func(i, a);
+            }
+        });
     });
 #elif defined(__DO_SEQ_LAYER__)
     int64_t i;
@@ -133,16 +270,20 @@ DAAL_EXPORT void _daal_threader_for_int64(int64_t n, const void * a, daal::funct
 DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(
-        tbb::blocked_range<int>(0, n, 1),
-        [&](tbb::blocked_range<int> r) {
-            int i;
-            for (i = r.begin(); i < r.end(); i++)
-            {
-                func(i, a);
-            }
-        },
-        tbb::simple_partitioner {});
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, n, 1),
+            [&](tbb::blocked_range<int> r) {
+                const ScratchScopeGuard guard(scope);
+                int i;
+                for (i = r.begin(); i < r.end(); i++)
+                {
+                    func(i, a);
+                }
+            },
+            tbb::simple_partitioner {});
+    });
 #elif defined(__DO_SEQ_LAYER__)
     int i;
     for (i = 0; i < n; i++)
@@ -155,12 +296,16 @@ DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const voi
 DAAL_EXPORT void _daal_threader_for_int32ptr(const int * begin, const int * end, const void * a, daal::functype_int32ptr func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<const int *>(begin, end, 1), [&](tbb::blocked_range<const int *> r) {
-        const int * i;
-        for (i = r.begin(); i != r.end(); i++)
-        {
-            func(i, a);
-        }
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::parallel_for(tbb::blocked_range<const int *>(begin, end, 1), [&](tbb::blocked_range<const int *> r) {
+            const ScratchScopeGuard guard(scope);
+            const int * i;
+            for (i = r.begin(); i != r.end(); i++)
+            {
+                func(i, a);
+            }
+        });
     });
 #elif defined(__DO_SEQ_LAYER__)
     const int * i;
@@ -175,10 +320,18 @@ DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64(int32_t n, int64_t init, c
                                                       const void * b, daal::reduction_functype_int64 reduction_func)
 {
 #if defined(__DO_TBB_LAYER__)
-    return tbb::parallel_reduce(
-        tbb::blocked_range<int32_t>(0, n), init,
-        [&](const tbb::blocked_range<int32_t> & r, int64_t value_for_reduce) { return loop_func(r.begin(), r.end(), value_for_reduce, a); },
-        [&](int64_t x, int64_t y) { return reduction_func(x, y, b); }, tbb::auto_partitioner {});
+    int64_t result = init;
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        result = tbb::parallel_reduce(
+            tbb::blocked_range<int32_t>(0, n), init,
+            [&](const tbb::blocked_range<int32_t> & r, int64_t value_for_reduce) {
+                const ScratchScopeGuard guard(scope);
+                return loop_func(r.begin(), r.end(), value_for_reduce, a);
+            },
+            [&](int64_t x, int64_t y) { return reduction_func(x, y, b); }, tbb::auto_partitioner {});
+    });
+    return result;
 
 #elif defined(__DO_SEQ_LAYER__)
     int64_t value_for_reduce = init;
@@ -190,10 +343,18 @@ DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64_simple(int32_t n, int64_t
                                                              const void * b, daal::reduction_functype_int64 reduction_func)
 {
 #if defined(__DO_TBB_LAYER__)
-    return tbb::parallel_reduce(
-        tbb::blocked_range<int32_t>(0, n), init,
-        [&](const tbb::blocked_range<int32_t> & r, int64_t value_for_reduce) { return loop_func(r.begin(), r.end(), value_for_reduce, a); },
-        [&](int64_t x, int64_t y) { return reduction_func(x, y, b); }, tbb::simple_partitioner {});
+    int64_t result = init;
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        result = tbb::parallel_reduce(
+            tbb::blocked_range<int32_t>(0, n), init,
+            [&](const tbb::blocked_range<int32_t> & r, int64_t value_for_reduce) {
+                const ScratchScopeGuard guard(scope);
+                return loop_func(r.begin(), r.end(), value_for_reduce, a);
+            },
+            [&](int64_t x, int64_t y) { return reduction_func(x, y, b); }, tbb::simple_partitioner {});
+    });
+    return result;
 
 #elif defined(__DO_SEQ_LAYER__)
     int64_t value_for_reduce = init;
@@ -206,10 +367,18 @@ DAAL_EXPORT int64_t _daal_parallel_reduce_int32ptr_int64_simple(const int32_t *
                                                                 daal::reduction_functype_int64 reduction_func)
 {
 #if defined(__DO_TBB_LAYER__)
-    return tbb::parallel_reduce(
-        tbb::blocked_range<const int32_t *>(begin, end), init,
-        [&](const tbb::blocked_range<const int32_t *> & r, int64_t value_for_reduce) { return loop_func(r.begin(), r.end(), value_for_reduce, a); },
-        [&](int64_t x, int64_t y) { return reduction_func(x, y, b); }, tbb::simple_partitioner {});
+    int64_t result = init;
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        result = tbb::parallel_reduce(
+            tbb::blocked_range<const int32_t *>(begin, end), init,
+            [&](const tbb::blocked_range<const int32_t *> & r, int64_t value_for_reduce) {
+                const ScratchScopeGuard guard(scope);
+                return loop_func(r.begin(), r.end(), value_for_reduce, a);
+            },
+            [&](int64_t x, int64_t y) { return reduction_func(x, y, b); }, tbb::simple_partitioner {});
+    });
+    return result;
 
 #elif defined(__DO_SEQ_LAYER__)
     int64_t value_for_reduce = init;
@@ -223,19 +392,23 @@ DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::funct
     const size_t nthreads           = _daal_threader_get_max_threads();
     const size_t nblocks_per_thread = n / nthreads + !!(n % nthreads);
 
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, nthreads, 1),
-        [&](tbb::blocked_range<size_t> r) {
-            const size_t tid   = r.begin();
-            const size_t begin = tid * nblocks_per_thread;
-            const size_t end   = n < begin + nblocks_per_thread ? n : begin + nblocks_per_thread;
-
-            for (size_t i = begin; i < end; ++i)
-            {
-                func(i, tid, a);
-            }
-        },
-        tbb::static_partitioner());
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, nthreads, 1),
+            [&](tbb::blocked_range<size_t> r) {
+                const ScratchScopeGuard guard(scope);
+                const size_t tid   = r.begin();
+                const size_t begin = tid * nblocks_per_thread;
+                const size_t end   = n < begin + nblocks_per_thread ? n : begin + nblocks_per_thread;
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    func(i, tid, a);
+                }
+            },
+            tbb::static_partitioner());
+    });
 #elif defined(__DO_SEQ_LAYER__)
     for (size_t i = 0; i < n; i++)
     {
@@ -248,7 +421,7 @@ template <typename F>
 DAAL_EXPORT void _daal_parallel_sort_template(F * begin_p, F * end_p)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_sort(begin_p, end_p);
+    executeInThreadTaskArena([&]() { tbb::parallel_sort(begin_p, end_p); });
 #elif defined(__DO_SEQ_LAYER__)
     daal::algorithms::internal::qSort<F>(end_p - begin_p, begin_p);
 #endif
@@ -268,7 +441,13 @@ DAAL_PARALLEL_SORT_IMPL(daal::IdxValType<double>, pair_fp64_uint64)
 DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) { func(r.begin(), r.end() - r.begin(), a); });
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
+            const ScratchScopeGuard guard(scope);
+            func(r.begin(), r.end() - r.begin(), a);
+        });
+    });
 #elif defined(__DO_SEQ_LAYER__)
     func(0, n, a);
 #endif
@@ -297,19 +476,23 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
 DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::task_group_context context;
-    tbb::parallel_for(
-        tbb::blocked_range<int>(0, n, 1),
-        [&](tbb::blocked_range<int> r) {
-            int i;
-            for (i = r.begin(); i < r.end(); ++i)
-            {
-                bool needBreak = false;
-                func(i, needBreak, a);
-                if (needBreak) context.cancel_group_execution();
-            }
-        },
-        context);
+    void * const scope = threadScratchScope;
+    executeInThreadTaskArena([&]() {
+        tbb::task_group_context context;
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, n, 1),
+            [&](tbb::blocked_range<int> r) {
+                const ScratchScopeGuard guard(scope);
+                int i;
+                for (i = r.begin(); i < r.end(); ++i)
+                {
+                    bool needBreak = false;
+                    func(i, needBreak, a);
+                    if (needBreak) context.cancel_group_execution();
+                }
+            },
+            context);
+    });
 #elif defined(__DO_SEQ_LAYER__)
     int i;
     for (i = 0; i < n; ++i)
@@ -324,6 +507,8 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
 #if defined(__DO_TBB_LAYER__)
+    const ThreadTaskArena & threadArena = getThreadTaskArena();
+    if (threadArena.arena && !threadArena.isActive) return threadArena.arena->max_concurrency();
     return tbb::this_task_arena::max_concurrency();
 #elif defined(__DO_SEQ_LAYER__)
     return 1;
@@ -398,8 +583,12 @@ DAAL_EXPORT void _daal_parallel_reduce_tls(void * tlsPtr, void * a, daal::tls_re
         {
             size_t i = 0;
             for (auto it = p->begin(); it != p->end(); ++it) aDataPtr[i++] = *it;
-            tbb::parallel_for(tbb::blocked_range<size_t>(0, n, 1), [&](tbb::blocked_range<size_t> r) {
-                for (size_t i = r.begin(); i < r.end(); i++) func(aDataPtr[i], a);
+            void * const scope = threadScratchScope;
+            executeInThreadTaskArena([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, n, 1), [&](tbb::blocked_range<size_t> r) {
+                    const ScratchScopeGuard guard(scope);
+                    for (size_t i = r.begin(); i < r.end(); i++) func(aDataPtr[i], a);
+                });
             });
             ::free(aDataPtr);
         }
@@ -452,6 +641,70 @@ DAAL_EXPORT bool _daal_is_in_parallel()
 #endif
 }
 
+DAAL_EXPORT void * _daal_get_scratch_scope()
+{
+    return threadScratchScope;
+}
+
+DAAL_EXPORT void _daal_set_scratch_scope(void * scope)
+{
+    threadScratchScope = scope;
+}
+
+DAAL_EXPORT void * _daal_get_task_arena(int maxConcurrency, int numaNode)
+{
+#if defined(__DO_TBB_LAYER__)
+    return getThreadTaskArena().getArena(maxConcurrency, numaNode);
+#else
+    return nullptr;
+#endif
+}
+
+DAAL_EXPORT size_t _daal_get_numa_nodes_number()
+{
+#if defined(__DO_TBB_LAYER__)
+    static const size_t nNodes = getNumaNodes().size();
+    return nNodes;
+#else
+    return 0;
+#endif
+}
+
+DAAL_EXPORT int _daal_get_numa_node_id(size_t iNode)
+{
+#if defined(__DO_TBB_LAYER__)
+    static const std::vector<int> nodes = getNumaNodes();
+    return (iNode < nodes.size()) ? nodes[iNode] : -1;
+#else
+    return -1;
+#endif
+}
+
+DAAL_EXPORT void * _daal_set_thread_task_arena(void * taskArena)
+{
+#if defined(__DO_TBB_LAYER__)
+    ThreadTaskArena & threadArena = getThreadTaskArena();
+    void * previous               = threadArena.arena;
+    threadArena.arena             = static_cast<tbb::task_arena *>(taskArena);
+    return previous;
+#else
+    return nullptr;
+#endif
+}
+
+DAAL_EXPORT bool _daal_set_thread_task_arena_limits(int maxConcurrency, int numaNode)
+{
+    if (maxConcurrency <= 0 && numaNode < 0)
+    {
+        _daal_set_thread_task_arena(nullptr);
+        return true;
+    }
+    void * taskArena = _daal_get_task_arena(maxConcurrency, numaNode);
+    if (!taskArena && numaNode >= 0) return false;
+    _daal_set_thread_task_arena(taskArena);
+    return true;
+}
+
 DAAL_EXPORT void * _daal_threader_env()
 {
     static daal::ThreaderEnvironment env;
@@ -780,13 +1033,13 @@ DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t)
     {
         typedef Atomic<int> RefCounterType;
 
-        shared_task(daal::task & t) : _t(t), _nRefs(nullptr)
+        shared_task(daal::task & t) : _t(t), _nRefs(nullptr), _scope(threadScratchScope)
         {
             _nRefs = new RefCounterType;
             (*_nRefs).set(1);
         }
 
-        shared_task(const shared_task & o) : _t(o._t), _nRefs(o._nRefs) { (*_nRefs).inc(); }
+        shared_task(const shared_task & o) : _t(o._t), _nRefs(o._nRefs), _scope(o._scope) { (*_nRefs).inc(); }
 
         ~shared_task()
         {
@@ -797,21 +1050,26 @@ DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t)
             }
         }
 
-        void operator()() const { _t.run(); }
+        void operator()() const
+        {
+            const ScratchScopeGuard guard(_scope);
+            _t.run();
+        }
 
         daal::task & _t;
         RefCounterType * _nRefs;
+        void * _scope;
 
     private:
         shared_task & operator=(const shared_task &);
     };
     tbb::task_group * group = (tbb::task_group *)taskGroupPtr;
-    group->run(shared_task(*t));
+    executeInThreadTaskArena([&]() { group->run(shared_task(*t)); });
 }
 
 DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
 {
-    ((tbb::task_group *)taskGroupPtr)->wait();
+    executeInThreadTaskArena([&]() { ((tbb::task_group *)taskGroupPtr)->wait(); });
 }
 
 #else
@@ -99,6 +99,15 @@ extern "C"
     DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t);
     DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr);
 
+    DAAL_EXPORT void * _daal_get_scratch_scope();
+    DAAL_EXPORT void _daal_set_scratch_scope(void * scope);
+
+    DAAL_EXPORT size_t _daal_get_numa_nodes_number();
+    DAAL_EXPORT int _daal_get_numa_node_id(size_t iNode);
+    DAAL_EXPORT void * _daal_get_task_arena(int maxConcurrency, int numaNode);
+    DAAL_EXPORT void * _daal_set_thread_task_arena(void * taskArena);
+    DAAL_EXPORT bool _daal_set_thread_task_arena_limits(int maxConcurrency, int numaNode);
+
     DAAL_EXPORT void _daal_tbb_task_scheduler_free(void *& globalControl);
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalControl);
 
@@ -584,6 +593,97 @@ void conditional_static_threader_for(const bool inParallel, const size_t n, Func
     }
 }
 
+/* Maximal number of partial results in threader_reduce_deterministic() */
+const size_t deterministic_reduce_max_chunks = 256;
+/* Minimal number of partial results if they are limited by deterministic_reduce_max_bytes */
+const size_t deterministic_reduce_min_chunks = 16;
+/* Memory for the partial results in threader_reduce_deterministic() the number of chunks is limited by */
+const size_t deterministic_reduce_max_bytes = 64 * 1024 * 1024;
+
+/**
+ * Returns the maximal number of chunks for threader_reduce_deterministic() with the partial results of the given size,
+ * so that the partial results of wide data sets take at most deterministic_reduce_max_bytes of memory.
+ * The number depends only on the size of the partial result, so the order of the reduction does not depend on the number of threads
+ *
+ * \param[in] partialSize  Size of one partial result in bytes
+ */
+inline size_t threader_reduce_deterministic_max_chunks(size_t partialSize)
+{
+    if (!partialSize) return deterministic_reduce_max_chunks;
+    const size_t nChunks = deterministic_reduce_max_bytes / partialSize;
+    if (nChunks < deterministic_reduce_min_chunks) return deterministic_reduce_min_chunks;
+    return (nChunks < deterministic_reduce_max_chunks) ? nChunks : deterministic_reduce_max_chunks;
+}
+
+/**
+ * Reduces the partial results computed over the blocks [0, nBlocks) in the order that does not depend on the number of threads.
+ * The blocks are split into at most maxChunks contiguous chunks whose boundaries depend only on nBlocks and maxChunks.
+ * Each chunk is processed sequentially into its own partial result, then the partial results are merged pairwise
+ * along a balanced binary tree over the chunk indices. Hence the result is bitwise identical for any number of threads.
+ *
+ * \param[in] nBlocks    Number of blocks
+ * \param[in] create     F create(): returns new empty partial result or null if it cannot be created.
+ *                       The blocks of the chunk without partial result are skipped, so create() reports such failure to the caller
+ * \param[in] process    void process(F partial, size_t iBlock): accumulates the block in the partial result
+ * \param[in] merge      void merge(F dst, F src): merges src into dst and releases src
+ * \param[in] maxChunks  Maximal number of partial results, see threader_reduce_deterministic_max_chunks()
+ * \return Partial result that accumulates all the blocks,
+ *         null if no partial result was created or the memory for the partial results cannot be allocated
+ */
+template <typename F, typename CreateType, typename ProcessType, typename MergeType>
+F threader_reduce_deterministic(size_t nBlocks, const CreateType & create, const ProcessType & process, const MergeType & merge,
+                                size_t maxChunks = deterministic_reduce_max_chunks)
+{
+    if (!nBlocks) return nullptr;
+
+    if (!maxChunks) maxChunks = 1;
+    const size_t nChunks = (nBlocks < maxChunks) ? nBlocks : maxChunks;
+
+    F * partials = static_cast<F *>(threaded_scalable_malloc(nChunks * sizeof(F), DAAL_MALLOC_DEFAULT_ALIGNMENT));
+    if (!partials) return nullptr;
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        partials[iChunk] = nullptr;
+    }
+
+    threader_for(nChunks, nChunks, [&](size_t iChunk) {
+        const size_t iBlockBegin = iChunk * nBlocks / nChunks;
+        const size_t iBlockEnd   = (iChunk + 1) * nBlocks / nChunks;
+
+        partials[iChunk] = create();
+        if (!partials[iChunk]) return;
+
+        for (size_t iBlock = iBlockBegin; iBlock < iBlockEnd; ++iBlock)
+        {
+            process(partials[iChunk], iBlock);
+        }
+    });
+
+    for (size_t stride = 1; stride < nChunks; stride *= 2)
+    {
+        const size_t nPairs = (nChunks + stride - 1) / (2 * stride);
+        threader_for(nPairs, nPairs, [&](size_t iPair) {
+            const size_t iDst = 2 * stride * iPair;
+            const size_t iSrc = iDst + stride;
+            if (!partials[iSrc]) return;
+
+            if (partials[iDst])
+            {
+                merge(partials[iDst], partials[iSrc]);
+            }
+            else
+            {
+                partials[iDst] = partials[iSrc];
+            }
+            partials[iSrc] = nullptr;
+        });
+    }
+
+    F result = partials[0];
+    threaded_scalable_free(partials);
+    return result;
+}
+
 } // namespace daal
 
 #endif
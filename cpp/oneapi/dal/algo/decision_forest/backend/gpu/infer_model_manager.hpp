@@ -68,6 +68,11 @@ public:
               ctx_(ctx) {
         const daal_model_impl_t* const daal_model_ptr = get_daal_model(model);
 
+        // The trees of the mapped model are not stored in the tables
+        if (daal_model_ptr->isMapped()) {
+            throw domain_error(dal::detail::error_messages::mapped_model_is_not_supported_on_gpu());
+        }
+
         ONEDAL_ASSERT(dal::detail::integral_cast<size_t>(ctx_.tree_count) ==
                       daal_model_ptr->size());
 
@@ -0,0 +1,306 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#include <daal/include/data_management/data/data_archive.h>
+#include <daal/include/services/internal/status_to_error_id.h>
+#include <daal/src/algorithms/dtrees/forest/classification/df_classification_model_impl.h>
+#include <daal/src/algorithms/dtrees/forest/regression/df_regression_model_impl.h>
+
+#include "oneapi/dal/algo/decision_forest/train.hpp"
+#include "oneapi/dal/algo/decision_forest/infer.hpp"
+#include "oneapi/dal/algo/decision_forest/backend/model_impl.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+
+namespace oneapi::dal::decision_forest::test {
+
+namespace df = dal::decision_forest;
+namespace te = dal::test::engine;
+namespace daal_df = daal::algorithms::decision_forest;
+
+/// Unique path in the temporary directory, the file is removed when the path goes out of scope
+class temp_file_path {
+public:
+    temp_file_path() {
+        static std::atomic<std::uint64_t> counter{ 0 };
+        const auto name = "df_mapped_model_test_" + std::to_string(std::random_device{}()) + "_" +
+                          std::to_string(counter++) + ".bin";
+        path_ = (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    ~temp_file_path() {
+        std::remove(path_.c_str());
+    }
+
+    temp_file_path(const temp_file_path&) = delete;
+    temp_file_path& operator=(const temp_file_path&) = delete;
+
+    const char* get() const {
+        return path_.c_str();
+    }
+
+private:
+    std::string path_;
+};
+
+template <typename Task>
+struct daal_mapped_model_types;
+
+template <>
+struct daal_mapped_model_types<df::task::classification> {
+    using daal_model_t = daal_df::classification::Model;
+    using daal_model_impl_t = daal_df::classification::internal::ModelImpl;
+    using model_interop_t = df::backend::model_interop_cls;
+};
+
+template <>
+struct daal_mapped_model_types<df::task::regression> {
+    using daal_model_t = daal_df::regression::Model;
+    using daal_model_impl_t = daal_df::regression::internal::ModelImpl;
+    using model_interop_t = df::backend::model_interop_reg;
+};
+
+template <typename TestType>
+class df_mapped_model_test : public te::algo_fixture {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+    using Task = std::tuple_element_t<2, TestType>;
+    using daal_model_t = typename daal_mapped_model_types<Task>::daal_model_t;
+    using daal_model_impl_t = typename daal_mapped_model_types<Task>::daal_model_impl_t;
+    using model_interop_t = typename daal_mapped_model_types<Task>::model_interop_t;
+
+    bool is_gpu() {
+        return get_policy().is_gpu();
+    }
+
+    bool not_available_on_device() {
+        constexpr bool is_dense = std::is_same_v<Method, decision_forest::method::dense>;
+        return get_policy().is_gpu() && is_dense;
+    }
+
+    auto get_default_descriptor() {
+        auto desc = df::descriptor<Float, Method, Task>{}.set_tree_count(10);
+        if constexpr (std::is_same_v<Task, df::task::classification>) {
+            desc.set_class_count(2);
+        }
+        return desc;
+    }
+
+    auto get_train_data() {
+        constexpr std::int64_t row_count_train = 6;
+        constexpr std::int64_t column_count = 2;
+
+        static const float x_train[] = { -2.f, -1.f, -1.f, -1.f, -1.f, -2.f,
+                                         +1.f, +1.f, +1.f, +2.f, +2.f, +1.f };
+        static const float y_train[] = { 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+
+        const auto x_train_table = dal::homogen_table::wrap(x_train, row_count_train, column_count);
+        const auto y_train_table = dal::homogen_table::wrap(y_train, row_count_train, 1);
+
+        return std::make_tuple(x_train_table, y_train_table);
+    }
+
+    daal::services::SharedPtr<daal_model_t> get_daal_model(const df::model<Task>& model) {
+        const auto interop = dal::detail::get_impl(model).get_interop();
+        REQUIRE(interop);
+        return static_cast<const model_interop_t*>(interop)->get_model();
+    }
+
+    /// Writes the model to the flat file and returns the model mapped from this file
+    daal::services::SharedPtr<daal_model_t> map_daal_model(const df::model<Task>& model) {
+        // The mapping keeps the pages of the file after the file is removed
+        const temp_file_path path;
+        REQUIRE(get_daal_model(model)->writeFile(path.get()).ok());
+
+        daal::services::Status st;
+        const auto mapped_model = daal_model_t::createFromFile(path.get(), &st);
+        REQUIRE(st.ok());
+        REQUIRE(mapped_model);
+        return mapped_model;
+    }
+
+    /// Returns the content of the flat file the model is written to
+    std::vector<char> get_model_file_content(const df::model<Task>& model) {
+        const temp_file_path path;
+        REQUIRE(get_daal_model(model)->writeFile(path.get()).ok());
+
+        std::ifstream file(path.get(), std::ios::binary);
+        REQUIRE(file.is_open());
+        return std::vector<char>(std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>());
+    }
+
+    void check_model_file_is_rejected(const std::vector<char>& content) {
+        const temp_file_path path;
+        {
+            std::ofstream file(path.get(), std::ios::binary);
+            REQUIRE(file.is_open());
+            file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+
+        daal::services::Status st;
+        daal_model_t::createFromFile(path.get(), &st);
+        REQUIRE_FALSE(st.ok());
+        REQUIRE(daal::services::internal::get_error_id(st) ==
+                daal::services::ErrorDFIncorrectModelFileFormat);
+    }
+
+    /// Serializes the model into the archive and deserializes the new model from it
+    daal::services::SharedPtr<daal_model_t> serialize_daal_model(
+        const daal::services::SharedPtr<daal_model_t>& daal_model) {
+        daal::data_management::InputDataArchive input_archive;
+        daal_model->serialize(input_archive);
+        REQUIRE(input_archive.getErrors()->size() == 0);
+
+        std::vector<daal::byte> buffer(input_archive.getSizeOfArchive());
+        REQUIRE(buffer.size() > 0);
+        input_archive.copyArchiveToArray(buffer.data(), buffer.size());
+
+        daal::data_management::OutputDataArchive output_archive(buffer.data(), buffer.size());
+        const daal::services::SharedPtr<daal_model_t> restored_model(new daal_model_impl_t());
+        restored_model->deserialize(output_archive);
+        REQUIRE(output_archive.getErrors()->size() == 0);
+        return restored_model;
+    }
+
+    /// Creates the model over the mapped model with the same properties as the trained model
+    df::model<Task> wrap_daal_model(const daal::services::SharedPtr<daal_model_t>& daal_model,
+                                    const df::model<Task>& model) {
+        const auto impl =
+            std::make_shared<detail::model_impl<Task>>(new model_interop_t{ daal_model });
+        impl->tree_count = daal_model->getNumberOfTrees();
+        impl->class_count = dal::detail::get_impl(model).class_count;
+        return dal::detail::make_private<df::model<Task>>(impl);
+    }
+
+    void check_model_is_read_only(const daal::services::SharedPtr<daal_model_t>& daal_model) {
+        const std::size_t tree_count = daal_model->getNumberOfTrees();
+        auto daal_model_impl = static_cast<daal_model_impl_t*>(daal_model.get());
+
+        const typename daal_model_impl_t::TreeType tree;
+        REQUIRE_FALSE(daal_model_impl->add(tree, 2, 0).ok());
+        REQUIRE_FALSE(daal_model_impl->resize(tree_count));
+        REQUIRE(daal_model->getNumberOfTrees() == tree_count);
+    }
+};
+
+using df_mapped_model_types = _TE_COMBINE_TYPES_3((float, double),
+                                                  (df::method::dense, df::method::hist),
+                                                  (df::task::classification,
+                                                   df::task::regression));
+
+#define DF_MAPPED_MODEL_TEST(name) \
+    TEMPLATE_LIST_TEST_M(df_mapped_model_test, name, "[df][mapped]", df_mapped_model_types)
+
+DF_MAPPED_MODEL_TEST("mapped model cannot be modified") {
+    SKIP_IF(this->not_available_on_device());
+    const auto [x, y] = this->get_train_data();
+    const auto desc = this->get_default_descriptor();
+    const auto model = this->train(desc, x, y).get_model();
+    this->check_model_is_read_only(this->map_daal_model(model));
+}
+
+DF_MAPPED_MODEL_TEST("mapped model infers the same responses on CPU") {
+    SKIP_IF(this->is_gpu());
+    const auto [x, y] = this->get_train_data();
+    const auto desc = this->get_default_descriptor();
+    const auto model = this->train(desc, x, y).get_model();
+    const auto mapped_model = this->wrap_daal_model(this->map_daal_model(model), model);
+
+    const auto responses = this->infer(desc, model, x).get_responses();
+    const auto mapped_responses = this->infer(desc, mapped_model, x).get_responses();
+    const auto diff = te::abs_error(responses, mapped_responses);
+    CHECK(diff == 0.0);
+}
+
+DF_MAPPED_MODEL_TEST("truncated model file is rejected") {
+    SKIP_IF(this->not_available_on_device());
+    const auto [x, y] = this->get_train_data();
+    const auto desc = this->get_default_descriptor();
+    const auto model = this->train(desc, x, y).get_model();
+    const auto content = this->get_model_file_content(model);
+    REQUIRE(content.size() > 16);
+
+    // The header is cut
+    this->check_model_file_is_rejected(std::vector<char>(content.begin(), content.begin() + 16));
+    // The arrays of the last tree do not fit into the file
+    this->check_model_file_is_rejected(std::vector<char>(content.begin(), content.end() - 1));
+}
+
+DF_MAPPED_MODEL_TEST("corrupted model file is rejected") {
+    SKIP_IF(this->not_available_on_device());
+    const auto [x, y] = this->get_train_data();
+    const auto desc = this->get_default_descriptor();
+    const auto model = this->train(desc, x, y).get_model();
+    const auto content = this->get_model_file_content(model);
+
+    auto corrupted_signature = content;
+    corrupted_signature[0] = static_cast<char>(~corrupted_signature[0]);
+    this->check_model_file_is_rejected(corrupted_signature);
+
+    // The 64-byte header is followed by the table of trees, the offset of the nodes
+    // of the first tree is its second 64-bit field. The offset points past the end of the file
+    constexpr std::size_t nodes_offset_position = 64 + 8;
+    REQUIRE(content.size() > nodes_offset_position + 8);
+    auto corrupted_offset = content;
+    std::fill_n(corrupted_offset.begin() + nodes_offset_position, 8, static_cast<char>(0x7f));
+    this->check_model_file_is_rejected(corrupted_offset);
+}
+
+DF_MAPPED_MODEL_TEST("mapped model is serialized with its trees") {
+    SKIP_IF(this->is_gpu());
+    const auto [x, y] = this->get_train_data();
+    const auto desc = this->get_default_descriptor();
+    const auto model = this->train(desc, x, y).get_model();
+    const auto daal_mapped_model = this->map_daal_model(model);
+    const auto restored_model =
+        this->wrap_daal_model(this->serialize_daal_model(daal_mapped_model), model);
+    REQUIRE(this->get_daal_model(restored_model)->getNumberOfTrees() ==
+            daal_mapped_model->getNumberOfTrees());
+
+    const auto responses = this->infer(desc, model, x).get_responses();
+    const auto restored_responses = this->infer(desc, restored_model, x).get_responses();
+    CHECK(te::abs_error(responses, restored_responses) == 0.0);
+
+    // The mapped model keeps its trees after it is serialized
+    const auto mapped_model = this->wrap_daal_model(daal_mapped_model, model);
+    const auto mapped_responses = this->infer(desc, mapped_model, x).get_responses();
+    CHECK(te::abs_error(responses, mapped_responses) == 0.0);
+}
+
+DF_MAPPED_MODEL_TEST("infer throws if mapped model is used on GPU") {
+    SKIP_IF(!this->is_gpu());
+    SKIP_IF(this->not_available_on_device());
+    const auto [x, y] = this->get_train_data();
+    const auto desc = this->get_default_descriptor();
+    const auto model = this->train(desc, x, y).get_model();
+    const auto mapped_model = this->wrap_daal_model(this->map_daal_model(model), model);
+
+    REQUIRE_THROWS_AS(this->infer(desc, mapped_model, x), domain_error);
+}
+
+} // namespace oneapi::dal::decision_forest::test
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <daal/include/algorithms/decision_forest/decision_forest_classification_training_batch.h>
+#include <daal/include/algorithms/decision_forest/decision_forest_classification_predict.h>
+#include <daal/include/algorithms/decision_forest/decision_forest_regression_training_batch.h>
+#include <daal/include/algorithms/decision_forest/decision_forest_regression_predict.h>
+#include <daal/include/data_management/data/homogen_numeric_table.h>
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::decision_forest::test {
+
+namespace daal_df = daal::algorithms::decision_forest;
+namespace daal_dm = daal::data_management;
+namespace daal_cls_train = daal_df::classification::training;
+namespace daal_cls_infer = daal_df::classification::prediction;
+namespace daal_reg_train = daal_df::regression::training;
+namespace daal_reg_infer = daal_df::regression::prediction;
+
+template <typename Float>
+class df_out_of_core_test {
+public:
+    using daal_table_t = daal_dm::HomogenNumericTable<Float>;
+
+    static constexpr std::size_t row_count = 2000;
+    static constexpr std::size_t column_count = 4;
+    static constexpr std::size_t class_count = 2;
+    static constexpr std::size_t tree_count = 10;
+
+    /// The temporary files are mapped with POSIX mmap only
+    bool not_available_on_system() {
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__APPLE__)
+        return false;
+#else
+        return true;
+#endif
+    }
+
+    daal_dm::NumericTablePtr get_data() {
+        const auto x =
+            daal_table_t::create(column_count, row_count, daal_dm::NumericTable::doAllocate);
+        REQUIRE(x);
+        Float* x_ptr = x->getArray();
+        for (std::size_t i = 0; i < row_count; i++) {
+            for (std::size_t j = 0; j < column_count; j++) {
+                x_ptr[i * column_count + j] = Float((i * 37 + j * 101) % 997) / Float(997);
+            }
+        }
+        return x;
+    }
+
+    daal_dm::NumericTablePtr get_labels(const daal_dm::NumericTablePtr& x) {
+        const auto y = daal_table_t::create(1, row_count, daal_dm::NumericTable::doAllocate);
+        REQUIRE(y);
+        const Float* x_ptr = static_cast<daal_table_t*>(x.get())->getArray();
+        Float* y_ptr = y->getArray();
+        for (std::size_t i = 0; i < row_count; i++) {
+            y_ptr[i] = (x_ptr[i * column_count] + x_ptr[i * column_count + 1] > Float(1)) ? 1 : 0;
+        }
+        return y;
+    }
+
+    template <daal_cls_train::Method Method>
+    daal_dm::NumericTablePtr train_and_infer_cls(const daal_dm::NumericTablePtr& x,
+                                                 const daal_dm::NumericTablePtr& y,
+                                                 bool out_of_core) {
+        daal_cls_train::Batch<Float, Method> train(class_count);
+        train.parameter().nTrees = tree_count;
+        train.parameter().outOfCoreMode = out_of_core;
+        train.input.set(daal::algorithms::classifier::training::data, x);
+        train.input.set(daal::algorithms::classifier::training::labels, y);
+        REQUIRE(train.compute().ok());
+
+        daal_cls_infer::Batch<Float> infer(class_count);
+        infer.input.set(daal::algorithms::classifier::prediction::data, x);
+        infer.input.set(daal::algorithms::classifier::prediction::model,
+                        train.getResult()->get(daal::algorithms::classifier::training::model));
+        REQUIRE(infer.compute().ok());
+        return infer.getResult()->get(daal::algorithms::classifier::prediction::prediction);
+    }
+
+    template <daal_reg_train::Method Method>
+    daal_dm::NumericTablePtr train_and_infer_reg(const daal_dm::NumericTablePtr& x,
+                                                 const daal_dm::NumericTablePtr& y,
+                                                 bool out_of_core) {
+        daal_reg_train::Batch<Float, Method> train;
+        train.parameter().nTrees = tree_count;
+        train.parameter().outOfCoreMode = out_of_core;
+        train.input.set(daal_reg_train::data, x);
+        train.input.set(daal_reg_train::dependentVariable, y);
+        REQUIRE(train.compute().ok());
+
+        daal_reg_infer::Batch<Float> infer;
+        infer.input.set(daal_reg_infer::data, x);
+        infer.input.set(daal_reg_infer::model, train.getResult()->get(daal_reg_train::model));
+        REQUIRE(infer.compute().ok());
+        return infer.getResult()->get(daal_reg_infer::prediction);
+    }
+
+    void check_responses_are_equal(const daal_dm::NumericTablePtr& expected,
+                                   const daal_dm::NumericTablePtr& actual) {
+        REQUIRE(expected->getNumberOfRows() == row_count);
+        REQUIRE(actual->getNumberOfRows() == row_count);
+
+        daal_dm::BlockDescriptor<Float> expected_block;
+        daal_dm::BlockDescriptor<Float> actual_block;
+        expected->getBlockOfRows(0, row_count, daal_dm::readOnly, expected_block);
+        actual->getBlockOfRows(0, row_count, daal_dm::readOnly, actual_block);
+        std::size_t mismatch_count = 0;
+        for (std::size_t i = 0; i < row_count; i++) {
+            mismatch_count +=
+                (expected_block.getBlockPtr()[i] != actual_block.getBlockPtr()[i]) ? 1 : 0;
+        }
+        expected->releaseBlockOfRows(expected_block);
+        actual->releaseBlockOfRows(actual_block);
+        CHECK(mismatch_count == 0);
+    }
+};
+
+#define DF_OUT_OF_CORE_TEST(name) \
+    TEMPLATE_TEST_M(df_out_of_core_test, name, "[df][out_of_core]", float, double)
+
+DF_OUT_OF_CORE_TEST("out-of-core classification training builds the same forest") {
+    SKIP_IF(this->not_available_on_system());
+    const auto x = this->get_data();
+    const auto y = this->get_labels(x);
+
+    this->check_responses_are_equal(
+        this->template train_and_infer_cls<daal_cls_train::defaultDense>(x, y, false),
+        this->template train_and_infer_cls<daal_cls_train::defaultDense>(x, y, true));
+    this->check_responses_are_equal(
+        this->template train_and_infer_cls<daal_cls_train::hist>(x, y, false),
+        this->template train_and_infer_cls<daal_cls_train::hist>(x, y, true));
+}
+
+DF_OUT_OF_CORE_TEST("out-of-core regression training builds the same forest") {
+    SKIP_IF(this->not_available_on_system());
+    const auto x = this->get_data();
+    const auto y = this->get_labels(x);
+
+    this->check_responses_are_equal(
+        this->template train_and_infer_reg<daal_reg_train::defaultDense>(x, y, false),
+        this->template train_and_infer_reg<daal_reg_train::defaultDense>(x, y, true));
+    this->check_responses_are_equal(
+        this->template train_and_infer_reg<daal_reg_train::hist>(x, y, false),
+        this->template train_and_infer_reg<daal_reg_train::hist>(x, y, true));
+}
+
+DF_OUT_OF_CORE_TEST("out-of-core training fails if temporary file cannot be created") {
+    SKIP_IF(this->not_available_on_system());
+    const auto x = this->get_data();
+    const auto y = this->get_labels(x);
+
+    daal_cls_train::Batch<TestType, daal_cls_train::hist> train(this->class_count);
+    train.parameter().nTrees = this->tree_count;
+    train.parameter().outOfCoreMode = true;
+    train.parameter().outOfCoreDirectory = "/nonexistent/df_out_of_core_test";
+    train.input.set(daal::algorithms::classifier::training::data, x);
+    train.input.set(daal::algorithms::classifier::training::labels, y);
+    REQUIRE_FALSE(train.compute().ok());
+}
+
+} // namespace oneapi::dal::decision_forest::test
@@ -0,0 +1,310 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "oneapi/dal/algo/jaccard/common.hpp"
+#include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
+#include "oneapi/dal/algo/jaccard/detail/service.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+#include "oneapi/dal/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/container.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+
+namespace oneapi::dal::preview::jaccard::backend {
+
+struct similar_vertex {
+    float coeff;
+    std::int32_t vertex;
+};
+
+/// Returns true if the vertex a is more similar to the row vertex than the vertex b,
+/// the ties are broken by the lower vertex index
+ONEDAL_FORCEINLINE bool is_more_similar(const similar_vertex &a, const similar_vertex &b) {
+    return a.coeff > b.coeff || (a.coeff == b.coeff && a.vertex < b.vertex);
+}
+
+/// Returns the upper bound of the Jaccard coefficient of two vertices with the given degrees:
+/// the intersection is not greater than the lower degree and the union is not lower than
+/// the higher one
+ONEDAL_FORCEINLINE float degree_ratio_bound(std::int32_t u_degree, std::int32_t v_degree) {
+    const std::int32_t min_degree = detail::min(u_degree, v_degree);
+    const std::int32_t max_degree = detail::max(u_degree, v_degree);
+    return (max_degree > 0) ? float(min_degree) / float(max_degree) : 1.0f;
+}
+
+/// Returns the number of the rarest neighbors of the vertex such that every vertex with
+/// the Jaccard coefficient not lower than the threshold shares at least one of them.
+/// Such a vertex has at least ceil(threshold * degree) common neighbors with the vertex.
+/// The overlap is relaxed to stay conservative under the rounding of float coefficients.
+ONEDAL_FORCEINLINE std::int32_t compute_prefix_size(std::int32_t degree, double threshold) {
+    const double min_overlap = std::ceil(threshold * degree * (1.0 - 1e-6));
+    const std::int64_t prefix_size = degree - static_cast<std::int64_t>(min_overlap) + 1;
+    return static_cast<std::int32_t>(
+        std::min<std::int64_t>(std::max<std::int64_t>(prefix_size, 0), degree));
+}
+
+struct jaccard_pruned_thread_state {
+    using int32_vector = dal::preview::detail::vector_container<std::int32_t>;
+    using similar_vertex_vector = dal::preview::detail::vector_container<similar_vertex>;
+
+    int32_vector prefix;
+    int32_vector candidates;
+    similar_vertex_vector top;
+    similar_vertex_vector result;
+};
+
+/// Computes the Jaccard coefficients of the vertex pairs in the block that are either not
+/// lower than the threshold or among the top-k most similar pairs of their row.
+/// The candidate pairs are generated from the prefix filtering index if the threshold is set,
+/// otherwise from the 2-hop neighborhood of the row vertex, and are filtered by the degree
+/// ratio bound before the neighbor lists are intersected.
+template <typename Cpu>
+vertex_similarity_result<task::all_vertex_pairs> jaccard_pruned(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int32_t> &t,
+    caching_builder &result_builder) {
+    const auto row_begin = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_begin());
+    const auto row_end = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_end());
+    const auto column_begin =
+        dal::detail::integral_cast<std::int32_t>(desc.get_column_range_begin());
+    const auto column_end = dal::detail::integral_cast<std::int32_t>(desc.get_column_range_end());
+    const double threshold = desc.get_threshold();
+    const std::int64_t top_k = desc.get_top_k();
+    const std::int32_t row_count = row_end - row_begin;
+    const std::int32_t column_count = column_end - column_begin;
+    const std::int64_t vertex_count = t.get_vertex_count();
+
+    auto degree = [&](std::int32_t vertex) -> std::int32_t {
+        return static_cast<std::int32_t>(t.get_vertex_degree(vertex));
+    };
+    auto is_rarer = [&](std::int32_t a, std::int32_t b) {
+        const std::int32_t a_degree = degree(a);
+        const std::int32_t b_degree = degree(b);
+        return a_degree < b_degree || (a_degree == b_degree && a < b);
+    };
+
+    // The prefix filtering index maps the vertex to the column vertices that have it
+    // among their rarest neighbors
+    auto index_offsets = array<std::int64_t>::empty(vertex_count + 1);
+    auto index_vertices = array<std::int32_t>::empty(1);
+    std::int64_t *index_offsets_ptr = index_offsets.get_mutable_data();
+    if (threshold > 0.0) {
+        auto prefix_offsets = array<std::int64_t>::empty(column_count + 1);
+        std::int64_t *prefix_offsets_ptr = prefix_offsets.get_mutable_data();
+        prefix_offsets_ptr[0] = 0;
+        for (std::int32_t i = 0; i < column_count; ++i) {
+            prefix_offsets_ptr[i + 1] =
+                prefix_offsets_ptr[i] + compute_prefix_size(degree(column_begin + i), threshold);
+        }
+        const std::int64_t prefix_total = prefix_offsets_ptr[column_count];
+
+        auto prefixes = array<std::int32_t>::empty(std::max<std::int64_t>(prefix_total, 1));
+        std::int32_t *prefixes_ptr = prefixes.get_mutable_data();
+        dal::detail::threader_for(column_count, column_count, [&](std::int32_t i) {
+            const std::int32_t v = column_begin + i;
+            std::partial_sort_copy(t.get_vertex_neighbors_begin(v),
+                                   t.get_vertex_neighbors_end(v),
+                                   prefixes_ptr + prefix_offsets_ptr[i],
+                                   prefixes_ptr + prefix_offsets_ptr[i + 1],
+                                   is_rarer);
+        });
+
+        std::fill(index_offsets_ptr, index_offsets_ptr + vertex_count + 1, 0);
+        for (std::int64_t k = 0; k < prefix_total; ++k) {
+            ++index_offsets_ptr[prefixes_ptr[k] + 1];
+        }
+        for (std::int64_t w = 0; w < vertex_count; ++w) {
+            index_offsets_ptr[w + 1] += index_offsets_ptr[w];
+        }
+
+        // The column vertices are appended in the increasing order, so the lists of the index
+        // stay sorted; the offsets are shifted by one list while filling and restored after
+        index_vertices = array<std::int32_t>::empty(std::max<std::int64_t>(prefix_total, 1));
+        std::int32_t *index_vertices_ptr = index_vertices.get_mutable_data();
+        for (std::int32_t i = 0; i < column_count; ++i) {
+            for (std::int64_t k = prefix_offsets_ptr[i]; k < prefix_offsets_ptr[i + 1]; ++k) {
+                index_vertices_ptr[index_offsets_ptr[prefixes_ptr[k]]++] = column_begin + i;
+            }
+        }
+        for (std::int64_t w = vertex_count; w > 0; --w) {
+            index_offsets_ptr[w] = index_offsets_ptr[w - 1];
+        }
+        index_offsets_ptr[0] = 0;
+    }
+    const std::int32_t *index_vertices_ptr = index_vertices.get_data();
+
+    const std::int32_t thread_count = dal::detail::threader_get_max_threads();
+    auto states = std::make_unique<jaccard_pruned_thread_state[]>(thread_count);
+
+    auto row_threads = array<std::int32_t>::empty(std::max<std::int32_t>(row_count, 1));
+    auto row_offsets = array<std::int64_t>::empty(std::max<std::int32_t>(row_count, 1));
+    auto row_sizes = array<std::int64_t>::empty(std::max<std::int32_t>(row_count, 1));
+    std::int32_t *row_threads_ptr = row_threads.get_mutable_data();
+    std::int64_t *row_offsets_ptr = row_offsets.get_mutable_data();
+    std::int64_t *row_sizes_ptr = row_sizes.get_mutable_data();
+
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        const std::int32_t thread_id = dal::detail::threader_get_current_thread_index();
+        auto &state = states[thread_id];
+        const std::int32_t u = row_begin + i;
+        const std::int32_t u_degree = degree(u);
+        const auto u_neighbors = t.get_vertex_neighbors_begin(u);
+
+        auto &candidates = state.candidates;
+        candidates.resize(0);
+        if (threshold > 0.0) {
+            auto &prefix = state.prefix;
+            prefix.resize(compute_prefix_size(u_degree, threshold));
+            std::partial_sort_copy(u_neighbors,
+                                   u_neighbors + u_degree,
+                                   prefix.begin(),
+                                   prefix.end(),
+                                   is_rarer);
+            for (std::int64_t p = 0; p < prefix.size(); ++p) {
+                const std::int32_t w = prefix[p];
+                for (std::int64_t k = index_offsets_ptr[w]; k < index_offsets_ptr[w + 1]; ++k) {
+                    const std::int32_t v = index_vertices_ptr[k];
+                    if (degree_ratio_bound(u_degree, degree(v)) >= threshold) {
+                        candidates.push_back(v);
+                    }
+                }
+            }
+        }
+        else {
+            for (std::int32_t p = 0; p < u_degree; ++p) {
+                const std::int32_t w = u_neighbors[p];
+                const auto w_neighbors = t.get_vertex_neighbors_begin(w);
+                const std::int32_t w_degree = degree(w);
+                for (std::int32_t q = 0; q < w_degree; ++q) {
+                    const std::int32_t v = w_neighbors[q];
+                    if (v >= column_begin && v < column_end) {
+                        candidates.push_back(v);
+                    }
+                }
+            }
+        }
+        if (u >= column_begin && u < column_end) {
+            candidates.push_back(u);
+        }
+        std::sort(candidates.begin(), candidates.end());
+        const std::int64_t candidate_count =
+            std::unique(candidates.begin(), candidates.end()) - candidates.begin();
+
+        auto compute_coeff = [&](std::int32_t v) -> float {
+            if (v == u) {
+                return 1.0f;
+            }
+            const std::int32_t v_degree = degree(v);
+            const std::int64_t intersection_value =
+                preview::backend::intersection<Cpu>(u_neighbors,
+                                                    t.get_vertex_neighbors_begin(v),
+                                                    u_degree,
+                                                    v_degree);
+            return float(intersection_value) /
+                   float(u_degree + v_degree - intersection_value);
+        };
+
+        auto &result = state.result;
+        row_threads_ptr[i] = thread_id;
+        row_offsets_ptr[i] = result.size();
+        if (top_k == 0) {
+            for (std::int64_t k = 0; k < candidate_count; ++k) {
+                const float coeff = compute_coeff(candidates[k]);
+                if (coeff > 0.0f && coeff >= threshold) {
+                    result.push_back(similar_vertex{ coeff, candidates[k] });
+                }
+            }
+        }
+        else {
+            // The candidates with the higher degree ratio bound are evaluated first, so the
+            // search stops once the bound drops below the k-th best coefficient
+            std::sort(candidates.begin(),
+                      candidates.begin() + candidate_count,
+                      [&](std::int32_t a, std::int32_t b) {
+                          return is_more_similar(
+                              similar_vertex{ degree_ratio_bound(u_degree, degree(a)), a },
+                              similar_vertex{ degree_ratio_bound(u_degree, degree(b)), b });
+                      });
+            auto &top = state.top;
+            top.resize(0);
+            for (std::int64_t k = 0; k < candidate_count; ++k) {
+                const std::int32_t v = candidates[k];
+                if (top.size() == top_k && degree_ratio_bound(u_degree, degree(v)) < top[0].coeff) {
+                    break;
+                }
+                const similar_vertex item{ compute_coeff(v), v };
+                if (!(item.coeff > 0.0f && item.coeff >= threshold)) {
+                    continue;
+                }
+                if (top.size() < top_k) {
+                    top.push_back(item);
+                    std::push_heap(top.begin(), top.end(), is_more_similar);
+                }
+                else if (is_more_similar(item, top[0])) {
+                    std::pop_heap(top.begin(), top.end(), is_more_similar);
+                    top[top.size() - 1] = item;
+                    std::push_heap(top.begin(), top.end(), is_more_similar);
+                }
+            }
+            std::sort_heap(top.begin(), top.end(), is_more_similar);
+            for (std::int64_t k = 0; k < top.size(); ++k) {
+                result.push_back(top[k]);
+            }
+        }
+        row_sizes_ptr[i] = result.size() - row_offsets_ptr[i];
+    });
+
+    auto output_offsets = array<std::int64_t>::empty(row_count + 1);
+    std::int64_t *output_offsets_ptr = output_offsets.get_mutable_data();
+    output_offsets_ptr[0] = 0;
+    for (std::int32_t i = 0; i < row_count; ++i) {
+        output_offsets_ptr[i + 1] = output_offsets_ptr[i] + row_sizes_ptr[i];
+        ONEDAL_ASSERT(output_offsets_ptr[i + 1] >= 0, "Overflow found in sum of two values");
+    }
+    const std::int64_t nnz = output_offsets_ptr[row_count];
+    if (nnz == 0) {
+        return vertex_similarity_result<task::all_vertex_pairs>();
+    }
+
+    void *result_ptr = result_builder(detail::compute_max_block_size<float, std::int32_t>(nnz));
+    std::int32_t *first_vertices = reinterpret_cast<std::int32_t *>(result_ptr);
+    std::int32_t *second_vertices = first_vertices + nnz;
+    float *jaccard = reinterpret_cast<float *>(second_vertices + nnz);
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        const auto &result = states[row_threads_ptr[i]].result;
+        for (std::int64_t k = 0; k < row_sizes_ptr[i]; ++k) {
+            const similar_vertex &item = result[row_offsets_ptr[i] + k];
+            const std::int64_t position = output_offsets_ptr[i] + k;
+            first_vertices[position] = row_begin + i;
+            second_vertices[position] = item.vertex;
+            jaccard[position] = item.coeff;
+        }
+    });
+
+    return vertex_similarity_result(
+        homogen_table::wrap(first_vertices, nnz, 2, data_layout::column_major),
+        homogen_table::wrap(jaccard, nnz, 1, data_layout::column_major),
+        nnz);
+}
+
+} // namespace oneapi::dal::preview::jaccard::backend
@@ -0,0 +1,26 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_pruned_kernel.hpp"
+
+namespace oneapi::dal::preview::jaccard::backend {
+
+template vertex_similarity_result<task::all_vertex_pairs> jaccard_pruned<__CPU_TAG__>(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int32_t> &t,
+    caching_builder &result_builder);
+
+} // namespace oneapi::dal::preview::jaccard::backend
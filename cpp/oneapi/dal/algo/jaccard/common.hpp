@@ -60,12 +60,16 @@ public:
     auto get_row_range_end() const -> std::int64_t;
     auto get_column_range_begin() const -> std::int64_t;
     auto get_column_range_end() const -> std::int64_t;
+    auto get_threshold() const -> double;
+    auto get_top_k() const -> std::int64_t;
 
 protected:
     void set_row_range_impl(std::int64_t begin, std::int64_t end);
     void set_column_range_impl(std::int64_t begin, std::int64_t end);
     void set_block_impl(const std::initializer_list<std::int64_t>& row_range,
                         const std::initializer_list<std::int64_t>& column_range);
+    void set_threshold_impl(double value);
+    void set_top_k_impl(std::int64_t value);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -113,6 +117,33 @@ public:
         return base_t::get_column_range_end();
     }
 
+    /// The minimum Jaccard similarity coefficient of the vertex pairs in the result.
+    /// The pairs below the threshold are pruned by the degree ratio bound and the
+    /// prefix filtering before the neighbor lists are intersected.
+    /// The value of zero keeps all the pairs with non-zero coefficients.
+    /// @invariant :expr:`0.0 <= threshold <= 1.0`
+    double get_threshold() const {
+        return base_t::get_threshold();
+    }
+
+    auto& set_threshold(double value) {
+        base_t::set_threshold_impl(value);
+        return *this;
+    }
+
+    /// The maximum number of the most similar vertices returned for each row of the block.
+    /// The pairs of the row are ordered by the decreasing Jaccard similarity coefficient,
+    /// the ties are ordered by the column index. The value of zero keeps all the pairs.
+    /// @invariant :expr:`top_k >= 0`
+    std::int64_t get_top_k() const {
+        return base_t::get_top_k();
+    }
+
+    auto& set_top_k(std::int64_t value) {
+        base_t::set_top_k_impl(value);
+        return *this;
+    }
+
     /// Sets the range of the rows of the graph block for Jaccard similarity computation
     ///
     /// @param [in] begin  The begin of the row of the graph block
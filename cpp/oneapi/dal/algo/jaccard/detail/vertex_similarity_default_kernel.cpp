@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_default_kernel.hpp"
+#include "oneapi/dal/algo/jaccard/backend/cpu/vertex_similarity_pruned_kernel.hpp"
 #include "oneapi/dal/algo/jaccard/detail/vertex_similarity_default_kernel.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
@@ -33,7 +34,26 @@ operator()(const dal::detail::host_policy& ctx,
     });
 }
 
+template <typename Float>
+vertex_similarity_result<task::all_vertex_pairs>
+vertex_similarity<Float,
+                  task::all_vertex_pairs,
+                  dal::preview::detail::topology<std::int32_t>,
+                  pruned>::operator()(const dal::detail::host_policy& ctx,
+                                      const detail::descriptor_base<task::all_vertex_pairs>& desc,
+                                      const dal::preview::detail::topology<std::int32_t>& t,
+                                      caching_builder& result_builder) {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ ctx }, [&](auto cpu) {
+        return backend::jaccard_pruned<decltype(cpu)>(desc, t, result_builder);
+    });
+}
+
 template struct ONEDAL_EXPORT
     vertex_similarity<float, task::all_vertex_pairs, dal::preview::detail::topology<std::int32_t>>;
 
+template struct ONEDAL_EXPORT vertex_similarity<float,
+                                                task::all_vertex_pairs,
+                                                dal::preview::detail::topology<std::int32_t>,
+                                                pruned>;
+
 } // namespace oneapi::dal::preview::jaccard::detail
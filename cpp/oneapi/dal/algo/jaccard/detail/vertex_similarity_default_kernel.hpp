@@ -42,6 +42,20 @@ struct vertex_similarity<Float,
         void* result_ptr);
 };
 
+struct pruned {};
+
+template <typename Float>
+struct vertex_similarity<Float,
+                         task::all_vertex_pairs,
+                         dal::preview::detail::topology<std::int32_t>,
+                         pruned> {
+    vertex_similarity_result<task::all_vertex_pairs> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::all_vertex_pairs>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        caching_builder& result_builder);
+};
+
 template <typename Float, typename Method, typename Task, typename Topology>
 struct vertex_similarity_kernel_cpu {
     vertex_similarity_result<Task> operator()(const dal::detail::host_policy& ctx,
@@ -66,6 +80,10 @@ struct vertex_similarity_kernel_cpu<float, method::fast, task::all_vertex_pairs,
         if (number_elements_in_block == 0) {
             return vertex_similarity_result<task::all_vertex_pairs>();
         }
+        if (desc.get_top_k() > 0 || desc.get_threshold() > 0.0) {
+            using kernel_t = vertex_similarity<float, task::all_vertex_pairs, Topology, pruned>;
+            return kernel_t()(ctx, desc, t, result_builder);
+        }
         const std::int64_t max_block_size = compute_max_block_size<
             typename detail::descriptor_base<task::all_vertex_pairs>::float_t,
             std::int32_t>(number_elements_in_block);
@@ -76,6 +76,15 @@ struct vertex_similarity_ops {
             column_end >= dal::detail::limits<std::int32_t>::max()) {
             throw invalid_argument(msg::range_idx_gt_max_int32());
         }
+        if (param.get_threshold() < 0.0) {
+            throw invalid_argument(msg::threshold_lt_zero());
+        }
+        if (param.get_threshold() > 1.0) {
+            throw invalid_argument(msg::threshold_gt_one());
+        }
+        if (param.get_top_k() < 0) {
+            throw invalid_argument(msg::top_k_lt_zero());
+        }
     }
 
     template <typename Policy>
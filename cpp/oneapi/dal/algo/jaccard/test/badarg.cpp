@@ -78,6 +78,19 @@ public:
         const auto result_vertex_similarity =
             oneapi::dal::preview::vertex_similarity(jaccard_desc, g, builder);
     }
+
+    void check_pruned_vertex_similarity(double threshold, std::int64_t top_k) {
+        const auto jaccard_desc = dal::preview::jaccard::descriptor<>()
+                                      .set_block({ 0, 2 }, { 0, 3 })
+                                      .set_threshold(threshold)
+                                      .set_top_k(top_k);
+        const auto g = create_graph();
+
+        dal::preview::jaccard::caching_builder builder;
+
+        const auto result_vertex_similarity =
+            oneapi::dal::preview::vertex_similarity(jaccard_desc, g, builder);
+    }
 };
 
 #define JACCARD_BADARG_TEST(name) TEST_M(jaccard_badarg_test, name, "[jaccard][badarg]")
@@ -106,4 +119,21 @@ JACCARD_BADARG_TEST("throws if block ranges is greater than vertex count") {
     REQUIRE_THROWS_AS(this->check_vertex_similarity(0, 8, 0, 8), out_of_range);
 }
 
+JACCARD_BADARG_TEST("accepts threshold in [0, 1] and non-negative top_k") {
+    REQUIRE_NOTHROW(this->check_pruned_vertex_similarity(0.0, 0));
+    REQUIRE_NOTHROW(this->check_pruned_vertex_similarity(1.0, 2));
+}
+
+JACCARD_BADARG_TEST("throws if threshold is negative") {
+    REQUIRE_THROWS_AS(this->check_pruned_vertex_similarity(-0.5, 0), invalid_argument);
+}
+
+JACCARD_BADARG_TEST("throws if threshold is greater than one") {
+    REQUIRE_THROWS_AS(this->check_pruned_vertex_similarity(1.5, 0), invalid_argument);
+}
+
+JACCARD_BADARG_TEST("throws if top_k is negative") {
+    REQUIRE_THROWS_AS(this->check_pruned_vertex_similarity(0.0, -1), invalid_argument);
+}
+
 } // namespace oneapi::dal::algo::jaccard::test
@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
 #include "oneapi/dal/table/homogen.hpp"
@@ -135,6 +137,20 @@ public:
                                           24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34 };
 };
 
+class irregular_graph_type : public graph_base_data {
+public:
+    irregular_graph_type() {
+        vertex_count = 8;
+        edge_count = 13;
+        cols_count = edge_count * 2;
+        rows_count = vertex_count + 1;
+    }
+    std::array<std::int32_t, 8> degrees = { 4, 3, 5, 3, 2, 4, 3, 2 };
+    std::array<std::int32_t, 26> cols = { 1, 2, 3, 4, 0, 2, 5, 0, 1, 3, 5, 6, 0,
+                                          2, 7, 0, 5, 1, 2, 4, 6, 2, 5, 7, 3, 6 };
+    std::array<std::int64_t, 9> rows = { 0, 4, 7, 12, 15, 17, 21, 24, 26 };
+};
+
 class jaccard_test {
 public:
     template <typename GraphType>
@@ -228,6 +244,80 @@ public:
         const std::int64_t nonzero_coeff_count = result_vertex_similarity.get_nonzero_coeff_count();
         REQUIRE(nonzero_coeff_count == 0);
     }
+
+    template <typename GraphType>
+    void check_pruned_jaccard(const std::initializer_list<std::int64_t> &row_range,
+                              const std::initializer_list<std::int64_t> &column_range,
+                              double threshold,
+                              std::int64_t top_k) {
+        GraphType graph_data;
+        const auto g = create_graph<GraphType>();
+        const auto jaccard_desc = dal::preview::jaccard::descriptor<>()
+                                      .set_block(row_range, column_range)
+                                      .set_threshold(threshold)
+                                      .set_top_k(top_k);
+        dal::preview::jaccard::caching_builder builder;
+        const auto result_vertex_similarity =
+            dal::preview::vertex_similarity(jaccard_desc, g, builder);
+
+        // The expected pairs are computed by the exhaustive search over the block
+        struct expected_pair {
+            std::int32_t first;
+            std::int32_t second;
+            float coeff;
+        };
+        std::vector<expected_pair> expected_pairs;
+        for (std::int32_t u = *row_range.begin(); u < *(row_range.begin() + 1); ++u) {
+            std::vector<expected_pair> row_pairs;
+            for (std::int32_t v = *column_range.begin(); v < *(column_range.begin() + 1); ++v) {
+                const auto u_begin = graph_data.cols.begin() + graph_data.rows[u];
+                const auto u_end = graph_data.cols.begin() + graph_data.rows[u + 1];
+                const auto v_begin = graph_data.cols.begin() + graph_data.rows[v];
+                const auto v_end = graph_data.cols.begin() + graph_data.rows[v + 1];
+                std::vector<std::int32_t> common;
+                std::set_intersection(u_begin, u_end, v_begin, v_end, std::back_inserter(common));
+                const std::int64_t intersection = common.size();
+                const std::int64_t union_size =
+                    graph_data.degrees[u] + graph_data.degrees[v] - intersection;
+                const float coeff = (u == v) ? 1.0f : float(intersection) / float(union_size);
+                if (coeff > 0.0f && coeff >= threshold) {
+                    row_pairs.push_back({ u, v, coeff });
+                }
+            }
+            if (top_k > 0) {
+                std::stable_sort(row_pairs.begin(),
+                                 row_pairs.end(),
+                                 [](const expected_pair &a, const expected_pair &b) {
+                                     return a.coeff > b.coeff;
+                                 });
+                if (static_cast<std::int64_t>(row_pairs.size()) > top_k) {
+                    row_pairs.resize(top_k);
+                }
+            }
+            expected_pairs.insert(expected_pairs.end(), row_pairs.begin(), row_pairs.end());
+        }
+
+        UNSCOPED_INFO("The number of non-zero jaccard coefficients was determined incorrectly");
+        const std::int64_t nonzero_coeff_count = result_vertex_similarity.get_nonzero_coeff_count();
+        REQUIRE(nonzero_coeff_count == static_cast<std::int64_t>(expected_pairs.size()));
+        if (nonzero_coeff_count == 0) {
+            return;
+        }
+
+        auto vertex_pairs_table = result_vertex_similarity.get_vertex_pairs();
+        homogen_table &vertex_pairs = static_cast<homogen_table &>(vertex_pairs_table);
+        const auto vertex_pairs_data = vertex_pairs.get_data<int>();
+        auto coeffs_table = result_vertex_similarity.get_coeffs();
+        homogen_table &coeffs = static_cast<homogen_table &>(coeffs_table);
+        const auto jaccard_coeffs_data = coeffs.get_data<float>();
+        for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
+            UNSCOPED_INFO("Pairs of vertices were found wrong");
+            REQUIRE(vertex_pairs_data[i] == expected_pairs[i].first);
+            REQUIRE(vertex_pairs_data[i + nonzero_coeff_count] == expected_pairs[i].second);
+            UNSCOPED_INFO("Jaccard coefficients are not correct");
+            REQUIRE(Approx(jaccard_coeffs_data[i]) == expected_pairs[i].coeff);
+        }
+    }
 };
 
 // TEST_M(jaccard_test,
@@ -420,6 +510,39 @@ TEST_M(jaccard_test, "Zero jaccard coeffs graph, row of 32 elements, right of th
     this->check_jaccard_zero_coeffs_only<>(jaccard_desc, g);
 }
 
+TEST_M(jaccard_test, "Irregular graph, pairs above the threshold") {
+    for (double threshold : { 0.1, 0.25, 0.4, 0.5, 0.75, 1.0 }) {
+        this->check_pruned_jaccard<irregular_graph_type>({ 0, 8 }, { 0, 8 }, threshold, 0);
+        this->check_pruned_jaccard<irregular_graph_type>({ 2, 6 }, { 1, 5 }, threshold, 0);
+    }
+}
+
+TEST_M(jaccard_test, "Irregular graph, top-k most similar vertices") {
+    for (std::int64_t top_k : { 1, 2, 3, 100 }) {
+        this->check_pruned_jaccard<irregular_graph_type>({ 0, 8 }, { 0, 8 }, 0.0, top_k);
+        this->check_pruned_jaccard<irregular_graph_type>({ 2, 6 }, { 1, 5 }, 0.0, top_k);
+    }
+}
+
+TEST_M(jaccard_test, "Irregular graph, top-k most similar vertices above the threshold") {
+    for (double threshold : { 0.2, 0.4, 0.6 }) {
+        for (std::int64_t top_k : { 1, 2, 4 }) {
+            this->check_pruned_jaccard<irregular_graph_type>({ 0, 8 }, { 0, 8 }, threshold, top_k);
+            this->check_pruned_jaccard<irregular_graph_type>({ 3, 7 }, { 0, 6 }, threshold, top_k);
+        }
+    }
+}
+
+TEST_M(jaccard_test, "Complete graph, top-k most similar vertices") {
+    this->check_pruned_jaccard<complete_graph_33_type>({ 0, 33 }, { 0, 33 }, 0.0, 3);
+    this->check_pruned_jaccard<complete_graph_33_type>({ 30, 33 }, { 0, 20 }, 0.5, 5);
+}
+
+TEST_M(jaccard_test, "Zero jaccard coeffs graph, pairs above the threshold") {
+    this->check_pruned_jaccard<zero_jaccard_coeff_graph_type>({ 0, 34 }, { 0, 34 }, 0.5, 0);
+    this->check_pruned_jaccard<zero_jaccard_coeff_graph_type>({ 0, 1 }, { 1, 34 }, 0.5, 2);
+}
+
 TEST_M(jaccard_test, "Null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block({ 0, 0 }, { 0, 0 });
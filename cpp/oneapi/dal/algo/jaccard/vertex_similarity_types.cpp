@@ -22,7 +22,7 @@ class detail::vertex_similarity_result_impl : public base {
 public:
     table coeffs;
     table vertex_pairs;
-    std::int64_t nonzero_coeff_count;
+    std::int64_t nonzero_coeff_count = 0;
 };
 
 using detail::vertex_similarity_result_impl;
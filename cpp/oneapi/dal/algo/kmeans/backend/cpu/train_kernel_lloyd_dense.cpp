@@ -127,6 +127,7 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     interop::status_to_exception(
         interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
+                                                                           nullptr,
                                                                            input,
                                                                            output,
                                                                            &par));
@@ -0,0 +1,358 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <optional>
+
+#include "oneapi/dal/algo/shortest_paths/backend/cpu/traverse_default_kernel.hpp"
+
+namespace oneapi::dal::preview::shortest_paths::backend {
+using namespace oneapi::dal::preview::detail;
+using namespace oneapi::dal::preview::backend;
+
+/// In-edges of the graph in CSR format, the in-neighbors of every vertex are sorted
+/// in ascending order. Required by the bottom-up steps of BFS on directed graphs.
+class transposed_topology {
+public:
+    using vertex_type = std::int32_t;
+
+    transposed_topology(const dal::preview::detail::topology<std::int32_t>& t,
+                        byte_alloc_iface* alloc_ptr)
+            : vertex_allocator_(alloc_ptr),
+              edge_allocator_(alloc_ptr),
+              vertex_count_(t.get_vertex_count()),
+              edge_count_(std::max(t._rows_ptr[t.get_vertex_count()], std::int64_t(1))) {
+        rows_ = allocate(edge_allocator_, vertex_count_ + 1);
+        cols_ = allocate(vertex_allocator_, edge_count_);
+
+        // in-degree of the vertex v is accumulated at rows_[v + 1]
+        dal::detail::threader_for(vertex_count_ + 1, vertex_count_ + 1, [&](vertex_type v) {
+            rows_[v] = 0;
+        });
+        dal::detail::threader_for(vertex_count_, vertex_count_, [&](vertex_type u) {
+            for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+                dal::detail::atomic_increment(rows_[t._cols_ptr[v_] + 1]);
+            }
+        });
+        for (std::int64_t v = 0; v < vertex_count_; v++) {
+            rows_[v + 1] += rows_[v];
+        }
+
+        std::int64_t* tails = allocate(edge_allocator_, vertex_count_);
+        dal::detail::threader_for(vertex_count_, vertex_count_, [&](vertex_type v) {
+            tails[v] = rows_[v];
+        });
+        dal::detail::threader_for(vertex_count_, vertex_count_, [&](vertex_type u) {
+            for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+                cols_[dal::detail::atomic_fetch_add(tails[t._cols_ptr[v_]])] = u;
+            }
+        });
+        deallocate(edge_allocator_, tails, vertex_count_);
+
+        dal::detail::threader_for(vertex_count_, vertex_count_, [&](vertex_type v) {
+            std::sort(cols_ + rows_[v], cols_ + rows_[v + 1]);
+        });
+    }
+
+    transposed_topology(const transposed_topology&) = delete;
+    transposed_topology& operator=(const transposed_topology&) = delete;
+
+    ~transposed_topology() {
+        deallocate(vertex_allocator_, cols_, edge_count_);
+        deallocate(edge_allocator_, rows_, vertex_count_ + 1);
+    }
+
+    const vertex_type* get_in_neighbors_begin(vertex_type v) const {
+        return cols_ + rows_[v];
+    }
+
+    const vertex_type* get_in_neighbors_end(vertex_type v) const {
+        return cols_ + rows_[v + 1];
+    }
+
+private:
+    inner_alloc<vertex_type> vertex_allocator_;
+    inner_alloc<std::int64_t> edge_allocator_;
+    std::int64_t vertex_count_;
+    std::int64_t edge_count_;
+    std::int64_t* rows_ = nullptr;
+    vertex_type* cols_ = nullptr;
+};
+
+constexpr std::int64_t bitmap_word_size = 64;
+
+inline bool test_bit(const std::uint64_t* bitmap, std::int64_t index) {
+    return (bitmap[index / bitmap_word_size] >> (index % bitmap_word_size)) & 1;
+}
+
+/// Expands the frontier from the vertices of the frontier queue (push direction).
+/// Every newly visited vertex is claimed by a single thread with the compare-and-swap on its
+/// distance, the predecessor is the least index among the frontier vertices pointing to it.
+/// Returns the number of the out-edges of the newly visited vertices.
+template <typename Topology, typename FrontierContainer, typename LocalFrontiers>
+inline std::int64_t top_down_step(const Topology& t,
+                                  const FrontierContainer& frontier,
+                                  std::int64_t frontier_size,
+                                  std::int32_t level,
+                                  std::int32_t* dist,
+                                  std::int32_t* pred,
+                                  LocalFrontiers& local_frontiers,
+                                  std::int64_t* local_counts,
+                                  std::int32_t thread_count) {
+    using vertex_type = std::int32_t;
+    const vertex_type unvisited = std::numeric_limits<vertex_type>::max();
+    const vertex_type next_level = level + 1;
+
+    dal::detail::threader_for(thread_count, thread_count, [&](std::int32_t thread_id) {
+        local_counts[thread_id] = 0;
+    });
+    dal::detail::threader_for_int64(frontier_size, [&](std::int64_t i) {
+        const vertex_type u = frontier[i];
+        const std::int32_t thread_id = dal::detail::threader_get_current_thread_index();
+        for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+            const vertex_type v = t._cols_ptr[v_];
+            vertex_type v_dist = dist[v];
+            if (v_dist == unvisited &&
+                dal::detail::atomic_compare_exchange(dist[v], v_dist, next_level)) {
+                v_dist = next_level;
+                local_frontiers[thread_id].push_back(v);
+                local_counts[thread_id] += t._rows_ptr[v + 1] - t._rows_ptr[v];
+            }
+            if (v_dist == next_level) {
+                dal::detail::atomic_min(pred[v], u);
+            }
+        }
+    });
+
+    std::int64_t scout_count = 0;
+    for (std::int32_t thread_id = 0; thread_id < thread_count; thread_id++) {
+        scout_count += local_counts[thread_id];
+    }
+    return scout_count;
+}
+
+/// Expands the frontier from the unvisited vertices (pull direction): every unvisited vertex
+/// looks for the first in-neighbor from the frontier bitmap and stops at it.
+/// The vertices are processed by whole bitmap words, so the words of the next frontier
+/// are written without synchronization. Returns the number of the newly visited vertices.
+inline std::int64_t bottom_up_step(const transposed_topology& in_edges,
+                                   std::int64_t vertex_count,
+                                   const std::uint64_t* frontier,
+                                   std::uint64_t* next_frontier,
+                                   std::int32_t level,
+                                   std::int32_t* dist,
+                                   std::int32_t* pred,
+                                   std::int64_t* local_counts,
+                                   std::int32_t thread_count) {
+    using vertex_type = std::int32_t;
+    const vertex_type unvisited = std::numeric_limits<vertex_type>::max();
+    const std::int64_t word_count = (vertex_count + bitmap_word_size - 1) / bitmap_word_size;
+
+    dal::detail::threader_for(thread_count, thread_count, [&](std::int32_t thread_id) {
+        local_counts[thread_id] = 0;
+    });
+    dal::detail::threader_for_int64(word_count, [&](std::int64_t word) {
+        const std::int64_t word_begin = word * bitmap_word_size;
+        const std::int64_t word_end = std::min(word_begin + bitmap_word_size, vertex_count);
+        std::uint64_t next_word = 0;
+        std::int64_t awake_count = 0;
+        for (std::int64_t v = word_begin; v < word_end; v++) {
+            if (dist[v] != unvisited) {
+                continue;
+            }
+            const vertex_type* u_end = in_edges.get_in_neighbors_end(v);
+            for (const vertex_type* u = in_edges.get_in_neighbors_begin(v); u != u_end; ++u) {
+                if (test_bit(frontier, *u)) {
+                    dist[v] = level + 1;
+                    pred[v] = *u;
+                    next_word |= std::uint64_t(1) << (v - word_begin);
+                    awake_count++;
+                    break;
+                }
+            }
+        }
+        next_frontier[word] = next_word;
+        if (awake_count > 0) {
+            const std::int32_t thread_id = dal::detail::threader_get_current_thread_index();
+            local_counts[thread_id] += awake_count;
+        }
+    });
+
+    std::int64_t awake_count = 0;
+    for (std::int32_t thread_id = 0; thread_id < thread_count; thread_id++) {
+        awake_count += local_counts[thread_id];
+    }
+    return awake_count;
+}
+
+/// Direction-optimizing breadth-first search [Beamer, Asanovic, Patterson, 2012].
+/// The frontier is expanded top-down from the queue while it is small and bottom-up from
+/// the bitmap while it has more out-edges than 1/alpha of the edges of the unvisited vertices,
+/// until it shrinks below 1/beta of the vertices.
+template <typename Cpu>
+struct bfs {
+    traverse_result<task::one_to_all> operator()(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        byte_alloc_iface* alloc_ptr) {
+        using vertex_type = std::int32_t;
+        using vertex_allocator_type = inner_alloc<vertex_type>;
+        using edge_allocator_type = inner_alloc<std::int64_t>;
+        using bitmap_allocator_type = inner_alloc<std::uint64_t>;
+
+        using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+        using v1a_t = inner_alloc<v1v_t>;
+        using v2v_t = vector_container<v1v_t, v1a_t>;
+
+        vertex_allocator_type vertex_allocator(alloc_ptr);
+        edge_allocator_type edge_allocator(alloc_ptr);
+        bitmap_allocator_type bitmap_allocator(alloc_ptr);
+        v1a_t v1a(alloc_ptr);
+
+        const std::int64_t alpha = 15;
+        const std::int64_t beta = 18;
+
+        const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
+        const auto vertex_count = t.get_vertex_count();
+        const std::int64_t edge_count = t._rows_ptr[vertex_count];
+        const std::int64_t word_count = (vertex_count + bitmap_word_size - 1) / bitmap_word_size;
+        const vertex_type unvisited = std::numeric_limits<vertex_type>::max();
+
+        auto dist_arr = array<vertex_type>::empty(vertex_count);
+        auto pred_arr = array<vertex_type>::empty(vertex_count);
+        vertex_type* dist = dist_arr.get_mutable_data();
+        vertex_type* pred = pred_arr.get_mutable_data();
+        dal::detail::threader_for(vertex_count, vertex_count, [&](vertex_type v) {
+            dist[v] = unvisited;
+            pred[v] = unvisited;
+        });
+        dist[source] = 0;
+
+        const std::int32_t thread_count = dal::detail::threader_get_max_threads();
+        std::int64_t* local_counts = allocate(edge_allocator, thread_count + 1);
+        v2v_t local_frontiers(thread_count, v1a);
+        auto get_local_frontier = [&](std::int32_t thread_id) -> v1v_t* {
+            return &local_frontiers[thread_id];
+        };
+
+        std::uint64_t* frontier_bitmap = allocate(bitmap_allocator, word_count);
+        std::uint64_t* next_frontier_bitmap = allocate(bitmap_allocator, word_count);
+        std::optional<transposed_topology> in_edges;
+
+        v1v_t frontier(1, vertex_allocator);
+        frontier[0] = source;
+        std::int64_t frontier_size = 1;
+        vertex_type level = 0;
+
+        std::int64_t edges_to_check = edge_count;
+        std::int64_t scout_count = t._rows_ptr[source + 1] - t._rows_ptr[source];
+
+        while (frontier_size > 0) {
+            if (scout_count > edges_to_check / alpha) {
+                if (!in_edges) {
+                    in_edges.emplace(t, alloc_ptr);
+                }
+                dal::detail::threader_for_int64(word_count, [&](std::int64_t word) {
+                    const std::int64_t word_begin = word * bitmap_word_size;
+                    const std::int64_t word_end =
+                        std::min(word_begin + bitmap_word_size, vertex_count);
+                    std::uint64_t frontier_word = 0;
+                    for (std::int64_t v = word_begin; v < word_end; v++) {
+                        if (dist[v] == level) {
+                            frontier_word |= std::uint64_t(1) << (v - word_begin);
+                        }
+                    }
+                    frontier_bitmap[word] = frontier_word;
+                });
+
+                std::int64_t awake_count = frontier_size;
+                std::int64_t old_awake_count = 0;
+                do {
+                    old_awake_count = awake_count;
+                    awake_count = bottom_up_step(*in_edges,
+                                                 vertex_count,
+                                                 frontier_bitmap,
+                                                 next_frontier_bitmap,
+                                                 level,
+                                                 dist,
+                                                 pred,
+                                                 local_counts,
+                                                 thread_count);
+                    std::swap(frontier_bitmap, next_frontier_bitmap);
+                    level++;
+                } while (awake_count >= old_awake_count || awake_count > vertex_count / beta);
+
+                dal::detail::threader_for_int64(word_count, [&](std::int64_t word) {
+                    std::uint64_t frontier_word = frontier_bitmap[word];
+                    if (frontier_word) {
+                        const std::int32_t thread_id =
+                            dal::detail::threader_get_current_thread_index();
+                        for (std::int64_t bit = 0; bit < bitmap_word_size; bit++) {
+                            if ((frontier_word >> bit) & 1) {
+                                local_frontiers[thread_id].push_back(
+                                    static_cast<vertex_type>(word * bitmap_word_size + bit));
+                            }
+                        }
+                    }
+                });
+                frontier_size =
+                    reduce_to_common_bin(thread_count, get_local_frontier, local_counts, frontier);
+                scout_count = 1;
+            }
+            else {
+                edges_to_check -= scout_count;
+                scout_count = top_down_step(t,
+                                            frontier,
+                                            frontier_size,
+                                            level,
+                                            dist,
+                                            pred,
+                                            local_frontiers,
+                                            local_counts,
+                                            thread_count);
+                frontier_size =
+                    reduce_to_common_bin(thread_count, get_local_frontier, local_counts, frontier);
+                level++;
+            }
+        }
+
+        dal::detail::threader_for(vertex_count, vertex_count, [&](vertex_type v) {
+            if (pred[v] == unvisited) {
+                pred[v] = -1;
+            }
+        });
+
+        in_edges.reset();
+        deallocate(bitmap_allocator, next_frontier_bitmap, word_count);
+        deallocate(bitmap_allocator, frontier_bitmap, word_count);
+        deallocate(edge_allocator, local_counts, thread_count + 1);
+
+        traverse_result<task::one_to_all> result;
+        if (desc.get_optional_results() & optional_results::distances) {
+            result.set_distances(
+                dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
+        }
+        if (desc.get_optional_results() & optional_results::predecessors) {
+            result.set_predecessors(
+                dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
+        }
+        return result;
+    }
+};
+
+} // namespace oneapi::dal::preview::shortest_paths::backend
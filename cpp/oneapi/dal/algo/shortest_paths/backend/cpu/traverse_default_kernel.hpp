@@ -23,6 +23,7 @@
 #include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/graph/detail/container.hpp"
 
@@ -35,7 +36,7 @@ inline void update_bins(const Vertex& v,
                         const EdgeValue& new_dist,
                         const EdgeValue& delta,
                         BinsVector& local_bins) {
-    ONEDAL_ASSERT(new_dist > 0);
+    ONEDAL_ASSERT(new_dist >= 0);
     ONEDAL_ASSERT(delta > 0);
     ONEDAL_ASSERT(new_dist / delta <= std::numeric_limits<EdgeValue>::max());
     ONEDAL_ASSERT(new_dist / delta <=
@@ -48,189 +49,357 @@ inline void update_bins(const Vertex& v,
     local_bins[dest_bin].push_back(v);
 }
 
-template <typename Topology, typename EdgeValue, typename BinsVector>
-inline void relax_edges(const Topology& t,
+/// Relaxes the edges [begin, end) of the vertex with the distance u_dist.
+/// The distances are updated with atomic min, so the function can be called concurrently,
+/// the vertices with the improved distances are pushed to the bins of the calling thread.
+template <typename Vertex, typename EdgeValue, typename BinsVector>
+inline void relax_edges(const Vertex* cols,
                         const EdgeValue* vals,
-                        typename Topology::vertex_type u,
-                        EdgeValue delta,
+                        std::int64_t begin,
+                        std::int64_t end,
+                        const EdgeValue& u_dist,
+                        const EdgeValue& delta,
                         EdgeValue* dist,
                         BinsVector& local_bins) {
-    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
-        const auto v = t._cols_ptr[v_];
-        const auto v_w = vals[v_];
-        EdgeValue old_dist = dist[v];
-        const EdgeValue new_dist = dist[u] + v_w;
-        if (new_dist < old_dist) {
-            dist[v] = new_dist;
+    for (std::int64_t v_ = begin; v_ < end; v_++) {
+        const auto v = cols[v_];
+        const EdgeValue new_dist = u_dist + vals[v_];
+        if (dal::detail::atomic_min(dist[v], new_dist)) {
             update_bins(v, new_dist, delta, local_bins);
         }
     }
 }
 
-template <typename EV, typename VT>
-struct dist_pred {
-    dist_pred(const EV& dist_, const VT& pred_) : dist(dist_), pred(pred_) {}
-    EV dist = 0;
-    VT pred = 0;
-};
+/// Copy of the graph edges where the light edges (weight <= delta) of every vertex
+/// precede the heavy ones, so the kinds of edges are relaxed separately without weight checks.
+/// The copy does not depend on the source, so it is shared by all traversals of the graph.
+template <typename EdgeValue>
+class light_heavy_edges {
+public:
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+
+    light_heavy_edges(const dal::preview::detail::topology<std::int32_t>& t,
+                      const EdgeValue* vals,
+                      EdgeValue delta,
+                      byte_alloc_iface* alloc_ptr)
+            : vertex_allocator_(alloc_ptr),
+              value_allocator_(alloc_ptr),
+              edge_allocator_(alloc_ptr),
+              rows_ptr_(t._rows_ptr),
+              vertex_count_(t.get_vertex_count()),
+              edge_count_(std::max(t._rows_ptr[t.get_vertex_count()], std::int64_t(1))) {
+        cols_ = allocate(vertex_allocator_, edge_count_);
+        vals_ = allocate(value_allocator_, edge_count_);
+        heavy_begin_ = allocate(edge_allocator_, vertex_count_);
+
+        dal::detail::threader_for(vertex_count_, vertex_count_, [&](vertex_type u) {
+            std::int64_t light_tail = t._rows_ptr[u];
+            std::int64_t heavy_head = t._rows_ptr[u + 1];
+            for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+                const std::int64_t dest = (vals[v_] <= delta) ? light_tail++ : --heavy_head;
+                cols_[dest] = t._cols_ptr[v_];
+                vals_[dest] = vals[v_];
+            }
+            heavy_begin_[u] = light_tail;
+        });
+    }
 
-template <class T1, class T2>
-bool operator==(const dist_pred<T1, T2>& lhs, const dist_pred<T1, T2>& rhs) {
-    return lhs.first == rhs.first && lhs.second == rhs.second;
-}
+    light_heavy_edges(const light_heavy_edges&) = delete;
+    light_heavy_edges& operator=(const light_heavy_edges&) = delete;
 
-template <class T1, class T2>
-bool operator!=(const dist_pred<T1, T2>& lhs, const dist_pred<T1, T2>& rhs) {
-    return !(lhs == rhs);
-}
+    ~light_heavy_edges() {
+        deallocate(edge_allocator_, heavy_begin_, vertex_count_);
+        deallocate(value_allocator_, vals_, edge_count_);
+        deallocate(vertex_allocator_, cols_, edge_count_);
+    }
 
-template <typename Topology, typename EdgeValue, typename DP, typename BinsVector>
-inline void relax_edges_with_pred(const Topology& t,
-                                  const EdgeValue* vals,
-                                  typename Topology::vertex_type u,
-                                  EdgeValue delta,
-                                  DP* dp,
-                                  BinsVector& local_bins) {
-    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
-        const auto v = t._cols_ptr[v_];
-        const auto v_w = vals[v_];
-        auto old_dp = dp[v];
-        const EdgeValue new_dist = dp[u].dist + v_w;
-        if (new_dist < old_dp.dist) {
-            dp[v] = dist_pred(new_dist, u);
-            update_bins(v, new_dist, delta, local_bins);
-        }
+    const vertex_type* get_cols() const {
+        return cols_;
     }
-}
+
+    const value_type* get_vals() const {
+        return vals_;
+    }
+
+    std::int64_t get_light_begin(vertex_type u) const {
+        return rows_ptr_[u];
+    }
+
+    std::int64_t get_heavy_begin(vertex_type u) const {
+        return heavy_begin_[u];
+    }
+
+    std::int64_t get_heavy_end(vertex_type u) const {
+        return rows_ptr_[u + 1];
+    }
+
+private:
+    inner_alloc<vertex_type> vertex_allocator_;
+    inner_alloc<value_type> value_allocator_;
+    inner_alloc<std::int64_t> edge_allocator_;
+    const std::int64_t* rows_ptr_;
+    std::int64_t vertex_count_;
+    std::int64_t edge_count_;
+    vertex_type* cols_ = nullptr;
+    value_type* vals_ = nullptr;
+    std::int64_t* heavy_begin_ = nullptr;
+};
 
 template <typename BinsVector>
-inline bool find_next_bin_index_seq(std::int64_t& curr_bin_index, const BinsVector& local_bins) {
+inline bool find_next_bin_index(std::int64_t& curr_bin_index, const BinsVector& local_bins) {
     const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+    std::int64_t next_bin_index = max_bin_count;
     bool is_queue_empty = true;
-    for (std::int64_t i = curr_bin_index; i < local_bins[0].size(); i++) {
-        if (!local_bins[0][i].empty()) {
-            if (i < max_bin_count) {
-                curr_bin_index = i;
+    for (std::int64_t thread_id = 0; thread_id < local_bins.size(); thread_id++) {
+        const auto& thread_bins = local_bins[thread_id];
+        const std::int64_t bin_count = std::min(thread_bins.size(), next_bin_index);
+        for (std::int64_t i = curr_bin_index; i < bin_count; i++) {
+            if (!thread_bins[i].empty()) {
+                next_bin_index = i;
+                is_queue_empty = false;
+                break;
             }
-            else {
-                curr_bin_index = max_bin_count;
-            }
-            is_queue_empty = false;
-            break;
         }
     }
+    curr_bin_index = next_bin_index;
     return is_queue_empty;
 }
 
-template <typename SharedBinContainer, typename BinsVector>
-inline std::int64_t reduce_to_common_bin_seq(const std::int64_t& curr_bin_index,
-                                             BinsVector& local_bins,
-                                             SharedBinContainer& shared_bin) {
-    std::int64_t curr_shared_bin_tail = 0;
-
-    if (curr_bin_index < local_bins[0].size()) {
-        std::int64_t copy_start = curr_shared_bin_tail;
-        curr_shared_bin_tail += local_bins[0][curr_bin_index].size();
-        copy(local_bins[0][curr_bin_index].begin(),
-             local_bins[0][curr_bin_index].end(),
-             shared_bin.get_mutable_data() + copy_start);
-        local_bins[0][curr_bin_index].resize(0);
+/// Moves the thread-local bins returned by get_local_bin(thread_id) to the shared bin.
+/// The offsets of the threads are computed with the prefix sum of the local bin sizes,
+/// so the threads copy their bins in parallel. Returns the number of vertices in the shared bin.
+template <typename GetLocalBin, typename SharedBinContainer>
+inline std::int64_t reduce_to_common_bin(std::int32_t thread_count,
+                                         const GetLocalBin& get_local_bin,
+                                         std::int64_t* offsets,
+                                         SharedBinContainer& shared_bin) {
+    offsets[0] = 0;
+    for (std::int32_t thread_id = 0; thread_id < thread_count; thread_id++) {
+        const auto* local_bin = get_local_bin(thread_id);
+        offsets[thread_id + 1] = offsets[thread_id] + (local_bin ? local_bin->size() : 0);
+    }
+
+    const std::int64_t curr_shared_bin_tail = offsets[thread_count];
+    if (curr_shared_bin_tail > shared_bin.size()) {
+        shared_bin.resize(curr_shared_bin_tail);
     }
+
+    dal::detail::threader_for(thread_count, thread_count, [&](std::int32_t thread_id) {
+        auto* local_bin = get_local_bin(thread_id);
+        if (local_bin && !local_bin->empty()) {
+            copy(local_bin->begin(),
+                 local_bin->end(),
+                 shared_bin.get_mutable_data() + offsets[thread_id]);
+            local_bin->resize(0);
+        }
+    });
     return curr_shared_bin_tail;
 }
 
+/// Computes the distances from the source with the parallel delta-stepping algorithm.
+/// Every bin is processed in two phases: the light edges of the bin vertices are relaxed
+/// concurrently until the bin stops refilling, then the heavy edges of all the vertices
+/// removed from the bin are relaxed once, as they cannot insert vertices to the same bin.
 template <typename Cpu, typename EdgeValue>
-struct delta_stepping {
-    traverse_result<task::one_to_all> operator()(
-        const detail::descriptor_base<task::one_to_all>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t,
-        const EdgeValue* vals,
-        byte_alloc_iface* alloc_ptr) {
-        {
-            using value_type = EdgeValue;
-            using vertex_type = std::int32_t;
-            using value_allocator_type = inner_alloc<value_type>;
-            using vertex_allocator_type = inner_alloc<vertex_type>;
+inline void delta_stepping_distances(const dal::preview::detail::topology<std::int32_t>& t,
+                                     const light_heavy_edges<EdgeValue>& edges,
+                                     std::int32_t source,
+                                     EdgeValue delta,
+                                     EdgeValue* dist,
+                                     byte_alloc_iface* alloc_ptr) {
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+    using edge_allocator_type = inner_alloc<std::int64_t>;
+
+    using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
+    using v1a_t = inner_alloc<v1v_t>;
+    using v2v_t = vector_container<v1v_t, v1a_t>;
+    using v2a_t = inner_alloc<v2v_t>;
+    using v3v_t = vector_container<v2v_t, v2a_t>;
+
+    vertex_allocator_type vertex_allocator(alloc_ptr);
+    edge_allocator_type edge_allocator(alloc_ptr);
+    v1a_t v1a(alloc_ptr);
+    v2a_t v2a(alloc_ptr);
 
-            vertex_allocator_type vertex_allocator(alloc_ptr);
-            value_allocator_type value_allocator(alloc_ptr);
+    const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+    const auto vertex_count = t.get_vertex_count();
+    const value_type max_dist = std::numeric_limits<value_type>::max();
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](vertex_type u) {
+        dist[u] = max_dist;
+    });
+    dist[source] = 0;
+
+    const std::int32_t thread_count = dal::detail::threader_get_max_threads();
+    std::int64_t* offsets = allocate(edge_allocator, thread_count + 1);
+    v3v_t local_bins(thread_count, v2a);
+    v2v_t local_removed(thread_count, v1a);
+
+    v1v_t shared_bin(1, vertex_allocator);
+    shared_bin[0] = source;
+    std::int64_t curr_bin_index = 0;
+    std::int64_t curr_shared_bin_tail = 1;
+    bool empty_queue = false;
+
+    auto get_curr_local_bin = [&](std::int32_t thread_id) -> v1v_t* {
+        auto& thread_bins = local_bins[thread_id];
+        return (curr_bin_index < thread_bins.size()) ? &thread_bins[curr_bin_index] : nullptr;
+    };
+    auto get_local_removed = [&](std::int32_t thread_id) -> v1v_t* {
+        return &local_removed[thread_id];
+    };
+
+    while (curr_bin_index != max_bin_count && !empty_queue) {
+        const value_type curr_bin_begin = delta * static_cast<value_type>(curr_bin_index);
+
+        while (curr_shared_bin_tail > 0) {
+            dal::detail::threader_for_int64(curr_shared_bin_tail, [&](std::int64_t i) {
+                const vertex_type u = shared_bin[i];
+                const value_type u_dist = dist[u];
+                if (u_dist >= curr_bin_begin) {
+                    const std::int32_t thread_id = dal::detail::threader_get_current_thread_index();
+                    relax_edges(edges.get_cols(),
+                                edges.get_vals(),
+                                edges.get_light_begin(u),
+                                edges.get_heavy_begin(u),
+                                u_dist,
+                                delta,
+                                dist,
+                                local_bins[thread_id]);
+                    local_removed[thread_id].push_back(u);
+                }
+            });
+            curr_shared_bin_tail =
+                reduce_to_common_bin(thread_count, get_curr_local_bin, offsets, shared_bin);
+        }
 
-            const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
-            const value_type delta = desc.get_delta();
+        const std::int64_t removed_count =
+            reduce_to_common_bin(thread_count, get_local_removed, offsets, shared_bin);
+        dal::detail::threader_for_int64(removed_count, [&](std::int64_t i) {
+            const vertex_type u = shared_bin[i];
+            const std::int32_t thread_id = dal::detail::threader_get_current_thread_index();
+            relax_edges(edges.get_cols(),
+                        edges.get_vals(),
+                        edges.get_heavy_begin(u),
+                        edges.get_heavy_end(u),
+                        dist[u],
+                        delta,
+                        dist,
+                        local_bins[thread_id]);
+        });
+
+        empty_queue = find_next_bin_index(curr_bin_index, local_bins);
+        if (!empty_queue) {
+            curr_shared_bin_tail =
+                reduce_to_common_bin(thread_count, get_curr_local_bin, offsets, shared_bin);
+        }
+    }
 
-            const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-            const std::int64_t max_elements_in_bin = 1000;
-            const auto vertex_count = t.get_vertex_count();
-            const value_type max_dist = std::numeric_limits<value_type>::max();
+    deallocate(edge_allocator, offsets, thread_count + 1);
+}
 
-            value_type* dist = allocate(value_allocator, vertex_count);
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                dist[i] = max_dist;
+/// Restores the predecessors from the final distances: the predecessor of the vertex v is
+/// the vertex u with the least index such that dist[u] < dist[v] and dist[u] + w(u, v) == dist[v].
+/// Taking the least index keeps the result independent of the order of relaxations.
+/// The vertices reachable only over the zero-weight edges (dist[u] == dist[v]) are assigned
+/// afterwards by the sequential search from the already assigned ones, so the predecessors
+/// never form a cycle even if the zero-weight edges do.
+template <typename Cpu, typename EdgeValue>
+inline void find_predecessors(const dal::preview::detail::topology<std::int32_t>& t,
+                              const EdgeValue* vals,
+                              std::int32_t source,
+                              const EdgeValue* dist,
+                              std::int32_t* pred,
+                              byte_alloc_iface* alloc_ptr) {
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+
+    const auto vertex_count = t.get_vertex_count();
+    const value_type max_dist = std::numeric_limits<value_type>::max();
+    const vertex_type no_pred = std::numeric_limits<vertex_type>::max();
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](vertex_type v) {
+        pred[v] = no_pred;
+    });
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](vertex_type u) {
+        const value_type u_dist = dist[u];
+        if (u_dist == max_dist) {
+            return;
+        }
+        for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+            const auto v = t._cols_ptr[v_];
+            if (v != source && u_dist < dist[v] && u_dist + vals[v_] == dist[v]) {
+                dal::detail::atomic_min(pred[v], u);
             }
+        }
+    });
 
-            dist[source] = 0;
-
-            vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
-                                                                            vertex_allocator);
-
-            shared_bin[0] = source;
-            std::int64_t curr_bin_index = 0;
-            std::int64_t curr_shared_bin_tail = 1;
-            bool empty_queue = false;
-
-            using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
-            using v1a_t = inner_alloc<v1v_t>;
-            using v2v_t = vector_container<v1v_t, v1a_t>;
-            using v2a_t = inner_alloc<v2v_t>;
-            using v3v_t = vector_container<v2v_t, v2a_t>;
-            v2a_t v2a(alloc_ptr);
-            v3v_t local_bins(1, v2a);
-
-            std::int64_t iter = 0;
-
-            while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
-                for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
-                    vertex_type u = shared_bin[i];
-                    if (dist[u] >= delta * static_cast<value_type>(curr_bin_index)) {
-                        relax_edges(t, vals, u, delta, dist, local_bins[0]);
-                    }
-                }
+    bool has_unassigned = false;
+    for (vertex_type v = 0; v < vertex_count && !has_unassigned; v++) {
+        has_unassigned = (v != source && dist[v] != max_dist && pred[v] == no_pred);
+    }
 
-                while (curr_bin_index < local_bins[0].size() &&
-                       !local_bins[0][curr_bin_index].empty() &&
-                       local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
-                    vector_container<vertex_type> curr_bin_copy(
-                        local_bins[0][curr_bin_index].size());
-                    copy(local_bins[0][curr_bin_index].begin(),
-                         local_bins[0][curr_bin_index].end(),
-                         curr_bin_copy.begin());
-
-                    local_bins[0][curr_bin_index].resize(0);
-                    for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
-                        relax_edges(t, vals, curr_bin_copy[j], delta, dist, local_bins[0]);
-                    }
+    if (has_unassigned) {
+        vertex_allocator_type vertex_allocator(alloc_ptr);
+        vertex_type* queue = allocate(vertex_allocator, vertex_count);
+        std::int64_t queue_head = 0;
+        std::int64_t queue_tail = 0;
+        for (vertex_type v = 0; v < vertex_count; v++) {
+            if (v == source || pred[v] != no_pred) {
+                queue[queue_tail++] = v;
+            }
+        }
+        while (queue_head < queue_tail) {
+            const vertex_type u = queue[queue_head++];
+            const value_type u_dist = dist[u];
+            for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; v_++) {
+                const auto v = t._cols_ptr[v_];
+                if (v != source && pred[v] == no_pred && u_dist == dist[v] &&
+                    u_dist + vals[v_] == dist[v]) {
+                    pred[v] = u;
+                    queue[queue_tail++] = v;
                 }
+            }
+        }
+        deallocate(vertex_allocator, queue, vertex_count);
+    }
 
-                empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
-
-                curr_shared_bin_tail =
-                    reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
+    dal::detail::threader_for(vertex_count, vertex_count, [&](vertex_type v) {
+        if (pred[v] == no_pred) {
+            pred[v] = -1;
+        }
+    });
+}
 
-                iter++;
-            }
+template <typename Cpu, typename EdgeValue>
+struct delta_stepping {
+    traverse_result<task::one_to_all> operator()(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using value_type = EdgeValue;
 
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                dist_[i] = dist[i];
-            }
+        const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
+        const value_type delta = desc.get_delta();
+        const auto vertex_count = t.get_vertex_count();
 
-            deallocate(value_allocator, dist, vertex_count);
-            return traverse_result<task::one_to_all>().set_distances(
-                dal::detail::homogen_table_builder{}
-                    .reset(dist_arr, t.get_vertex_count(), 1)
-                    .build());
-        }
+        const light_heavy_edges<value_type> edges(t, vals, delta, alloc_ptr);
+        auto dist_arr = array<value_type>::empty(vertex_count);
+        delta_stepping_distances<Cpu>(t,
+                                      edges,
+                                      source,
+                                      delta,
+                                      dist_arr.get_mutable_data(),
+                                      alloc_ptr);
+
+        return traverse_result<task::one_to_all>().set_distances(
+            dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
     }
 };
 
@@ -243,112 +412,109 @@ struct delta_stepping_with_pred {
         byte_alloc_iface* alloc_ptr) {
         using value_type = EdgeValue;
         using vertex_type = std::int32_t;
-        using vp_type = dist_pred<value_type, vertex_type>;
-        using vp_allocator_type = inner_alloc<vp_type>;
-        using vertex_allocator_type = inner_alloc<vertex_type>;
-
-        vertex_allocator_type vertex_allocator(alloc_ptr);
-        vp_allocator_type vp_allocator(alloc_ptr);
 
         const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
-
         const value_type delta = desc.get_delta();
-
-        const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
-        const std::int64_t max_elements_in_bin = 1000;
         const auto vertex_count = t.get_vertex_count();
-        const value_type max_dist = std::numeric_limits<value_type>::max();
 
-        vp_type* dp = allocate(vp_allocator, vertex_count);
-        for (std::int64_t i = 0; i < vertex_count; ++i) {
-            new (dp + i) dist_pred<value_type, vertex_type>(max_dist, -1);
+        const light_heavy_edges<value_type> edges(t, vals, delta, alloc_ptr);
+        auto dist_arr = array<value_type>::empty(vertex_count);
+        auto pred_arr = array<vertex_type>::empty(vertex_count);
+        delta_stepping_distances<Cpu>(t,
+                                      edges,
+                                      source,
+                                      delta,
+                                      dist_arr.get_mutable_data(),
+                                      alloc_ptr);
+        find_predecessors<Cpu>(t,
+                               vals,
+                               source,
+                               dist_arr.get_data(),
+                               pred_arr.get_mutable_data(),
+                               alloc_ptr);
+
+        auto result = traverse_result<task::one_to_all>().set_predecessors(
+            dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
+        if (desc.get_optional_results() & optional_results::distances) {
+            result.set_distances(
+                dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
         }
+        return result;
+    }
+};
 
-        dp[source] = dist_pred<value_type, vertex_type>(0, -1);
-
-        vector_container<vertex_type, vertex_allocator_type> shared_bin(t.get_edge_count(),
-                                                                        vertex_allocator);
-
-        shared_bin[0] = source;
-        std::int64_t curr_bin_index = 0;
-        std::int64_t curr_shared_bin_tail = 1;
-        bool empty_queue = false;
-
-        using v1v_t = vector_container<vertex_type, vertex_allocator_type>;
-        using v1a_t = inner_alloc<v1v_t>;
-
-        using v2v_t = vector_container<v1v_t, v1a_t>;
-        using v2a_t = inner_alloc<v2v_t>;
-        using v3v_t = vector_container<v2v_t, v2a_t>;
-
-        v2a_t v2a(alloc_ptr);
-        v3v_t local_bins(1, v2a);
+template <typename Cpu, typename EdgeValue>
+struct delta_stepping_many_to_all {
+    traverse_result<task::many_to_all> operator()(
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using value_type = EdgeValue;
+        using vertex_type = std::int32_t;
+        using value_allocator_type = inner_alloc<value_type>;
+        using vertex_allocator_type = inner_alloc<vertex_type>;
 
-        std::int64_t iter = 0;
+        const auto& sources = desc.get_sources();
+        const auto source_count = dal::detail::integral_cast<std::int32_t>(sources.get_count());
+        const std::int64_t* sources_ptr = sources.get_data();
+        const value_type delta = desc.get_delta();
+        const auto vertex_count = t.get_vertex_count();
+        const std::int64_t result_count =
+            dal::detail::check_mul_overflow(vertex_count, std::int64_t(source_count));
+
+        const bool compute_distances =
+            static_cast<bool>(desc.get_optional_results() & optional_results::distances);
+        const bool compute_predecessors =
+            static_cast<bool>(desc.get_optional_results() & optional_results::predecessors);
+
+        auto dist_arr =
+            compute_distances ? array<value_type>::empty(result_count) : array<value_type>{};
+        auto pred_arr =
+            compute_predecessors ? array<vertex_type>::empty(result_count) : array<vertex_type>{};
+        value_type* dist_ = compute_distances ? dist_arr.get_mutable_data() : nullptr;
+        vertex_type* pred_ = compute_predecessors ? pred_arr.get_mutable_data() : nullptr;
+
+        const light_heavy_edges<value_type> edges(t, vals, delta, alloc_ptr);
+
+        // Sources are traversed concurrently, every traversal is parallel itself
+        // and writes the column of the vertex_count x source_count result
+        dal::detail::threader_for(source_count, source_count, [&](std::int32_t j) {
+            value_allocator_type value_allocator(alloc_ptr);
+            const auto source = static_cast<vertex_type>(sources_ptr[j]);
 
-        while (curr_bin_index != max_bin_count && iter != max_bin_count && !empty_queue) {
-            for (std::int64_t i = 0; i < curr_shared_bin_tail; ++i) {
-                vertex_type u = shared_bin[i];
-                if (dp[u].dist >= delta * static_cast<value_type>(curr_bin_index)) {
-                    relax_edges_with_pred(t, vals, u, delta, dp, local_bins[0]);
+            value_type* dist = allocate(value_allocator, vertex_count);
+            delta_stepping_distances<Cpu>(t, edges, source, delta, dist, alloc_ptr);
+            if (compute_distances) {
+                for (std::int64_t i = 0; i < vertex_count; ++i) {
+                    dist_[i * source_count + j] = dist[i];
                 }
             }
 
-            while (curr_bin_index < local_bins[0].size() &&
-                   !local_bins[0][curr_bin_index].empty() &&
-                   local_bins[0][curr_bin_index].size() < max_elements_in_bin) {
-                vector_container<vertex_type> curr_bin_copy(local_bins[0][curr_bin_index].size());
-                copy(local_bins[0][curr_bin_index].begin(),
-                     local_bins[0][curr_bin_index].end(),
-                     curr_bin_copy.begin());
-
-                local_bins[0][curr_bin_index].resize(0);
-                for (std::int64_t j = 0; j < curr_bin_copy.size(); ++j) {
-                    relax_edges_with_pred(t, vals, curr_bin_copy[j], delta, dp, local_bins[0]);
+            if (compute_predecessors) {
+                vertex_allocator_type vertex_allocator(alloc_ptr);
+                vertex_type* pred = allocate(vertex_allocator, vertex_count);
+                find_predecessors<Cpu>(t, vals, source, dist, pred, alloc_ptr);
+                for (std::int64_t i = 0; i < vertex_count; ++i) {
+                    pred_[i * source_count + j] = pred[i];
                 }
+                deallocate(vertex_allocator, pred, vertex_count);
             }
+            deallocate(value_allocator, dist, vertex_count);
+        });
 
-            empty_queue = find_next_bin_index_seq(curr_bin_index, local_bins);
-
-            curr_shared_bin_tail = reduce_to_common_bin_seq(curr_bin_index, local_bins, shared_bin);
-
-            iter++;
-        }
-
-        if (desc.get_optional_results() & optional_results::distances) {
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                const auto dp_i = dp[i];
-                dist_[i] = dp_i.dist;
-                pred_[i] = dp_i.pred;
-            }
-
-            deallocate(vp_allocator, dp, vertex_count);
-            return traverse_result<task::one_to_all>()
-                .set_distances(dal::detail::homogen_table_builder{}
-                                   .reset(dist_arr, t.get_vertex_count(), 1)
-                                   .build())
-                .set_predecessors(dal::detail::homogen_table_builder{}
-                                      .reset(pred_arr, t.get_vertex_count(), 1)
-                                      .build());
+        traverse_result<task::many_to_all> result;
+        if (compute_distances) {
+            result.set_distances(dal::detail::homogen_table_builder{}
+                                     .reset(dist_arr, vertex_count, source_count)
+                                     .build());
         }
-        else {
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-            for (std::int64_t i = 0; i < vertex_count; ++i) {
-                const auto dp_i = dp[i];
-                pred_[i] = dp_i.pred;
-            }
-
-            deallocate(vp_allocator, dp, vertex_count);
-            return traverse_result<task::one_to_all>().set_predecessors(
-                dal::detail::homogen_table_builder{}
-                    .reset(pred_arr, t.get_vertex_count(), 1)
-                    .build());
+        if (compute_predecessors) {
+            result.set_predecessors(dal::detail::homogen_table_builder{}
+                                        .reset(pred_arr, vertex_count, source_count)
+                                        .build());
         }
+        return result;
     }
 };
 
@@ -22,6 +22,10 @@ template struct delta_stepping<__CPU_TAG__, std::int32_t>;
 
 template struct delta_stepping<__CPU_TAG__, double>;
 
+template struct delta_stepping_many_to_all<__CPU_TAG__, std::int32_t>;
+
+template struct delta_stepping_many_to_all<__CPU_TAG__, double>;
+
 template struct delta_stepping_with_pred<__CPU_TAG__, std::int32_t>;
 
 template struct delta_stepping_with_pred<__CPU_TAG__, double>;
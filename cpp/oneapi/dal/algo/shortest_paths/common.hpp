@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/array.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
 #include "oneapi/dal/table/common.hpp"
@@ -24,11 +25,13 @@ namespace oneapi::dal::preview::shortest_paths {
 
 namespace task {
 struct one_to_all {}; // one vertex to all paths
+struct many_to_all {}; // each of many vertices to all paths
 using by_default = one_to_all;
 } // namespace task
 
 namespace method {
 struct delta_stepping {};
+struct bfs {}; // direction-optimizing breadth-first search, the edge weights are ignored
 using by_default = delta_stepping;
 } // namespace method
 
@@ -96,20 +99,34 @@ class descriptor_impl;
 template <typename T>
 using enable_if_single_source_t = std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all>>;
 
+template <typename T>
+using enable_if_multi_source_t = std::enable_if_t<dal::detail::is_one_of_v<T, task::many_to_all>>;
+
 template <typename T, typename M>
 using enable_if_delta_stepping_single_source_t =
     std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all> &
                      dal::detail::is_one_of_v<M, method::delta_stepping>>;
 
+template <typename T, typename M>
+using enable_if_delta_stepping_multi_source_t =
+    std::enable_if_t<dal::detail::is_one_of_v<T, task::many_to_all> &
+                     dal::detail::is_one_of_v<M, method::delta_stepping>>;
+
+template <typename T, typename M>
+using enable_if_bfs_single_source_t =
+    std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all> &
+                     dal::detail::is_one_of_v<M, method::bfs>>;
+
 template <typename M>
 using enable_if_delta_stepping_t =
     std::enable_if_t<dal::detail::is_one_of_v<M, method::delta_stepping>>;
 
 template <typename Method>
-constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::delta_stepping>;
+constexpr bool is_valid_method =
+    dal::detail::is_one_of_v<Method, method::delta_stepping, method::bfs>;
 
 template <typename Task>
-constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::one_to_all>;
+constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::one_to_all, task::many_to_all>;
 
 /// The base class for the Shortest Paths algorithm descriptor
 template <typename Task = task::by_default>
@@ -125,11 +142,13 @@ public:
     descriptor_base();
 
     std::int64_t get_source() const;
+    const array<std::int64_t>& get_sources() const;
     double get_delta() const;
     optional_result_id& get_optional_results() const;
 
 protected:
     void set_source(std::int64_t source_vertex);
+    void set_sources(const array<std::int64_t>& source_vertices);
     void set_delta(double delta);
     void set_optional_results(const optional_result_id& optional_results);
 
@@ -173,6 +192,34 @@ public:
         _alloc = allocator;
     }
 
+    /// Creates a new instance of the class for the task::many_to_all,
+    /// the distances and the predecessors are computed for every source in the given order
+    template <typename T = Task,
+              typename M = Method,
+              typename = detail::enable_if_delta_stepping_multi_source_t<T, M>>
+    descriptor(const array<std::int64_t>& source_vertices,
+               double delta,
+               optional_result_id optional_results = optional_results::distances,
+               Allocator allocator = std::allocator<char>()) {
+        base_t::set_sources(source_vertices);
+        base_t::set_delta(delta);
+        base_t::set_optional_results(optional_results);
+        _alloc = allocator;
+    }
+
+    /// Creates a new instance of the class for the method::bfs,
+    /// the distances are the numbers of edges on the shortest paths from the source
+    template <typename T = Task,
+              typename M = Method,
+              typename = detail::enable_if_bfs_single_source_t<T, M>>
+    descriptor(std::int64_t source_vertex,
+               optional_result_id optional_results = optional_results::distances,
+               Allocator allocator = std::allocator<char>()) {
+        base_t::set_source(source_vertex);
+        base_t::set_optional_results(optional_results);
+        _alloc = allocator;
+    }
+
     template <typename T = Task, typename = detail::enable_if_single_source_t<T>>
     auto& set_source(std::int64_t source_vertex) {
         base_t::set_source(source_vertex);
@@ -184,6 +231,17 @@ public:
         return base_t::get_source();
     }
 
+    template <typename T = Task, typename = detail::enable_if_multi_source_t<T>>
+    auto& set_sources(const array<std::int64_t>& source_vertices) {
+        base_t::set_sources(source_vertices);
+        return *this;
+    }
+
+    template <typename T = Task, typename = detail::enable_if_multi_source_t<T>>
+    const array<std::int64_t>& get_sources() const {
+        return base_t::get_sources();
+    }
+
     template <typename M = Method, typename = detail::enable_if_delta_stepping_t<M>>
     auto& set_delta(double delta) {
         base_t::set_delta(delta);
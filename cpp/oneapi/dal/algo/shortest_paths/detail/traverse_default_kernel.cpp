@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/shortest_paths/detail/traverse_default_kernel.hpp"
+#include "oneapi/dal/algo/shortest_paths/backend/cpu/traverse_bfs_kernel.hpp"
 #include "oneapi/dal/algo/shortest_paths/backend/cpu/traverse_default_kernel.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
@@ -33,6 +34,22 @@ operator()(const dal::detail::host_policy& policy,
     });
 }
 
+template <typename Float, typename EdgeValue>
+traverse_result<task::many_to_all>
+delta_stepping<Float, task::many_to_all, dal::preview::detail::topology<std::int32_t>, EdgeValue>::
+operator()(const dal::detail::host_policy& policy,
+           const detail::descriptor_base<task::many_to_all>& desc,
+           const dal::preview::detail::topology<std::int32_t>& t,
+           const EdgeValue* vals,
+           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::delta_stepping_many_to_all<decltype(cpu), EdgeValue>{}(desc,
+                                                                               t,
+                                                                               vals,
+                                                                               alloc_ptr);
+    });
+}
+
 template <typename Float, typename EdgeValue>
 traverse_result<task::one_to_all> delta_stepping_with_pred<
     Float,
@@ -51,6 +68,18 @@ traverse_result<task::one_to_all> delta_stepping_with_pred<
     });
 }
 
+template <typename Float>
+traverse_result<task::one_to_all>
+bfs<Float, task::one_to_all, dal::preview::detail::topology<std::int32_t>>::operator()(
+    const dal::detail::host_policy& policy,
+    const detail::descriptor_base<task::one_to_all>& desc,
+    const dal::preview::detail::topology<std::int32_t>& t,
+    byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::bfs<decltype(cpu)>{}(desc, t, alloc_ptr);
+    });
+}
+
 template struct ONEDAL_EXPORT delta_stepping<float,
                                              task::one_to_all,
                                              dal::preview::detail::topology<std::int32_t>,
@@ -59,6 +88,14 @@ template struct ONEDAL_EXPORT delta_stepping<float,
 template struct ONEDAL_EXPORT
     delta_stepping<float, task::one_to_all, dal::preview::detail::topology<std::int32_t>, double>;
 
+template struct ONEDAL_EXPORT delta_stepping<float,
+                                             task::many_to_all,
+                                             dal::preview::detail::topology<std::int32_t>,
+                                             std::int32_t>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping<float, task::many_to_all, dal::preview::detail::topology<std::int32_t>, double>;
+
 template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
                                                        task::one_to_all,
                                                        dal::preview::detail::topology<std::int32_t>,
@@ -69,4 +106,7 @@ template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
                                                        dal::preview::detail::topology<std::int32_t>,
                                                        double>;
 
+template struct ONEDAL_EXPORT
+    bfs<float, task::one_to_all, dal::preview::detail::topology<std::int32_t>>;
+
 } // namespace oneapi::dal::preview::shortest_paths::detail
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/algo/shortest_paths/traverse.hpp"
 #include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
@@ -119,6 +120,58 @@ public:
 
         const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
     }
+
+    template <typename GraphType>
+    void check_many_to_all(double delta, const std::vector<std::int64_t>& sources) {
+        using namespace dal::preview::shortest_paths;
+        GraphType graph_data;
+
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int,
+            double,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+
+        const auto& graph = graph_builder.get_graph();
+
+        auto sources_arr = dal::array<std::int64_t>{};
+        if (!sources.empty()) {
+            sources_arr = dal::array<std::int64_t>::empty(sources.size());
+            std::copy(sources.begin(), sources.end(), sources_arr.get_mutable_data());
+        }
+        const auto shortest_paths_desc =
+            descriptor<float, method::delta_stepping, task::many_to_all>(sources_arr, delta);
+
+        const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
+    }
+
+    template <typename GraphType>
+    void check_bfs(std::int64_t source) {
+        using namespace dal::preview::shortest_paths;
+        GraphType graph_data;
+
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int,
+            double,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+
+        const auto& graph = graph_builder.get_graph();
+
+        const auto bfs_desc = descriptor<float, method::bfs>(source);
+
+        const auto result_bfs = dal::preview::traverse(bfs_desc, graph);
+    }
 };
 
 #define SHORTEST_PATHS_BADARG_TEST(name) \
@@ -140,6 +193,21 @@ SHORTEST_PATHS_BADARG_TEST("Check empty graph") {
     REQUIRE_THROWS_AS((this->check_shortest_paths<empty_graph_type>(5, 0)), invalid_argument);
 }
 
+SHORTEST_PATHS_BADARG_TEST("Check sources are in graph") {
+    REQUIRE_THROWS_AS((this->check_many_to_all<example_graph_type>(5, { 0, -2 })),
+                      invalid_argument);
+    REQUIRE_THROWS_AS((this->check_many_to_all<example_graph_type>(5, { 100, 1 })),
+                      invalid_argument);
+    REQUIRE_THROWS_AS((this->check_many_to_all<example_graph_type>(5, {})), invalid_argument);
+}
+
+SHORTEST_PATHS_BADARG_TEST("Check BFS source is in graph") {
+    REQUIRE_THROWS_AS((this->check_bfs<example_graph_type>(-1)), invalid_argument);
+    REQUIRE_THROWS_AS((this->check_bfs<example_graph_type>(6)), invalid_argument);
+    REQUIRE_THROWS_AS((this->check_bfs<empty_graph_type>(0)), invalid_argument);
+    REQUIRE_NOTHROW(this->check_bfs<example_graph_type>(5));
+}
+
 // SHORTEST_PATHS_BADARG_TEST("Check edges are non-negative") {
 //     REQUIRE_THROWS_AS((this->check_shortest_paths<negative_weights_graph_type>(5, 0)),
 //                       invalid_argument);
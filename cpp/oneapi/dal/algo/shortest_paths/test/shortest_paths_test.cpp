@@ -210,6 +210,42 @@ public:
     std::array<double, 3001> distances;
 };
 
+class d_light_heavy_edges_graph_type : public graph_base_data {
+public:
+    d_light_heavy_edges_graph_type() {
+        vertex_count = 1000;
+        edge_count = 1997;
+        cols_count = 1997;
+        rows_count = 1001;
+        source = 0;
+
+        rows[0] = 0;
+        rows[1] = vertex_count - 1;
+        for (int64_t index = 2; index < rows_count - 1; ++index) {
+            rows[index] = rows[index - 1] + 1;
+        }
+        rows[rows_count - 1] = rows[rows_count - 2];
+        // the source is connected to every vertex with a heavy edge and to the vertex 1
+        // with a light edge, the light edges form the chain of the shortest paths
+        for (int64_t index = 0; index < vertex_count - 1; ++index) {
+            cols[index] = index + 1;
+            edge_weights[index] = (index == 0) ? 1 : (index + 1) * 2;
+        }
+        for (int64_t index = vertex_count - 1; index < cols_count; ++index) {
+            cols[index] = index - vertex_count + 3;
+            edge_weights[index] = 1;
+        }
+        for (int index = 0; index < vertex_count; ++index) {
+            distances[index] = index;
+        }
+    }
+
+    std::array<std::int64_t, 1001> rows;
+    std::array<std::int32_t, 1997> cols;
+    std::array<double, 1997> edge_weights;
+    std::array<double, 1000> distances;
+};
+
 class d_isolated_vertexes_graph_type : public graph_base_data {
 public:
     d_isolated_vertexes_graph_type() {
@@ -583,6 +619,21 @@ public:
                                         unreachable_double_distance };
 };
 
+class d_zero_weight_cycle_graph_type : public graph_base_data {
+public:
+    d_zero_weight_cycle_graph_type() {
+        vertex_count = 4;
+        edge_count = 4;
+        cols_count = 4;
+        rows_count = 5;
+        source = 3;
+    }
+    std::array<std::int64_t, 5> rows = { 0, 1, 2, 3, 4 };
+    std::array<std::int32_t, 4> cols = { 1, 0, 1, 2 };
+    std::array<double, 4> edge_weights = { 0, 0, 0, 1 };
+    std::array<double, 4> distances = { 1, 1, 1, 0 };
+};
+
 class d_k_15_double_edges_source_5_graph_type : public graph_base_data {
 public:
     d_k_15_double_edges_source_5_graph_type() {
@@ -732,6 +783,19 @@ public:
                 }
             }
         }
+        // The chain of the predecessors of every reachable vertex ends in the source
+        for (size_t index = 0; index < predecessors.size(); ++index) {
+            int64_t vertex = index;
+            size_t chain_length = 0;
+            while (predecessors[vertex] != -1 && chain_length < predecessors.size()) {
+                vertex = predecessors[vertex];
+                ++chain_length;
+            }
+            if (predecessors[vertex] != -1 ||
+                (vertex != source && distances[vertex] != unreachable_distance)) {
+                return false;
+            }
+        }
         return true;
     }
 
@@ -746,6 +810,17 @@ public:
         return result;
     }
 
+    template <typename T>
+    std::vector<T> get_column_from_table(const oneapi::dal::table& table, std::int64_t column) {
+        auto arr = oneapi::dal::row_accessor<const T>(table).pull();
+        const auto x = arr.get_data();
+        std::vector<T> result(table.get_row_count());
+        for (std::int64_t i = 0; i < table.get_row_count(); i++) {
+            result[i] = x[i * table.get_column_count() + column];
+        }
+        return result;
+    }
+
     template <typename EdgeValueType, typename Allocator, size_t Size>
     void general_shortest_paths_check(
         const oneapi::dal::preview::directed_adjacency_vector_graph<
@@ -810,6 +885,125 @@ public:
                                      alloc);
     }
 
+    template <typename DirectedGraphType, typename EdgeValueType>
+    void many_to_all_check(double delta,
+                           const std::vector<std::int64_t>& sources,
+                           bool calculate_distances,
+                           bool calculate_predecessors) {
+        using namespace dal::preview::shortest_paths;
+        DirectedGraphType graph_data;
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int32_t,
+            EdgeValueType,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+        const auto& graph = graph_builder.get_graph();
+        const auto result_type = get_result_type(calculate_distances, calculate_predecessors);
+        const std::int64_t source_count = sources.size();
+
+        auto sources_arr = dal::array<std::int64_t>::empty(source_count);
+        std::copy(sources.begin(), sources.end(), sources_arr.get_mutable_data());
+        const auto many_to_all_desc =
+            descriptor<float, method::delta_stepping, task::many_to_all>(sources_arr,
+                                                                         delta,
+                                                                         result_type);
+        const auto many_to_all_result = dal::preview::traverse(many_to_all_desc, graph);
+
+        for (std::int64_t j = 0; j < source_count; ++j) {
+            const auto one_to_all_desc =
+                descriptor<float, method::delta_stepping, task::one_to_all>(sources[j],
+                                                                            delta,
+                                                                            result_type);
+            const auto one_to_all_result = dal::preview::traverse(one_to_all_desc, graph);
+            if (result_type & optional_results::distances) {
+                const auto& distances = many_to_all_result.get_distances();
+                REQUIRE(distances.get_row_count() == graph_data.get_vertex_count());
+                REQUIRE(distances.get_column_count() == source_count);
+                const auto true_distances =
+                    get_data_from_table<EdgeValueType>(one_to_all_result.get_distances());
+                const auto column = get_column_from_table<EdgeValueType>(distances, j);
+                for (std::int64_t i = 0; i < graph_data.get_vertex_count(); ++i) {
+                    REQUIRE(compare_distances(true_distances[i], column[i]));
+                }
+            }
+            else {
+                REQUIRE_THROWS_AS(many_to_all_result.get_distances(),
+                                  uninitialized_optional_result);
+            }
+            if (result_type & optional_results::predecessors) {
+                const auto& predecessors = many_to_all_result.get_predecessors();
+                REQUIRE(predecessors.get_row_count() == graph_data.get_vertex_count());
+                REQUIRE(predecessors.get_column_count() == source_count);
+                REQUIRE(get_column_from_table<int32_t>(predecessors, j) ==
+                        get_data_from_table<int32_t>(one_to_all_result.get_predecessors()));
+            }
+            else {
+                REQUIRE_THROWS_AS(many_to_all_result.get_predecessors(),
+                                  uninitialized_optional_result);
+            }
+        }
+    }
+
+    template <typename DirectedGraphType, typename EdgeValueType>
+    void bfs_check(std::int64_t source, bool calculate_distances, bool calculate_predecessors) {
+        using namespace dal::preview::shortest_paths;
+        DirectedGraphType graph_data;
+        const std::vector<EdgeValueType> unit_weights(graph_data.get_edge_count(), 1);
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int32_t,
+            EdgeValueType,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  unit_weights.data());
+        const auto& graph = graph_builder.get_graph();
+        const auto result_type = get_result_type(calculate_distances, calculate_predecessors);
+
+        // with the unit weights the delta-stepping computes the numbers of edges on the paths
+        // and picks the predecessors with the least index as the breadth-first search does
+        const auto reference_desc = descriptor<float, method::delta_stepping, task::one_to_all>(
+            source,
+            1,
+            optional_results::distances | optional_results::predecessors);
+        const auto reference_result = dal::preview::traverse(reference_desc, graph);
+
+        const auto bfs_desc = descriptor<float, method::bfs, task::one_to_all>(source, result_type);
+        const auto bfs_result = dal::preview::traverse(bfs_desc, graph);
+        if (result_type & optional_results::distances) {
+            const auto true_distances =
+                get_data_from_table<EdgeValueType>(reference_result.get_distances());
+            const auto distances = get_data_from_table<int32_t>(bfs_result.get_distances());
+            REQUIRE(distances.size() == true_distances.size());
+            for (size_t i = 0; i < distances.size(); ++i) {
+                if (true_distances[i] == std::numeric_limits<EdgeValueType>::max()) {
+                    REQUIRE(distances[i] == unreachable_int32_t_distance);
+                }
+                else {
+                    REQUIRE(compare_distances(true_distances[i],
+                                              static_cast<EdgeValueType>(distances[i])));
+                }
+            }
+        }
+        else {
+            REQUIRE_THROWS_AS(bfs_result.get_distances(), uninitialized_optional_result);
+        }
+        if (result_type & optional_results::predecessors) {
+            REQUIRE(get_data_from_table<int32_t>(bfs_result.get_predecessors()) ==
+                    get_data_from_table<int32_t>(reference_result.get_predecessors()));
+        }
+        else {
+            REQUIRE_THROWS_AS(bfs_result.get_predecessors(), uninitialized_optional_result);
+        }
+    }
+
     template <typename DirectedGraphType, typename EdgeValueType, typename AllocatorType>
     void shortest_paths_custom_allocator_check(double delta,
                                                bool calculate_distances,
@@ -865,6 +1059,14 @@ SHORTEST_PATHS_TEST("Bucket size > max_elemnents_in_bin, predecessors") {
     this->shortest_paths_check<d_max_element_bin_graph_type, double>(1000, false, true);
 }
 
+SHORTEST_PATHS_TEST("Light and heavy edges, distances + predecessors") {
+    this->shortest_paths_check<d_light_heavy_edges_graph_type, double>(10, true, true);
+}
+
+SHORTEST_PATHS_TEST("Light and heavy edges, predecessors") {
+    this->shortest_paths_check<d_light_heavy_edges_graph_type, double>(10, false, true);
+}
+
 SHORTEST_PATHS_TEST("All vertexes are isolated, double edge weights, distances + predecessors") {
     this->shortest_paths_check<d_isolated_vertexes_graph_type, double>(15, true, true);
 }
@@ -927,6 +1129,27 @@ SHORTEST_PATHS_TEST("Multiple connectivity components)") {
                                                                                       true);
 }
 
+SHORTEST_PATHS_TEST("Many sources, distances + predecessors") {
+    this->many_to_all_check<d_net_10_10_double_edges_graph_type, double>(40,
+                                                                          { 0, 5, 17, 99, 5 },
+                                                                          true,
+                                                                          true);
+}
+
+SHORTEST_PATHS_TEST("Many sources, int32_t edge weights, distances") {
+    this->many_to_all_check<d_net_10_10_int_edges_graph_type, int32_t>(40,
+                                                                        { 42, 0, 63 },
+                                                                        true,
+                                                                        false);
+}
+
+SHORTEST_PATHS_TEST("Many sources, predecessors") {
+    this->many_to_all_check<d_light_heavy_edges_graph_type, double>(10,
+                                                                     { 0, 1, 500, 999 },
+                                                                     false,
+                                                                     true);
+}
+
 SHORTEST_PATHS_TEST("Isolated source vertex, distances + predecessors") {
     this->shortest_paths_check<d_source_isolated_vertex_graph_type, double>(3, true, true);
 }
@@ -943,4 +1166,36 @@ SHORTEST_PATHS_TEST("Non-zero source vertex, predecessors") {
     this->shortest_paths_check<d_k_15_double_edges_source_5_graph_type, double>(50, false, true);
 }
 
+SHORTEST_PATHS_TEST("Zero-weight edges with equal distances, distances + predecessors") {
+    this->shortest_paths_check<d_zero_weight_cycle_graph_type, double>(1, true, true);
+}
+
+SHORTEST_PATHS_TEST("Zero-weight edges with equal distances, predecessors") {
+    this->shortest_paths_check<d_zero_weight_cycle_graph_type, double>(1, false, true);
+}
+
+SHORTEST_PATHS_TEST("BFS, distances + predecessors") {
+    this->bfs_check<d_net_10_10_double_edges_graph_type, double>(0, true, true);
+}
+
+SHORTEST_PATHS_TEST("BFS, int32_t edge weights, distances") {
+    this->bfs_check<d_net_10_10_int_edges_graph_type, int32_t>(57, true, false);
+}
+
+SHORTEST_PATHS_TEST("BFS, high-degree source, distances + predecessors") {
+    this->bfs_check<d_light_heavy_edges_graph_type, double>(0, true, true);
+}
+
+SHORTEST_PATHS_TEST("BFS, predecessors") {
+    this->bfs_check<d_thread_bucket_size_graph_type, double>(0, false, true);
+}
+
+SHORTEST_PATHS_TEST("BFS, multiple connectivity components") {
+    this->bfs_check<d_multiple_connectivity_components_graph_type, double>(0, true, true);
+}
+
+SHORTEST_PATHS_TEST("BFS, isolated source vertex") {
+    this->bfs_check<d_source_isolated_vertex_graph_type, double>(0, true, true);
+}
+
 } // namespace oneapi::dal::algo::shortest_paths::test
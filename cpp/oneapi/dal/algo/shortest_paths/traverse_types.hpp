@@ -37,6 +37,8 @@ public:
     using task_t = Task;
     static_assert(detail::is_valid_graph<Graph>,
                   "Only directed_adjacency_vector_graph is supported.");
+    static_assert(std::is_same_v<vertex_type<Graph>, std::int32_t>,
+                  "Only int32_t vertex indices are supported.");
     /// Constructs the algorithm input initialized with the graph
     ///
     /// @param [in]   g  The input graph
@@ -63,13 +65,17 @@ public:
     traverse_result();
 
     /// Returns the table with computed distances from the source to each vertex
-    /// represented as the type of weights of the graph (std::int32_t or double)
+    /// represented as the type of weights of the graph (std::int32_t or double).
+    /// For the method::bfs, the distances are the numbers of edges represented as std::int32_t,
+    /// the unreachable vertices have the maximum value of std::int32_t.
+    /// For the task::many_to_all, the table has a row per vertex and a column per source
     const table& get_distances() const {
         return get_distances_impl();
     }
 
     /// Returns the table with computed predecessors from the source to each vertex
-    // represented as std::int32_t
+    /// represented as std::int32_t.
+    /// For the task::many_to_all, the table has a row per vertex and a column per source
     const table& get_predecessors() const {
         return get_predecessors_impl();
     }
@@ -45,8 +45,11 @@ public:
                     inner_alloc alloc);
     virtual ~matching_engine();
 
-    void run_and_wait(global_stack<Cpu>& gstack,
+    void run_and_wait(global_stack<Cpu>* shared_stacks,
+                      std::int64_t engine_index,
+                      std::int64_t engine_count,
                       std::int64_t& busy_engine_count,
+                      std::int64_t& hungry_engine_count,
                       std::int64_t& current_match_count,
                       std::int64_t target_match_count,
                       bool main_engine);
@@ -91,6 +94,10 @@ public:
     std::int64_t extract_candidates(bool check_solution);
     bool check_vertex_candidate(bool check_solution, std::int64_t candidate);
     void set_not_busy(bool& is_busy_engine, std::int64_t& busy_engine_count);
+    bool steal(global_stack<Cpu>* shared_stacks,
+               std::int64_t engine_index,
+               std::int64_t engine_count,
+               std::int64_t* busy_engine_count);
 };
 
 template <typename Cpu>
@@ -172,7 +179,10 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
         max_neighbours_size = max_degree;
     }
 
-    hlocal_stack.init(solution_length - 1, target_vertex_count);
+    // the levels of the stack grow on demand, the candidates of the deeper levels
+    // are bounded by the neighbors of the matched vertices in most cases
+    hlocal_stack.init(solution_length - 1,
+                      std::min(target_vertex_count, std::max(max_degree, std::int64_t(1))));
 
     if (target->bit_representation) {
         temporary_list = nullptr;
@@ -392,15 +402,35 @@ void matching_engine<Cpu>::set_not_busy(bool& is_busy_engine, std::int64_t& busy
 }
 
 template <typename Cpu>
-void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
+bool matching_engine<Cpu>::steal(global_stack<Cpu>* shared_stacks,
+                                 std::int64_t engine_index,
+                                 std::int64_t engine_count,
+                                 std::int64_t* busy_engine_count) {
+    for (std::int64_t i = 0; i < engine_count; ++i) {
+        global_stack<Cpu>& victim = shared_stacks[(engine_index + i) % engine_count];
+        if (victim.approximate_size() > 0 && victim.pop(hlocal_stack, busy_engine_count)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Cpu>
+void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>* shared_stacks,
+                                        std::int64_t engine_index,
+                                        std::int64_t engine_count,
                                         std::int64_t& busy_engine_count,
+                                        std::int64_t& hungry_engine_count,
                                         std::int64_t& cumulative_match_count,
                                         std::int64_t target_match_count,
                                         bool main_engine) {
     if (main_engine) {
         first_states_generator(hlocal_stack);
     }
+    global_stack<Cpu>& own_stack = shared_stacks[engine_index];
     bool is_busy_engine = true;
+    bool is_hungry_engine = false;
+    dal::detail::atomic_increment(busy_engine_count);
     std::int64_t current_match_count = 0;
     ONEDAL_ASSERT(pattern != nullptr);
     for (;;) {
@@ -410,7 +440,10 @@ void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
             break;
         }
         if (hlocal_stack.states_in_stack() > 0) {
-            while ((hlocal_stack.states_in_stack() > 5) && gstack.push(hlocal_stack))
+            // share the largest unexplored subtree only while some engine is out of work
+            const std::int64_t hungry_count = dal::detail::atomic_load(hungry_engine_count);
+            while (own_stack.approximate_size() < hungry_count &&
+                   own_stack.push_shallowest(hlocal_stack))
                 ;
             ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
             const auto delta = state_exploration();
@@ -422,23 +455,30 @@ void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
                 break;
             }
         }
+        else if (steal(shared_stacks,
+                       engine_index,
+                       engine_count,
+                       is_busy_engine ? nullptr : &busy_engine_count)) {
+            is_busy_engine = true;
+            if (is_hungry_engine) {
+                is_hungry_engine = false;
+                dal::detail::atomic_decrement(hungry_engine_count);
+            }
+        }
         else {
-            gstack.pop(hlocal_stack);
-            if (hlocal_stack.empty()) {
-                set_not_busy(is_busy_engine, busy_engine_count);
-                if (target_match_count > 0 &&
-                    dal::detail::atomic_load(cumulative_match_count) >= target_match_count) {
-                    break;
-                }
-                if (dal::detail::atomic_load(busy_engine_count) == 0)
-                    break;
+            set_not_busy(is_busy_engine, busy_engine_count);
+            if (!is_hungry_engine) {
+                is_hungry_engine = true;
+                dal::detail::atomic_increment(hungry_engine_count);
             }
-            else if (!is_busy_engine) {
-                is_busy_engine = true;
-                dal::detail::atomic_increment(busy_engine_count);
+            if (dal::detail::atomic_load(busy_engine_count) == 0) {
+                break;
             }
         }
     }
+    if (is_hungry_engine) {
+        dal::detail::atomic_decrement(hungry_engine_count);
+    }
     return;
 }
 
@@ -520,12 +560,9 @@ solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
             static_cast<bool>(first_states_count % max_threads_count);
     }
 
-    const std::uint64_t array_size =
-        (max_threads_count >= 64)
-            ? max_threads_count * 2 / 10
-            : (max_threads_count >= 24)
-                  ? max_threads_count * 4 / 10
-                  : (max_threads_count >= 8) ? 4 : (max_threads_count >= 4) ? 2 : 1;
+    // an engine per thread, the idle engines steal the subtrees of the search
+    // from the shared stacks of the busy ones
+    const std::uint64_t array_size = max_threads_count;
     auto engine_array_ptr = allocator.make_shared_memory<matching_engine<Cpu>>(array_size);
     matching_engine<Cpu>* engine_array = engine_array_ptr.get();
 
@@ -556,17 +593,36 @@ solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
         }
     }
 
-    global_stack<Cpu> gstack(pattern->get_vertex_count(), allocator);
-    std::int64_t busy_engine_count(array_size);
+    // the stacks are bounded, so the memory taken by the shared states does not depend
+    // on the target graph
+    const std::int64_t max_shared_state_count = 4;
+    auto shared_stacks_ptr = allocator.make_shared_memory<global_stack<Cpu>>(array_size);
+    global_stack<Cpu>* shared_stacks = shared_stacks_ptr.get();
+    for (std::uint64_t i = 0; i < array_size; ++i) {
+        new (shared_stacks + i)
+            global_stack<Cpu>(pattern->get_vertex_count(), allocator, max_shared_state_count);
+    }
+
+    // the engines are counted as busy when they start, so the engines that have not
+    // started yet are not waited for and keep their first states
+    std::int64_t busy_engine_count(0);
+    std::int64_t hungry_engine_count(0);
     std::int64_t cumulative_match_count(0);
     dal::detail::threader_for(array_size, array_size, [&](const int index) {
-        engine_array[index].run_and_wait(gstack,
+        engine_array[index].run_and_wait(shared_stacks,
+                                         index,
+                                         array_size,
                                          busy_engine_count,
+                                         hungry_engine_count,
                                          cumulative_match_count,
                                          max_match_count,
                                          false);
     });
 
+    for (std::uint64_t i = 0; i < array_size; i++) {
+        shared_stacks[i].~global_stack();
+    }
+
     auto aggregated_solution = combine_solutions(engine_array, array_size, max_match_count);
 
     for (std::uint64_t i = 0; i < array_size; i++) {
@@ -83,12 +83,16 @@ private:
 template <typename Cpu>
 class dfs_stack;
 
+/// Stack of the search states shared between the matching engines.
+/// If max_state_count is positive, the stack holds at most max_state_count states
+/// and push fails when it is full.
 template <typename Cpu>
 class global_stack {
 public:
-    global_stack(std::int64_t vertex_count, inner_alloc alloc)
+    global_stack(std::int64_t vertex_count, inner_alloc alloc, std::int64_t max_state_count = 0)
             : allocator(alloc),
-              vertex_count_(vertex_count) {}
+              vertex_count_(vertex_count),
+              max_state_count_(max_state_count) {}
 
     global_stack(const global_stack&) = delete;
     global_stack(global_stack&&) = delete;
@@ -103,8 +107,22 @@ public:
     bool push(dfs_stack<Cpu>& s);
     void pop(dfs_stack<Cpu>& s);
 
+    /// Moves the state from the shallowest level of the dfs stack having the alternatives,
+    /// so the state with the largest unexplored subtree is shared
+    bool push_shallowest(dfs_stack<Cpu>& s);
+
+    /// Pops the state into the empty dfs stack, if busy_engine_count is not nullptr,
+    /// it is incremented on success before the stack is unlocked, so the engines cannot
+    /// observe no busy engines while the state is moved
+    bool pop(dfs_stack<Cpu>& s, std::int64_t* busy_engine_count);
+
+    /// Returns the number of states in the stack without locking, may be outdated
+    std::int64_t approximate_size() {
+        return dal::detail::atomic_load(state_count_);
+    }
+
 private:
-    void internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
+    bool internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
     void clear();
     void grow();
 
@@ -126,6 +144,8 @@ private:
     std::uint64_t* bottom_{ nullptr };
     std::uint64_t* top_{ nullptr };
     std::int64_t capacity_{ 0 };
+    std::int64_t max_state_count_;
+    std::int64_t state_count_{ 0 };
 };
 
 template <typename Cpu>
@@ -401,21 +421,34 @@ template <typename Cpu>
 bool global_stack<Cpu>::push(dfs_stack<Cpu>& s) {
     for (auto level = s.get_current_level_index(); level > 0; --level) {
         if (s.data_by_levels[level].size() > 1) {
-            internal_push(s, level);
-            return true;
+            return internal_push(s, level);
         }
     }
 
     if (s.data_by_levels[0].size() > 1) {
-        internal_push(s, 0);
-        return true;
+        return internal_push(s, 0);
     }
 
     return false;
 }
 
+template <typename Cpu>
+bool global_stack<Cpu>::push_shallowest(dfs_stack<Cpu>& s) {
+    for (std::uint64_t level = 0; level <= s.get_current_level_index(); ++level) {
+        if (s.data_by_levels[level].size() > 1) {
+            return internal_push(s, level);
+        }
+    }
+    return false;
+}
+
 template <typename Cpu>
 void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
+    pop(s, nullptr);
+}
+
+template <typename Cpu>
+bool global_stack<Cpu>::pop(dfs_stack<Cpu>& s, std::int64_t* busy_engine_count) {
     ONEDAL_ASSERT(s.empty());
     const dal::detail::scoped_lock lock(mutex_);
     if (!empty()) {
@@ -430,11 +463,17 @@ void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
             }
         }
         top_ = v;
+        dal::detail::atomic_decrement(state_count_);
+        if (busy_engine_count != nullptr) {
+            dal::detail::atomic_increment(*busy_engine_count);
+        }
+        return true;
     }
+    return false;
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
+bool global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
     ONEDAL_ASSERT(vertex_count_ >= 0);
     // Collect state and push back
     {
@@ -460,6 +499,10 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
         v[level] = *(s.data_by_levels[level].bottom_);
 
         const dal::detail::scoped_lock lock(mutex_);
+        if (max_state_count_ > 0 && size() >= max_state_count_) {
+            allocator.deallocate(v, level + 1);
+            return false;
+        }
         if (size() >= capacity_) {
             grow();
         }
@@ -473,11 +516,13 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
             *(top_++) = null_vertex();
         }
 
+        dal::detail::atomic_increment(state_count_);
         allocator.deallocate(v, level + 1);
     }
 
     // Remove state
     ++(s.data_by_levels[level].bottom_);
+    return true;
 }
 
 template <typename Cpu>
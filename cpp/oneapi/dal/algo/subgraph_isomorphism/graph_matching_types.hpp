@@ -37,6 +37,8 @@ public:
     using task_t = Task;
     static_assert(detail::is_valid_graph<Graph>,
                   "Only undirected_adjacency_vector_graph is supported.");
+    static_assert(std::is_same_v<vertex_type<Graph>, std::int32_t>,
+                  "Only int32_t vertex indices are supported.");
     /// Constructs the algorithm input initialized with the target and pattern graphs.
     ///
     /// @param [in] target_graph  The input target (big) graph
@@ -22,6 +22,7 @@
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/algo/triangle_counting/backend/cpu/intersection_tc.hpp"
 #include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
@@ -163,6 +164,55 @@ std::int64_t triangle_counting_global_scalar(
     return total_s;
 }
 
+template <typename Cpu>
+std::int64_t triangle_counting_global_scalar(
+    const dal::preview::detail::compressed_topology<std::int32_t>& t) {
+    const std::int64_t vertex_count = t.get_vertex_count();
+    std::int32_t max_degree = 0;
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        max_degree = std::max(max_degree, t.get_vertex_degree(u));
+    }
+
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t(
+        vertex_count,
+        (std::int64_t)0,
+        [&](std::int64_t begin_u, std::int64_t end_u, std::int64_t tc_u) -> std::int64_t {
+            // the neighbor lists of u and v are decoded into the buffers of the range
+            auto u_neighbors = array<std::int32_t>::empty(std::max(max_degree, 1));
+            auto v_neighbors = array<std::int32_t>::empty(std::max(max_degree, 1));
+            std::int32_t* u_begin = u_neighbors.get_mutable_data();
+            std::int32_t* v_begin = v_neighbors.get_mutable_data();
+            for (auto u = begin_u; u != end_u; ++u) {
+                const std::int32_t* u_end = t.decode_vertex_neighbors(u, u_begin);
+                for (const std::int32_t* v_ = u_begin; v_ != u_end; ++v_) {
+                    std::int32_t v = *v_;
+                    if (v > u) {
+                        break;
+                    }
+                    const std::int32_t* v_end = t.decode_vertex_neighbors(v, v_begin);
+                    const std::int32_t* u_neighbors_ptr = u_begin;
+                    for (const std::int32_t* w_ = v_begin; w_ != v_end; ++w_) {
+                        std::int32_t w = *w_;
+                        if (w > v) {
+                            break;
+                        }
+                        while (*u_neighbors_ptr < w) {
+                            u_neighbors_ptr++;
+                        }
+                        if (w == *u_neighbors_ptr) {
+                            tc_u++;
+                        }
+                    }
+                }
+            }
+            return tc_u;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+    return total_s;
+}
+
 template <typename Cpu>
 std::int64_t triangle_counting_global_vector(
     const dal::preview::detail::topology<std::int32_t>& t) {
@@ -268,6 +318,173 @@ std::int64_t triangle_counting_global_vector_relabel(const std::int32_t* vertex_
     return total_s;
 }
 
+/// Calls the action for each triangle with two or three inserted edges that is
+/// counted more than once by the intersections over the inserted edges. The
+/// triangles are enumerated as the wedges of the inserted edges centered at the
+/// vertex a. The triangle with three inserted edges is found at each of its
+/// vertices, so the wedge centered at its lowest vertex is skipped to call the
+/// action twice for it, which is its number of extra counts.
+template <typename Cpu, typename Action>
+ONEDAL_FORCEINLINE void for_each_inserted_triangle_duplicate(
+    const dal::preview::detail::topology<std::int32_t>& t,
+    const std::int64_t* inserted_rows,
+    const std::int32_t* inserted_cols,
+    std::int32_t a,
+    const Action& action) {
+    const std::int32_t* a_inserted_begin = inserted_cols + inserted_rows[a];
+    const std::int32_t* a_inserted_end = inserted_cols + inserted_rows[a + 1];
+    for (auto b_ = a_inserted_begin; b_ != a_inserted_end; ++b_) {
+        const std::int32_t b = *b_;
+        const std::int32_t* c_ = b_ + 1;
+        const std::int32_t* w_ = t.get_vertex_neighbors_begin(b);
+        const std::int32_t* w_end = t.get_vertex_neighbors_end(b);
+        const std::int32_t* x_ = inserted_cols + inserted_rows[b];
+        const std::int32_t* x_end = inserted_cols + inserted_rows[b + 1];
+        while (c_ != a_inserted_end && w_ != w_end) {
+            if (*c_ < *w_) {
+                ++c_;
+            }
+            else if (*w_ < *c_) {
+                ++w_;
+            }
+            else {
+                const std::int32_t c = *c_;
+                bool is_lowest_wedge = false;
+                if (a < b) {
+                    while (x_ != x_end && *x_ < c) {
+                        ++x_;
+                    }
+                    is_lowest_wedge = (x_ != x_end && *x_ == c);
+                }
+                if (!is_lowest_wedge) {
+                    action(b, c);
+                }
+                ++c_;
+                ++w_;
+            }
+        }
+    }
+}
+
+template <typename Cpu>
+array<std::int64_t> triangle_counting_local_incremental(
+    const dal::preview::detail::topology<std::int32_t>& t,
+    const std::int64_t* inserted_rows,
+    const std::int32_t* inserted_cols,
+    const array<std::int64_t>& previous_triangles,
+    int64_t* triangles_local) {
+    const auto vertex_count = t.get_vertex_count();
+    int thread_cnt = dal::detail::threader_get_max_threads();
+
+    dal::detail::threader_for(thread_cnt * vertex_count,
+                              thread_cnt * vertex_count,
+                              [&](std::int64_t u) {
+                                  triangles_local[u] = 0;
+                              });
+
+    // Each inserted edge is processed once from its lower vertex and counts all
+    // triangles it closes in the updated graph
+    dal::detail::threader_for_simple(vertex_count, vertex_count, [&](std::int32_t u) {
+        const std::int32_t* u_inserted_begin = inserted_cols + inserted_rows[u];
+        const std::int32_t* u_inserted_end = inserted_cols + inserted_rows[u + 1];
+        if (u_inserted_begin == u_inserted_end)
+            return;
+        dal::detail::threader_for_int32ptr(
+            u_inserted_begin,
+            u_inserted_end,
+            [&](const std::int32_t* v_) {
+                std::int32_t v = *v_;
+                if (v < u) {
+                    return;
+                }
+                int thread_id = dal::detail::threader_get_current_thread_index();
+                int64_t indx = (int64_t)thread_id * (int64_t)vertex_count;
+
+                auto tc = intersection_local_tc<Cpu>{}(t.get_vertex_neighbors_begin(u),
+                                                       t.get_vertex_neighbors_begin(v),
+                                                       t.get_vertex_degree(u),
+                                                       t.get_vertex_degree(v),
+                                                       triangles_local + indx,
+                                                       vertex_count);
+
+                triangles_local[indx + u] += tc;
+                triangles_local[indx + v] += tc;
+            });
+    });
+
+    // The triangles closed by several inserted edges are counted once per inserted edge
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t a) {
+        if (inserted_rows[a + 1] - inserted_rows[a] < 2)
+            return;
+        int thread_id = dal::detail::threader_get_current_thread_index();
+        int64_t indx = (int64_t)thread_id * (int64_t)vertex_count;
+        for_each_inserted_triangle_duplicate<Cpu>(t,
+                                                  inserted_rows,
+                                                  inserted_cols,
+                                                  a,
+                                                  [&](std::int32_t b, std::int32_t c) {
+                                                      triangles_local[indx + a]--;
+                                                      triangles_local[indx + b]--;
+                                                      triangles_local[indx + c]--;
+                                                  });
+    });
+
+    auto arr_triangles = array<std::int64_t>::empty(vertex_count);
+
+    int64_t* triangles_ptr = arr_triangles.get_mutable_data();
+    const int64_t* previous_ptr = previous_triangles.get_data();
+    const std::int64_t previous_count = previous_triangles.get_count();
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t u) {
+        triangles_ptr[u] = u < previous_count ? previous_ptr[u] : 0;
+        for (int j = 0; j < thread_cnt; j++) {
+            int64_t idx_glob = (int64_t)j * (int64_t)vertex_count;
+            triangles_ptr[u] += triangles_local[idx_glob + u];
+        }
+    });
+    return arr_triangles;
+}
+
+template <typename Cpu>
+std::int64_t triangle_counting_global_incremental(
+    const dal::preview::detail::topology<std::int32_t>& t,
+    const std::int64_t* inserted_rows,
+    const std::int32_t* inserted_cols) {
+    std::int64_t total_s = oneapi::dal::detail::parallel_reduce_int32_int64_t_simple(
+        t.get_vertex_count(),
+        (std::int64_t)0,
+        [&](std::int64_t begin_u, std::int64_t end_u, std::int64_t tc_u) -> std::int64_t {
+            for (auto u = begin_u; u != end_u; ++u) {
+                for (auto v_ = inserted_cols + inserted_rows[u];
+                     v_ != inserted_cols + inserted_rows[u + 1];
+                     ++v_) {
+                    std::int32_t v = *v_;
+                    if (v < u) {
+                        continue;
+                    }
+                    tc_u += preview::backend::intersection<Cpu>(t.get_vertex_neighbors_begin(u),
+                                                                t.get_vertex_neighbors_begin(v),
+                                                                t.get_vertex_degree(u),
+                                                                t.get_vertex_degree(v));
+                }
+                if (inserted_rows[u + 1] - inserted_rows[u] >= 2) {
+                    for_each_inserted_triangle_duplicate<Cpu>(t,
+                                                              inserted_rows,
+                                                              inserted_cols,
+                                                              u,
+                                                              [&](std::int32_t, std::int32_t) {
+                                                                  tc_u--;
+                                                              });
+                }
+            }
+            return tc_u;
+        },
+        [&](std::int64_t x, std::int64_t y) -> std::int64_t {
+            return x + y;
+        });
+    return total_s;
+}
+
 template <typename Cpu>
 std::int64_t compute_global_triangles(const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
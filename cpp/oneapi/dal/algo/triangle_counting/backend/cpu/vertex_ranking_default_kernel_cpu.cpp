@@ -35,6 +35,18 @@ template std::int64_t triangle_counting_global_vector_relabel<__CPU_TAG__>(
     std::int64_t vertex_count,
     std::int64_t edge_count);
 
+template array<std::int64_t> triangle_counting_local_incremental<__CPU_TAG__>(
+    const dal::preview::detail::topology<std::int32_t>& t,
+    const std::int64_t* inserted_rows,
+    const std::int32_t* inserted_cols,
+    const array<std::int64_t>& previous_triangles,
+    int64_t* triangles_local);
+
+template std::int64_t triangle_counting_global_incremental<__CPU_TAG__>(
+    const dal::preview::detail::topology<std::int32_t>& t,
+    const std::int64_t* inserted_rows,
+    const std::int32_t* inserted_cols);
+
 template std::int64_t compute_global_triangles<__CPU_TAG__>(
     const array<std::int64_t>& local_triangles,
     std::int64_t vertex_count);
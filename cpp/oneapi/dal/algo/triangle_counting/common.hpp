@@ -30,6 +30,9 @@ using by_default = local;
 
 namespace method {
 struct ordered_count {};
+// Updates the triangle counts of the graph before the insertion of a batch of edges
+// by counting only the triangles closed by the inserted edges.
+struct incremental {};
 using by_default = ordered_count;
 } // namespace method
 
@@ -54,7 +57,8 @@ using enable_if_global_t =
     std::enable_if_t<dal::detail::is_one_of_v<T, task::global, task::local_and_global>>;
 
 template <typename Method>
-constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::ordered_count>;
+constexpr bool is_valid_method =
+    dal::detail::is_one_of_v<Method, method::ordered_count, method::incremental>;
 
 template <typename Task>
 constexpr bool is_valid_task =
@@ -30,9 +30,12 @@ struct backend_base {
     using method_t = typename Descriptor::method_t;
     using allocator_t = typename Descriptor::allocator_t;
 
-    virtual vertex_ranking_result<task_t> operator()(const Policy& ctx,
-                                                     const Descriptor& descriptor,
-                                                     const Topology& t) = 0;
+    virtual vertex_ranking_result<task_t> operator()(
+        const Policy& ctx,
+        const Descriptor& descriptor,
+        const Topology& t,
+        const table& inserted_edges,
+        const vertex_ranking_result<task_t>& previous_result) = 0;
     virtual ~backend_base() = default;
 };
 
@@ -46,14 +49,28 @@ struct backend_default : public backend_base<Policy, Descriptor, Topology> {
     using method_t = typename Descriptor::method_t;
     using allocator_t = typename Descriptor::allocator_t;
 
-    virtual vertex_ranking_result<task_t> operator()(const Policy& ctx,
-                                                     const Descriptor& descriptor,
-                                                     const Topology& t) {
-        return vertex_ranking_kernel_cpu<method_t, task_t, allocator_t, Topology>()(
-            ctx,
-            descriptor,
-            descriptor.get_allocator(),
-            t);
+    virtual vertex_ranking_result<task_t> operator()(
+        const Policy& ctx,
+        const Descriptor& descriptor,
+        const Topology& t,
+        const table& inserted_edges,
+        const vertex_ranking_result<task_t>& previous_result) {
+        if constexpr (std::is_same_v<method_t, method::incremental>) {
+            return vertex_ranking_kernel_cpu<method_t, task_t, allocator_t, Topology>()(
+                ctx,
+                descriptor,
+                descriptor.get_allocator(),
+                t,
+                inserted_edges,
+                previous_result);
+        }
+        else {
+            return vertex_ranking_kernel_cpu<method_t, task_t, allocator_t, Topology>()(
+                ctx,
+                descriptor,
+                descriptor.get_allocator(),
+                t);
+        }
     }
 };
 
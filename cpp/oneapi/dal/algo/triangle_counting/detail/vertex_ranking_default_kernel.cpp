@@ -41,6 +41,18 @@ operator()(const dal::detail::host_policy& policy,
     });
 }
 
+template <typename Float>
+std::int64_t triangle_counting<Float,
+                               task::global,
+                               dal::preview::detail::compressed_topology<std::int32_t>,
+                               scalar>::
+operator()(const dal::detail::host_policy& policy,
+           const dal::preview::detail::compressed_topology<std::int32_t>& t) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_global_scalar<decltype(cpu)>(t);
+    });
+}
+
 template <typename Float>
 std::int64_t
 triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, vector>::
@@ -71,6 +83,38 @@ std::int64_t triangle_counting<Float,
     });
 }
 
+template <typename Float>
+array<std::int64_t>
+triangle_counting<Float, task::local, dal::preview::detail::topology<std::int32_t>, inserted>::
+operator()(const dal::detail::host_policy& policy,
+           const dal::preview::detail::topology<std::int32_t>& t,
+           const std::int64_t* inserted_rows,
+           const std::int32_t* inserted_cols,
+           const array<std::int64_t>& previous_triangles,
+           std::int64_t* triangles_local) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_local_incremental<decltype(cpu)>(t,
+                                                                           inserted_rows,
+                                                                           inserted_cols,
+                                                                           previous_triangles,
+                                                                           triangles_local);
+    });
+}
+
+template <typename Float>
+std::int64_t
+triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, inserted>::
+operator()(const dal::detail::host_policy& policy,
+           const dal::preview::detail::topology<std::int32_t>& t,
+           const std::int64_t* inserted_rows,
+           const std::int32_t* inserted_cols) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::triangle_counting_global_incremental<decltype(cpu)>(t,
+                                                                            inserted_rows,
+                                                                            inserted_cols);
+    });
+}
+
 std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
                                       const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
@@ -88,10 +132,22 @@ template struct ONEDAL_EXPORT
 template struct ONEDAL_EXPORT
     triangle_counting<float, task::global, dal::preview::detail::topology<std::int32_t>, vector>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float,
+                      task::global,
+                      dal::preview::detail::compressed_topology<std::int32_t>,
+                      scalar>;
+
 template struct ONEDAL_EXPORT triangle_counting<float,
                                                 task::global,
                                                 dal::preview::detail::topology<std::int32_t>,
                                                 vector,
                                                 relabeled>;
 
+template struct ONEDAL_EXPORT
+    triangle_counting<float, task::local, dal::preview::detail::topology<std::int32_t>, inserted>;
+
+template struct ONEDAL_EXPORT
+    triangle_counting<float, task::global, dal::preview::detail::topology<std::int32_t>, inserted>;
+
 } // namespace oneapi::dal::preview::triangle_counting::detail
@@ -16,13 +16,19 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "oneapi/dal/algo/triangle_counting/common.hpp"
 #include "oneapi/dal/algo/triangle_counting/detail/relabel_kernel.hpp"
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking_types.hpp"
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
 #include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::preview::triangle_counting::detail {
 
@@ -39,6 +45,7 @@ struct vector {};
 struct automatic {};
 
 struct relabeled {};
+struct inserted {};
 
 template <typename Float, typename Task, typename Topology, typename... Param>
 struct triangle_counting {
@@ -75,6 +82,15 @@ struct triangle_counting<Float,
                             const dal::preview::detail::topology<std::int32_t>& t) const;
 };
 
+template <typename Float>
+struct triangle_counting<Float,
+                         task::global,
+                         dal::preview::detail::compressed_topology<std::int32_t>,
+                         scalar> {
+    std::int64_t operator()(const dal::detail::host_policy& ctx,
+                            const dal::preview::detail::compressed_topology<std::int32_t>& t) const;
+};
+
 template <typename Float>
 struct triangle_counting<Float,
                          task::global,
@@ -89,6 +105,30 @@ struct triangle_counting<Float,
                             std::int64_t edge_count) const;
 };
 
+template <typename Float>
+struct triangle_counting<Float,
+                         task::local,
+                         dal::preview::detail::topology<std::int32_t>,
+                         inserted> {
+    array<std::int64_t> operator()(const dal::detail::host_policy& ctx,
+                                   const dal::preview::detail::topology<std::int32_t>& t,
+                                   const std::int64_t* inserted_rows,
+                                   const std::int32_t* inserted_cols,
+                                   const array<std::int64_t>& previous_triangles,
+                                   std::int64_t* triangles_local) const;
+};
+
+template <typename Float>
+struct triangle_counting<Float,
+                         task::global,
+                         dal::preview::detail::topology<std::int32_t>,
+                         inserted> {
+    std::int64_t operator()(const dal::detail::host_policy& ctx,
+                            const dal::preview::detail::topology<std::int32_t>& t,
+                            const std::int64_t* inserted_rows,
+                            const std::int32_t* inserted_cols) const;
+};
+
 ONEDAL_EXPORT std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
                                                     const array<std::int64_t>& local_triangles,
                                                     std::int64_t vertex_count);
@@ -252,4 +292,185 @@ struct vertex_ranking_kernel_cpu<method::ordered_count,
     }
 };
 
+/// Builds the adjacency of the inserted edges in both directions. The neighbors of
+/// each vertex are sorted and deduplicated, so the edge listed several times in the
+/// inserted edges table is counted once.
+template <typename Topology>
+struct build_inserted_topology {
+    inline void operator()(const Topology& t,
+                           const array<std::int32_t>& inserted_edges,
+                           std::int64_t inserted_edge_count,
+                           std::int64_t* inserted_rows,
+                           std::int32_t* inserted_cols) const {
+        const auto vertex_count = t.get_vertex_count();
+        const std::int32_t* edges = inserted_edges.get_data();
+
+        for (std::int64_t u = 0; u <= vertex_count; ++u) {
+            inserted_rows[u] = 0;
+        }
+        for (std::int64_t i = 0; i < inserted_edge_count; ++i) {
+            inserted_rows[edges[2 * i] + 1]++;
+            inserted_rows[edges[2 * i + 1] + 1]++;
+        }
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            inserted_rows[u + 1] += inserted_rows[u];
+        }
+        for (std::int64_t i = 0; i < inserted_edge_count; ++i) {
+            const std::int32_t u = edges[2 * i];
+            const std::int32_t v = edges[2 * i + 1];
+            inserted_cols[inserted_rows[u]++] = v;
+            inserted_cols[inserted_rows[v]++] = u;
+        }
+
+        std::int64_t begin = 0;
+        std::int64_t inserted_count = 0;
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            const std::int64_t end = inserted_rows[u];
+            std::sort(inserted_cols + begin, inserted_cols + end);
+            std::int32_t* unique_end = std::unique(inserted_cols + begin, inserted_cols + end);
+            const std::int64_t unique_count = unique_end - (inserted_cols + begin);
+            if (inserted_count != begin) {
+                std::copy(inserted_cols + begin, unique_end, inserted_cols + inserted_count);
+            }
+            inserted_rows[u] = inserted_count;
+            inserted_count += unique_count;
+            begin = end;
+        }
+        inserted_rows[vertex_count] = inserted_count;
+    }
+};
+
+template <typename Topology>
+inline void check_inserted_edges(const Topology& t,
+                                 const array<std::int32_t>& inserted_edges,
+                                 std::int64_t inserted_edge_count) {
+    using msg = dal::detail::error_messages;
+    const auto vertex_count = t.get_vertex_count();
+    const std::int32_t* edges = inserted_edges.get_data();
+    for (std::int64_t i = 0; i < inserted_edge_count; ++i) {
+        const std::int32_t u = edges[2 * i];
+        const std::int32_t v = edges[2 * i + 1];
+        if (u < 0 || u >= vertex_count || v < 0 || v >= vertex_count) {
+            throw out_of_range(msg::vertex_index_out_of_range_expect_from_zero_to_vertex_count());
+        }
+        if (u == v) {
+            throw invalid_argument(msg::inserted_edge_is_self_loop());
+        }
+        if (!std::binary_search(t.get_vertex_neighbors_begin(u),
+                                t.get_vertex_neighbors_end(u),
+                                v)) {
+            throw invalid_argument(msg::inserted_edge_is_not_in_graph());
+        }
+    }
+}
+
+/// Returns the per-vertex triangle counts of the previous result. The table computed by
+/// the algorithm keeps std::int64_t values and is used without a copy.
+inline array<std::int64_t> get_previous_triangles(const table& previous_ranks) {
+    const std::int64_t vertex_count = previous_ranks.get_row_count();
+    if (vertex_count == 0) {
+        return array<std::int64_t>{};
+    }
+    if (previous_ranks.get_kind() == homogen_table::kind() &&
+        previous_ranks.get_metadata().get_data_type(0) == data_type::int64) {
+        const auto& ranks = static_cast<const homogen_table&>(previous_ranks);
+        return array<std::int64_t>::wrap(ranks.get_data<std::int64_t>(), vertex_count);
+    }
+    const std::int64_t column_count = previous_ranks.get_column_count();
+    const auto ranks = row_accessor<const double>(previous_ranks).pull();
+    auto previous_triangles = array<std::int64_t>::empty(vertex_count);
+    std::int64_t* previous_triangles_ptr = previous_triangles.get_mutable_data();
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        previous_triangles_ptr[u] = static_cast<std::int64_t>(ranks[u * column_count]);
+    }
+    return previous_triangles;
+}
+
+template <typename Task, typename Allocator, typename Topology>
+struct vertex_ranking_kernel_cpu<method::incremental, Task, Allocator, Topology> {
+    inline vertex_ranking_result<Task> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<Task>& desc,
+        const Allocator& alloc,
+        const Topology& t,
+        const table& inserted_edges,
+        const vertex_ranking_result<Task>& previous_result) const {
+        const auto vertex_count = t.get_vertex_count();
+        if (vertex_count == 0) {
+            return previous_result;
+        }
+
+        const std::int64_t inserted_edge_count = inserted_edges.get_row_count();
+        auto inserted_edges_data = inserted_edge_count > 0
+                                       ? row_accessor<const std::int32_t>(inserted_edges).pull()
+                                       : array<std::int32_t>{};
+        check_inserted_edges(t, inserted_edges_data, inserted_edge_count);
+
+        using int32_allocator_type =
+            typename std::allocator_traits<Allocator>::template rebind_alloc<std::int32_t>;
+        using int64_allocator_type =
+            typename std::allocator_traits<Allocator>::template rebind_alloc<std::int64_t>;
+
+        int32_allocator_type int32_allocator(alloc);
+        int64_allocator_type int64_allocator(alloc);
+
+        const std::int64_t inserted_cols_count = std::max(inserted_edge_count * 2, std::int64_t(1));
+        std::int64_t* inserted_rows =
+            oneapi::dal::preview::detail::allocate(int64_allocator, vertex_count + 1);
+        std::int32_t* inserted_cols =
+            oneapi::dal::preview::detail::allocate(int32_allocator, inserted_cols_count);
+
+        build_inserted_topology<Topology>{}(t,
+                                            inserted_edges_data,
+                                            inserted_edge_count,
+                                            inserted_rows,
+                                            inserted_cols);
+
+        vertex_ranking_result<Task> res;
+        if constexpr (std::is_same_v<Task, task::global>) {
+            const std::int64_t inserted_triangles =
+                triangle_counting<float, task::global, Topology, inserted>{}(ctx,
+                                                                             t,
+                                                                             inserted_rows,
+                                                                             inserted_cols);
+            res.set_global_rank(previous_result.get_global_rank() + inserted_triangles);
+        }
+        else {
+            auto previous_triangles = get_previous_triangles(previous_result.get_ranks());
+
+            std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
+            int64_t* triangles_local =
+                oneapi::dal::preview::detail::allocate(int64_allocator,
+                                                       thread_cnt * (int64_t)vertex_count);
+
+            auto local_triangles =
+                triangle_counting<float, task::local, Topology, inserted>{}(ctx,
+                                                                            t,
+                                                                            inserted_rows,
+                                                                            inserted_cols,
+                                                                            previous_triangles,
+                                                                            triangles_local);
+
+            oneapi::dal::preview::detail::deallocate(int64_allocator,
+                                                     triangles_local,
+                                                     thread_cnt * (int64_t)vertex_count);
+
+            res.set_ranks(dal::detail::homogen_table_builder{}
+                              .reset(local_triangles, vertex_count, 1)
+                              .build());
+            if constexpr (std::is_same_v<Task, task::local_and_global>) {
+                res.set_global_rank(compute_global_triangles(ctx, local_triangles, vertex_count));
+            }
+        }
+
+        oneapi::dal::preview::detail::deallocate(int64_allocator,
+                                                 inserted_rows,
+                                                 vertex_count + 1);
+        oneapi::dal::preview::detail::deallocate(int32_allocator,
+                                                 inserted_cols,
+                                                 inserted_cols_count);
+        return res;
+    }
+};
+
 } // namespace oneapi::dal::preview::triangle_counting::detail
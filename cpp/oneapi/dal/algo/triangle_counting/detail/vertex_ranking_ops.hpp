@@ -32,10 +32,33 @@ struct vertex_ranking_ops_dispatcher {
     vertex_ranking_result<task_t> operator()(const Policy &policy,
                                              const Descriptor &descriptor,
                                              vertex_ranking_input<Graph, task_t> &input) const {
+        using method_t = typename Descriptor::method_t;
+        if constexpr (std::is_same_v<task_t, task::global> &&
+                      std::is_same_v<method_t, method::ordered_count>) {
+            // the compressed neighbor lists are read if the graph has them and
+            // the vertices are not relabeled
+            const auto &graph_impl = dal::detail::get_impl(input.get_graph());
+            if (graph_impl.has_compressed_topology() && descriptor.get_relabel() == relabel::no) {
+                const auto &ct = graph_impl.get_compressed_topology();
+                const std::int64_t triangles =
+                    triangle_counting<float,
+                                      task::global,
+                                      dal::preview::detail::compressed_topology<std::int32_t>,
+                                      scalar>()(policy, ct);
+                vertex_ranking_result<task_t> res;
+                res.set_global_rank(triangles);
+                return res;
+            }
+        }
+
         const auto &t = dal::preview::detail::csr_topology_builder<Graph>()(input.get_graph());
 
         static auto impl = get_backend<Policy, Descriptor>(descriptor, t);
-        return (*impl)(policy, descriptor, t);
+        return (*impl)(policy,
+                       descriptor,
+                       t,
+                       input.get_inserted_edges(),
+                       input.get_previous_result());
     }
 };
 
@@ -50,8 +73,28 @@ struct vertex_ranking_ops {
     using result_t = vertex_ranking_result<task_t>;
     using descriptor_base_t = descriptor_base<task_t>;
 
+    void check_preconditions(const Descriptor &desc, input_t &input) const {
+        using msg = dal::detail::error_messages;
+
+        if constexpr (std::is_same_v<method_t, method::incremental>) {
+            const auto &inserted_edges = input.get_inserted_edges();
+            if (inserted_edges.get_row_count() > 0 && inserted_edges.get_column_count() != 2) {
+                throw invalid_argument(msg::input_inserted_edges_table_has_wrong_cc_expect_two());
+            }
+            if constexpr (!std::is_same_v<task_t, task::global>) {
+                const std::int64_t vertex_count =
+                    dal::detail::get_impl(input.get_graph()).get_topology()._vertex_count;
+                const auto &previous_ranks = input.get_previous_result().get_ranks();
+                if (previous_ranks.get_row_count() > vertex_count) {
+                    throw invalid_argument(msg::input_previous_ranks_rc_gt_vertex_count());
+                }
+            }
+        }
+    }
+
     template <typename Policy>
     auto operator()(const Policy &policy, const Descriptor &desc, input_t &input) const {
+        check_preconditions(desc, input);
         return vertex_ranking_ops_dispatcher<Policy, Descriptor, Graph>()(policy, desc, input);
     }
 };
@@ -22,7 +22,12 @@
 
 #include "oneapi/dal/algo/triangle_counting/common.hpp"
 
-namespace oneapi::dal::preview::triangle_counting::detail {
+namespace oneapi::dal::preview::triangle_counting {
+
+template <typename Task>
+class vertex_ranking_result;
+
+namespace detail {
 
 class vertex_ranking_result_impl;
 
@@ -31,7 +36,17 @@ class vertex_ranking_input_impl : public base {
 public:
     vertex_ranking_input_impl(const Graph& g) : graph_data(g) {}
 
+    vertex_ranking_input_impl(const Graph& g,
+                              const table& inserted_edges,
+                              const vertex_ranking_result<Task>& previous_result)
+            : graph_data(g),
+              inserted_edges(inserted_edges),
+              previous_result(previous_result) {}
+
     const Graph& graph_data;
+    table inserted_edges;
+    vertex_ranking_result<Task> previous_result;
 };
 
-} // namespace oneapi::dal::preview::triangle_counting::detail
+} // namespace detail
+} // namespace oneapi::dal::preview::triangle_counting
@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking.hpp"
 
@@ -249,6 +251,136 @@ public:
         return g;
     }
 
+    auto create_graph(std::int64_t vertex_count,
+                      const std::vector<std::int64_t> &graph_rows,
+                      const std::vector<std::int32_t> &graph_cols) {
+        dal::preview::undirected_adjacency_vector_graph<> g;
+        auto &graph_impl = oneapi::dal::detail::get_impl(g);
+        auto &vertex_allocator = graph_impl._vertex_allocator;
+        auto &edge_allocator = graph_impl._edge_allocator;
+
+        const std::int64_t cols_count = graph_cols.size();
+        const std::int64_t rows_count = vertex_count + 1;
+
+        std::int32_t *degrees =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, vertex_count);
+        std::int32_t *cols =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, std::max(cols_count, std::int64_t(1)));
+        std::int64_t *rows = oneapi::dal::preview::detail::allocate(edge_allocator, rows_count);
+        std::int32_t *rows_vertex =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, rows_count);
+
+        for (int i = 0; i < vertex_count; i++) {
+            degrees[i] = graph_rows[i + 1] - graph_rows[i];
+        }
+        for (int i = 0; i < cols_count; i++) {
+            cols[i] = graph_cols[i];
+        }
+        for (int i = 0; i < rows_count; i++) {
+            rows[i] = graph_rows[i];
+            rows_vertex[i] = graph_rows[i];
+        }
+        graph_impl.set_topology(vertex_count, cols_count / 2, rows, cols, cols_count, degrees);
+        graph_impl.get_topology()._rows_vertex =
+            oneapi::dal::preview::detail::container<std::int32_t>::wrap(rows_vertex, rows_count);
+        return g;
+    }
+
+    template <typename Task>
+    auto compute_ranking(const dal::preview::undirected_adjacency_vector_graph<> &g) {
+        std::allocator<char> alloc;
+        const auto tc_desc = dal::preview::triangle_counting::descriptor<
+                                 float,
+                                 dal::preview::triangle_counting::method::ordered_count,
+                                 Task,
+                                 std::allocator<char>>(alloc)
+                                 .set_relabel(dal::preview::triangle_counting::relabel::no);
+        return dal::preview::vertex_ranking(tc_desc, g);
+    }
+
+    /// Inserts each inserted_edge_stride-th edge of the graph into the graph without them
+    /// and checks the updated triangle counts against the known ones
+    template <typename GraphType, typename Task>
+    void check_incremental_task(std::int64_t inserted_edge_stride) {
+        GraphType graph_data;
+        const auto g = create_graph<GraphType>();
+        const std::int64_t vertex_count = graph_data.get_vertex_count();
+
+        std::vector<std::int64_t> previous_rows(vertex_count + 1, 0);
+        std::vector<std::int32_t> previous_cols;
+        std::vector<std::int32_t> inserted_edges;
+        std::int64_t edge_index = 0;
+        for (std::int32_t u = 0; u < vertex_count; u++) {
+            for (std::int64_t i = graph_data.rows[u]; i < graph_data.rows[u + 1]; i++) {
+                const std::int32_t v = graph_data.cols[i];
+                if (u < v && edge_index++ % inserted_edge_stride == 0) {
+                    inserted_edges.push_back(v);
+                    inserted_edges.push_back(u);
+                }
+            }
+        }
+        auto is_inserted = [&](std::int32_t u, std::int32_t v) {
+            for (std::size_t i = 0; i < inserted_edges.size(); i += 2) {
+                if ((inserted_edges[i] == u && inserted_edges[i + 1] == v) ||
+                    (inserted_edges[i] == v && inserted_edges[i + 1] == u)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        for (std::int32_t u = 0; u < vertex_count; u++) {
+            for (std::int64_t i = graph_data.rows[u]; i < graph_data.rows[u + 1]; i++) {
+                if (!is_inserted(u, graph_data.cols[i])) {
+                    previous_cols.push_back(graph_data.cols[i]);
+                }
+            }
+            previous_rows[u + 1] = previous_cols.size();
+        }
+
+        const auto previous_graph = create_graph(vertex_count, previous_rows, previous_cols);
+        const auto previous_result = compute_ranking<Task>(previous_graph);
+
+        const std::int64_t inserted_edge_count = inserted_edges.size() / 2;
+        const auto inserted_edges_table =
+            dal::homogen_table::wrap(inserted_edges.data(), inserted_edge_count, 2);
+
+        std::allocator<char> alloc;
+        const auto tc_desc = dal::preview::triangle_counting::
+            descriptor<float, dal::preview::triangle_counting::method::incremental, Task>(alloc);
+
+        const auto result_vertex_ranking =
+            dal::preview::vertex_ranking(tc_desc, g, inserted_edges_table, previous_result);
+
+        if constexpr (!std::is_same_v<Task, dal::preview::triangle_counting::task::global>) {
+            const auto local_triangles_table = result_vertex_ranking.get_ranks();
+            const auto &local_triangles =
+                static_cast<const dal::homogen_table &>(local_triangles_table);
+            const auto local_triangles_data = local_triangles.get_data<std::int64_t>();
+
+            REQUIRE(local_triangles_table.get_row_count() == vertex_count);
+            for (std::int64_t i = 0; i < vertex_count; i++) {
+                REQUIRE(local_triangles_data[i] == graph_data.local_triangles[i]);
+            }
+        }
+        if constexpr (!std::is_same_v<Task, dal::preview::triangle_counting::task::local>) {
+            REQUIRE(result_vertex_ranking.get_global_rank() ==
+                    graph_data.get_global_triangle_count());
+        }
+    }
+
+    template <typename GraphType>
+    void check_incremental_tasks() {
+        for (std::int64_t stride : { 1, 2, 3, 5 }) {
+            this->check_incremental_task<GraphType, dal::preview::triangle_counting::task::local>(
+                stride);
+            this->check_incremental_task<GraphType,
+                                         dal::preview::triangle_counting::task::global>(stride);
+            this->check_incremental_task<GraphType,
+                                         dal::preview::triangle_counting::task::local_and_global>(
+                stride);
+        }
+    }
+
     template <typename GraphType>
     void check_local_task() {
         GraphType graph_data;
@@ -331,6 +463,18 @@ public:
         REQUIRE(result_vertex_ranking.get_global_rank() == global_triangle_count);
     }
 
+    template <typename GraphType>
+    void check_global_task_compressed() {
+        GraphType graph_data;
+        auto g = create_graph<GraphType>();
+        oneapi::dal::detail::get_impl(g).compress_topology();
+        REQUIRE(oneapi::dal::detail::get_impl(g).has_compressed_topology());
+
+        const auto result_vertex_ranking =
+            compute_ranking<dal::preview::triangle_counting::task::global>(g);
+        REQUIRE(result_vertex_ranking.get_global_rank() == graph_data.get_global_triangle_count());
+    }
+
     template <typename GraphType>
     void check_global_task_not_relabeled() {
         GraphType graph_data;
@@ -400,6 +544,106 @@ TEST_M(triangle_counting_test, "Global task: not relabeled graph with average_de
     this->check_global_task_not_relabeled<graph_with_isolated_vertex_11_type>();
 }
 
+TEST_M(triangle_counting_test, "Global task: compressed topology") {
+    this->check_global_task_compressed<complete_graph_5_type>();
+    this->check_global_task_compressed<complete_graph_9_type>();
+    this->check_global_task_compressed<acyclic_graph_8_type>();
+    this->check_global_task_compressed<two_vertices_graph_type>();
+    this->check_global_task_compressed<cycle_graph_9_type>();
+    this->check_global_task_compressed<triangle_graph_type>();
+    this->check_global_task_compressed<wheel_graph_6_type>();
+    this->check_global_task_compressed<graph_with_isolated_vertices_10_type>();
+    this->check_global_task_compressed<graph_with_isolated_vertex_11_type>();
+}
+
+TEST_M(triangle_counting_test, "Incremental method: graph with average_degree < 4") {
+    this->check_incremental_tasks<complete_graph_5_type>();
+    this->check_incremental_tasks<acyclic_graph_8_type>();
+    this->check_incremental_tasks<two_vertices_graph_type>();
+    this->check_incremental_tasks<cycle_graph_9_type>();
+    this->check_incremental_tasks<triangle_graph_type>();
+    this->check_incremental_tasks<wheel_graph_6_type>();
+    this->check_incremental_tasks<graph_with_isolated_vertices_10_type>();
+}
+
+TEST_M(triangle_counting_test, "Incremental method: graph with average_degree >= 4") {
+    this->check_incremental_tasks<complete_graph_9_type>();
+    this->check_incremental_tasks<graph_with_isolated_vertex_11_type>();
+}
+
+TEST_M(triangle_counting_test, "Incremental method: duplicated inserted edges") {
+    complete_graph_5_type graph_data;
+    const auto g = create_graph<complete_graph_5_type>();
+    const std::vector<std::int64_t> previous_rows = { 0, 3, 5, 7, 9, 12 };
+    const std::vector<std::int32_t> previous_cols = { 1, 2, 3, 0, 4, 0, 4, 0, 4, 1, 2, 3 };
+    const auto previous_graph = create_graph(5, previous_rows, previous_cols);
+    const auto previous_result =
+        compute_ranking<dal::preview::triangle_counting::task::local_and_global>(previous_graph);
+
+    const std::array<std::int32_t, 16> inserted_edges = { 0, 4, 1, 2, 2, 1, 1, 3,
+                                                          2, 3, 4, 0, 3, 2, 1, 2 };
+    const auto inserted_edges_table = dal::homogen_table::wrap(inserted_edges.data(), 8, 2);
+
+    std::allocator<char> alloc;
+    const auto tc_desc = dal::preview::triangle_counting::descriptor<
+        float,
+        dal::preview::triangle_counting::method::incremental,
+        dal::preview::triangle_counting::task::local_and_global>(alloc);
+    const auto result_vertex_ranking =
+        dal::preview::vertex_ranking(tc_desc, g, inserted_edges_table, previous_result);
+
+    const auto &local_triangles =
+        static_cast<const dal::homogen_table &>(result_vertex_ranking.get_ranks());
+    const auto local_triangles_data = local_triangles.get_data<std::int64_t>();
+    for (std::int64_t i = 0; i < graph_data.get_vertex_count(); i++) {
+        REQUIRE(local_triangles_data[i] == graph_data.local_triangles[i]);
+    }
+    REQUIRE(result_vertex_ranking.get_global_rank() == graph_data.get_global_triangle_count());
+}
+
+TEST_M(triangle_counting_test, "Incremental method: inserted edge is not in graph") {
+    const auto g = create_graph<wheel_graph_6_type>();
+    const auto previous_result =
+        compute_ranking<dal::preview::triangle_counting::task::local_and_global>(g);
+
+    std::allocator<char> alloc;
+    const auto tc_desc = dal::preview::triangle_counting::descriptor<
+        float,
+        dal::preview::triangle_counting::method::incremental,
+        dal::preview::triangle_counting::task::local_and_global>(alloc);
+
+    const std::array<std::int32_t, 2> missing_edge = { 1, 3 };
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(tc_desc,
+                                     g,
+                                     dal::homogen_table::wrap(missing_edge.data(), 1, 2),
+                                     previous_result),
+        invalid_argument);
+
+    const std::array<std::int32_t, 2> self_loop = { 2, 2 };
+    REQUIRE_THROWS_AS(dal::preview::vertex_ranking(tc_desc,
+                                                   g,
+                                                   dal::homogen_table::wrap(self_loop.data(), 1, 2),
+                                                   previous_result),
+                      invalid_argument);
+
+    const std::array<std::int32_t, 2> out_of_range_edge = { 0, 6 };
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(tc_desc,
+                                     g,
+                                     dal::homogen_table::wrap(out_of_range_edge.data(), 1, 2),
+                                     previous_result),
+        out_of_range);
+
+    const std::array<std::int32_t, 3> wrong_column_count = { 0, 1, 2 };
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(tc_desc,
+                                     g,
+                                     dal::homogen_table::wrap(wrong_column_count.data(), 1, 3),
+                                     previous_result),
+        invalid_argument);
+}
+
 TEST_M(triangle_counting_test, "Local task: null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     std::allocator<char> alloc;
@@ -21,7 +21,7 @@ namespace oneapi::dal::preview::triangle_counting {
 class detail::vertex_ranking_result_impl : public base {
 public:
     table local_ranks;
-    std::int64_t global_rank;
+    std::int64_t global_rank = 0;
 };
 
 using detail::vertex_ranking_result_impl;
@@ -37,17 +37,47 @@ public:
     using task_t = Task;
     static_assert(detail::is_valid_graph<Graph>,
                   "Only undirected_adjacency_vector_graph is supported.");
+    static_assert(std::is_same_v<vertex_type<Graph>, std::int32_t>,
+                  "Only int32_t vertex indices are supported.");
     /// Constructs the algorithm input initialized with the graph
     ///
     /// @param [in]   g  The input graph
     vertex_ranking_input(const Graph& g);
 
+    /// Constructs the algorithm input for the method::incremental
+    ///
+    /// @param [in]   g               The input graph that already contains the inserted edges
+    /// @param [in]   inserted_edges  The table of the inserted edges with two vertex indices
+    ///                               per row
+    /// @param [in]   previous_result The result computed for the graph before the insertion
+    vertex_ranking_input(const Graph& g,
+                         const table& inserted_edges,
+                         const vertex_ranking_result<Task>& previous_result);
+
     /// Returns the constant reference to the input graph
     const Graph& get_graph() const;
 
     /// Sets the input graph
     auto& set_graph(const Graph& g);
 
+    /// Returns the table of the edges inserted into the graph since the previous result
+    const table& get_inserted_edges() const;
+
+    /// Sets the table of the edges inserted into the graph since the previous result
+    auto& set_inserted_edges(const table& value) {
+        impl_->inserted_edges = value;
+        return *this;
+    }
+
+    /// Returns the result computed for the graph before the insertion of the edges
+    const vertex_ranking_result<Task>& get_previous_result() const;
+
+    /// Sets the result computed for the graph before the insertion of the edges
+    auto& set_previous_result(const vertex_ranking_result<Task>& value) {
+        impl_->previous_result = value;
+        return *this;
+    }
+
 private:
     dal::detail::pimpl<detail::vertex_ranking_input_impl<Graph, Task>> impl_;
 };
@@ -101,9 +131,29 @@ template <typename Graph, typename Task>
 vertex_ranking_input<Graph, Task>::vertex_ranking_input(const Graph& data)
         : impl_(new detail::vertex_ranking_input_impl<Graph, Task>(data)) {}
 
+template <typename Graph, typename Task>
+vertex_ranking_input<Graph, Task>::vertex_ranking_input(
+    const Graph& data,
+    const table& inserted_edges,
+    const vertex_ranking_result<Task>& previous_result)
+        : impl_(new detail::vertex_ranking_input_impl<Graph, Task>(data,
+                                                                  inserted_edges,
+                                                                  previous_result)) {}
+
 template <typename Graph, typename Task>
 const Graph& vertex_ranking_input<Graph, Task>::get_graph() const {
     return impl_->graph_data;
 }
 
+template <typename Graph, typename Task>
+const table& vertex_ranking_input<Graph, Task>::get_inserted_edges() const {
+    return impl_->inserted_edges;
+}
+
+template <typename Graph, typename Task>
+const vertex_ranking_result<Task>& vertex_ranking_input<Graph, Task>::get_previous_result()
+    const {
+    return impl_->previous_result;
+}
+
 } // namespace oneapi::dal::preview::triangle_counting
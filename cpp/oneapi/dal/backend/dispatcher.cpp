@@ -16,6 +16,8 @@
 
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include <daal/src/services/service_defines.h>
+#include <daal/src/threading/threading.h>
+#include <daal/src/externals/service_memory.h>
 
 namespace oneapi::dal::backend {
 
@@ -34,6 +36,46 @@ void context_cpu::global_init() {
     [[maybe_unused]] static volatile global_context_cpu_init init;
 }
 
+task_arena_scope::task_arena_scope(const detail::host_policy& ctx) {
+    enter(ctx.get_max_concurrency(), ctx.get_numa_node());
+}
+
+task_arena_scope::task_arena_scope(const context_cpu& ctx) {
+    enter(ctx.get_max_concurrency(), ctx.get_numa_node());
+}
+
+void task_arena_scope::enter(std::int64_t max_concurrency, std::int64_t numa_node) {
+    using msg = detail::error_messages;
+    if (max_concurrency > 0 || numa_node >= 0) {
+        void* arena =
+            _daal_get_task_arena(static_cast<int>(max_concurrency), static_cast<int>(numa_node));
+        if (!arena && numa_node >= 0) {
+            throw invalid_argument{ msg::numa_node_is_not_available() };
+        }
+        previous_arena_ = _daal_set_thread_task_arena(arena);
+        is_set_ = true;
+    }
+}
+
+task_arena_scope::~task_arena_scope() {
+    if (is_set_) {
+        _daal_set_thread_task_arena(previous_arena_);
+    }
+}
+
+scratch_arena_scope::scratch_arena_scope(const detail::host_policy& ctx) {
+    using daal::services::internal::ScratchComputeScope;
+    if (ctx.get_scratch_arena_enabled()) {
+        daal::services::internal::enableDefaultScratchArena();
+        scope_ = new ScratchComputeScope();
+    }
+}
+
+scratch_arena_scope::~scratch_arena_scope() {
+    using daal::services::internal::ScratchComputeScope;
+    delete static_cast<ScratchComputeScope*>(scope_);
+}
+
 inline constexpr detail::cpu_extension from_daal_cpu_type(daal::CpuType cpu) {
     using detail::cpu_extension;
     switch (cpu) {
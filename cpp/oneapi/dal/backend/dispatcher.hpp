@@ -47,7 +47,9 @@ struct kernel_dispatcher {};
 class context_cpu {
 public:
     explicit context_cpu(const detail::host_policy& ctx = detail::host_policy::get_default())
-            : cpu_extensions_(ctx.get_enabled_cpu_extensions()) {
+            : cpu_extensions_(ctx.get_enabled_cpu_extensions()),
+              max_concurrency_(ctx.get_max_concurrency()),
+              numa_node_(ctx.get_numa_node()) {
         global_init();
     }
 
@@ -55,15 +57,60 @@ public:
         return cpu_extensions_;
     }
 
+    std::int64_t get_max_concurrency() const {
+        return max_concurrency_;
+    }
+
+    std::int64_t get_numa_node() const {
+        return numa_node_;
+    }
+
 private:
     void global_init();
     detail::cpu_extension cpu_extensions_;
+    std::int64_t max_concurrency_;
+    std::int64_t numa_node_;
+};
+
+/// Runs the threading primitives called by the current thread in the task arena
+/// configured by the policy while the object is alive. The arenas are cached by the
+/// calling thread, so the repeated computations with the same policy reuse them
+class task_arena_scope {
+public:
+    explicit task_arena_scope(const detail::host_policy& ctx);
+    explicit task_arena_scope(const context_cpu& ctx);
+    ~task_arena_scope();
+
+    task_arena_scope(const task_arena_scope&) = delete;
+    task_arena_scope& operator=(const task_arena_scope&) = delete;
+
+private:
+    void enter(std::int64_t max_concurrency, std::int64_t numa_node);
+
+    bool is_set_ = false;
+    void* previous_arena_ = nullptr;
+};
+
+/// Places the temporary buffers of the computations in the scratch arena
+/// if the policy enables it, the arena is reset when the outermost scope is left
+class scratch_arena_scope {
+public:
+    explicit scratch_arena_scope(const detail::host_policy& ctx);
+    ~scratch_arena_scope();
+
+    scratch_arena_scope(const scratch_arena_scope&) = delete;
+    scratch_arena_scope& operator=(const scratch_arena_scope&) = delete;
+
+private:
+    void* scope_ = nullptr;
 };
 
 template <typename CpuKernel>
 struct kernel_dispatcher<CpuKernel> {
     template <typename... Args>
     auto operator()(const detail::host_policy& ctx, Args&&... args) const {
+        const task_arena_scope arena_scope{ ctx };
+        const scratch_arena_scope scratch_scope{ ctx };
         return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
     }
 };
@@ -72,10 +119,13 @@ inline bool test_cpu_extension(detail::cpu_extension mask, detail::cpu_extension
     return mask >= test;
 }
 
+/// Calls the operation with the tag of the best CPU extension enabled in the context.
+/// The operation runs in the task arena configured by the policy of the context
 template <typename Op>
-inline constexpr auto dispatch_by_cpu(const context_cpu& ctx, Op&& op) {
+inline auto dispatch_by_cpu(const context_cpu& ctx, Op&& op) {
     using detail::cpu_extension;
 
+    const task_arena_scope arena_scope{ ctx };
     const cpu_extension cpu_ex = ctx.get_enabled_cpu_extensions();
     ONEDAL_IF_CPU_DISPATCH_AVX512(if (test_cpu_extension(cpu_ex, cpu_extension::avx512)) {
         return op(cpu_dispatch_avx512{});
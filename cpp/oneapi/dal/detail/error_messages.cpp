@@ -49,6 +49,10 @@ MSG(unsupported_usm_alloc, "Requested USM alloc type is not supported")
 MSG(page_size_leq_zero, "Page size is lower than or equal to zero")
 MSG(invalid_key, "Cannot find the given key")
 MSG(capacity_leq_zero, "Capacity is lower than or equal to zero")
+MSG(max_concurrency_lt_zero, "Maximal concurrency is lower than zero")
+MSG(numa_node_lt_minus_one, "NUMA node index is lower than -1")
+MSG(numa_node_is_not_available,
+    "NUMA node is not available, threads cannot be bound to it without the TBBBind library")
 
 /* Primitives */
 MSG(invalid_number_of_elements_to_process, "Invalid number of elements to process")
@@ -103,6 +107,7 @@ MSG(vertex_index_out_of_range_expect_from_zero_to_vertex_count,
     "Vertex index is out of range, expect index in [0, vertex_count)")
 MSG(negative_vertex_id, "Negative vertex ID")
 MSG(unimplemented_sorting_procedure, "Unimplemented sorting procedure")
+MSG(unsorted_vertex_neighbors, "Neighbors of the vertex are not sorted in ascending order")
 
 /* IO */
 MSG(file_not_found, "File not found")
@@ -175,6 +180,9 @@ MSG(interval_gt_vertex_count, "Interval is greater than vertex count")
 MSG(negative_interval, "Negative interval")
 MSG(row_begin_gt_row_end, "Row begin is greater than row end")
 MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
+MSG(threshold_gt_one, "Threshold is greater than one")
+MSG(threshold_lt_zero, "Threshold is lower than zero")
+MSG(top_k_lt_zero, "Top-k is lower than zero")
 
 /* Subgraph Isomorphism */
 MSG(max_match_count_lt_zero, "Maximum number of match count less that zero")
@@ -202,6 +210,7 @@ MSG(pca_svd_based_method_is_not_implemented_for_gpu,
 /* Shortest Paths */
 MSG(negative_source, "Source vertex is lower than zero")
 MSG(source_gte_vertex_count, "Source vertex is out of range")
+MSG(empty_source_list, "List of source vertices is empty")
 MSG(negative_delta, "Delta parameter is lower than zero")
 MSG(nothing_to_compute, "Invalid combination of optional results: nothing to compute")
 MSG(distances_are_uninitialized, "Distances are not set as an optional result")
@@ -240,6 +249,14 @@ MSG(tau_leq_zero, "Tau is lower than or equal to zero")
 MSG(epsilon_lt_zero, "Epsilon is lower than zero")
 MSG(unknown_kernel_function_type, "Unknown kernel function type")
 
+/* Triangle Counting */
+MSG(inserted_edge_is_not_in_graph, "Inserted edge is not present in the input graph")
+MSG(inserted_edge_is_self_loop, "Inserted edge connects the vertex with itself")
+MSG(input_inserted_edges_table_has_wrong_cc_expect_two,
+    "Input inserted edges table has wrong column count, expected two")
+MSG(input_previous_ranks_rc_gt_vertex_count,
+    "Input previous ranks row count is greater than vertex count")
+
 /* Kernel Functions */
 MSG(input_x_cc_neq_y_cc, "Input x column count is not qual to y column count")
 MSG(input_x_is_empty, "Input x is empty")
@@ -260,6 +277,8 @@ MSG(input_model_is_not_initialized, "Input model is not initialized")
 MSG(invalid_number_of_trees, "Invalid number of trees in model")
 MSG(invalid_number_of_classes, "Invalid number of classes")
 MSG(input_model_tree_has_invalid_size, "Input model tree size is invalid")
+MSG(mapped_model_is_not_supported_on_gpu,
+    "Decision forest model mapped from the file is not supported on GPU")
 
 } // namespace v1
 } // namespace oneapi::dal::detail
@@ -83,6 +83,9 @@ public:
     MSG(page_size_leq_zero);
     MSG(invalid_key);
     MSG(capacity_leq_zero);
+    MSG(max_concurrency_lt_zero);
+    MSG(numa_node_lt_minus_one);
+    MSG(numa_node_is_not_available);
 
     /* Primitives */
     MSG(invalid_number_of_elements_to_process);
@@ -127,6 +130,7 @@ public:
     MSG(vertex_index_out_of_range_expect_from_zero_to_vertex_count);
     MSG(negative_vertex_id);
     MSG(unimplemented_sorting_procedure);
+    MSG(unsorted_vertex_neighbors);
 
     /* I/O */
     MSG(file_not_found);
@@ -159,6 +163,7 @@ public:
     MSG(invalid_number_of_classes);
     MSG(input_model_is_not_initialized);
     MSG(input_model_tree_has_invalid_size);
+    MSG(mapped_model_is_not_supported_on_gpu);
 
     /* Jaccard */
     MSG(column_begin_gt_column_end);
@@ -167,6 +172,9 @@ public:
     MSG(negative_interval);
     MSG(row_begin_gt_row_end);
     MSG(range_idx_gt_max_int32);
+    MSG(threshold_gt_one);
+    MSG(threshold_lt_zero);
+    MSG(top_k_lt_zero);
 
     /* Subgraph Isomorphism */
     MSG(unsupported_kind);
@@ -220,6 +228,7 @@ public:
     /* Shortest Paths */
     MSG(negative_source);
     MSG(source_gte_vertex_count);
+    MSG(empty_source_list);
     MSG(negative_delta);
     MSG(nothing_to_compute);
     MSG(distances_are_uninitialized);
@@ -250,6 +259,12 @@ public:
     MSG(tau_leq_zero);
     MSG(epsilon_lt_zero);
     MSG(unknown_kernel_function_type);
+
+    /* Triangle Counting */
+    MSG(inserted_edge_is_not_in_graph);
+    MSG(inserted_edge_is_self_loop);
+    MSG(input_inserted_edges_table_has_wrong_cc_expect_two);
+    MSG(input_previous_ranks_rc_gt_vertex_count);
 };
 
 #undef MSG
@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
 namespace oneapi::dal::detail {
@@ -23,6 +25,9 @@ namespace v1 {
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::int64_t max_concurrency = 0;
+    std::int64_t numa_node = -1;
+    bool scratch_arena_enabled = false;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -35,6 +40,38 @@ cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+void host_policy::set_max_concurrency_impl(std::int64_t value) {
+    using msg = detail::error_messages;
+    if (value < 0) {
+        throw invalid_argument{ msg::max_concurrency_lt_zero() };
+    }
+    impl_->max_concurrency = value;
+}
+
+std::int64_t host_policy::get_max_concurrency() const noexcept {
+    return impl_->max_concurrency;
+}
+
+void host_policy::set_numa_node_impl(std::int64_t value) {
+    using msg = detail::error_messages;
+    if (value < -1) {
+        throw invalid_argument{ msg::numa_node_lt_minus_one() };
+    }
+    impl_->numa_node = value;
+}
+
+std::int64_t host_policy::get_numa_node() const noexcept {
+    return impl_->numa_node;
+}
+
+void host_policy::set_scratch_arena_enabled_impl(bool value) noexcept {
+    impl_->scratch_arena_enabled = value;
+}
+
+bool host_policy::get_scratch_arena_enabled() const noexcept {
+    return impl_->scratch_arena_enabled;
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
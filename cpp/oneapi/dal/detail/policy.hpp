@@ -57,8 +57,39 @@ public:
         return *this;
     }
 
+    /// The maximal number of threads the algorithms run with this policy use.
+    /// The computations run in a dedicated task arena, 0 means the default number of threads
+    std::int64_t get_max_concurrency() const noexcept;
+
+    auto& set_max_concurrency(std::int64_t value) {
+        set_max_concurrency_impl(value);
+        return *this;
+    }
+
+    /// The index of the NUMA node the threads of the task arena are bound to,
+    /// -1 means that the threads are not bound
+    std::int64_t get_numa_node() const noexcept;
+
+    auto& set_numa_node(std::int64_t value) {
+        set_numa_node_impl(value);
+        return *this;
+    }
+
+    /// If true, the temporary buffers of the algorithms run with this policy are
+    /// placed in the scratch arena shared by the process. The arena stays in use
+    /// for the subsequent computations and its memory is reused across them
+    bool get_scratch_arena_enabled() const noexcept;
+
+    auto& set_scratch_arena_enabled(bool value) {
+        set_scratch_arena_enabled_impl(value);
+        return *this;
+    }
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_max_concurrency_impl(std::int64_t value);
+    void set_numa_node_impl(std::int64_t value);
+    void set_scratch_arena_enabled_impl(bool value) noexcept;
 
     pimpl<host_policy_impl> impl_;
 };
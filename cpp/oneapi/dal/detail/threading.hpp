@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <utility>
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
@@ -283,6 +284,14 @@ inline void atomic_decrement(std::int64_t &value, std::int64_t delta = 1) {
 #endif
 }
 
+inline std::int64_t atomic_fetch_add(std::int64_t &value, std::int64_t delta = 1) {
+#if defined(_WIN32) || defined(_WIN64)
+    return _InterlockedExchangeAdd64(&value, delta);
+#else
+    return __atomic_fetch_add(&value, delta, __ATOMIC_SEQ_CST);
+#endif
+}
+
 inline std::int64_t atomic_load(std::int64_t &value) {
 #if defined(_WIN32) || defined(_WIN64)
     const std::int64_t result = value;
@@ -295,6 +304,72 @@ inline std::int64_t atomic_load(std::int64_t &value) {
 #endif
 }
 
+/// Replaces the value with the desired one if it is equal to the expected one.
+/// Otherwise, the current value is written to the expected one.
+/// Returns true if the value has been replaced.
+template <typename T>
+inline bool atomic_compare_exchange(T &value, T &expected, const T &desired) {
+    static_assert(sizeof(T) == sizeof(std::int32_t) || sizeof(T) == sizeof(std::int64_t),
+                  "Only 32-bit and 64-bit types are supported");
+#if defined(_WIN32) || defined(_WIN64)
+    if constexpr (sizeof(T) == sizeof(long)) {
+        long expected_bits, desired_bits;
+        std::memcpy(&expected_bits, &expected, sizeof(T));
+        std::memcpy(&desired_bits, &desired, sizeof(T));
+        const long observed_bits =
+            _InterlockedCompareExchange(reinterpret_cast<volatile long *>(&value),
+                                        desired_bits,
+                                        expected_bits);
+        if (observed_bits == expected_bits) {
+            return true;
+        }
+        std::memcpy(&expected, &observed_bits, sizeof(T));
+        return false;
+    }
+    else {
+        __int64 expected_bits, desired_bits;
+        std::memcpy(&expected_bits, &expected, sizeof(T));
+        std::memcpy(&desired_bits, &desired, sizeof(T));
+        const __int64 observed_bits =
+            _InterlockedCompareExchange64(reinterpret_cast<volatile __int64 *>(&value),
+                                          desired_bits,
+                                          expected_bits);
+        if (observed_bits == expected_bits) {
+            return true;
+        }
+        std::memcpy(&expected, &observed_bits, sizeof(T));
+        return false;
+    }
+#else
+    T desired_copy = desired;
+    return __atomic_compare_exchange(&value,
+                                     &expected,
+                                     &desired_copy,
+                                     false,
+                                     __ATOMIC_SEQ_CST,
+                                     __ATOMIC_SEQ_CST);
+#endif
+}
+
+/// Atomically replaces the value with the new one if the new one is less.
+/// Returns true if the value has been replaced.
+template <typename T>
+inline bool atomic_min(T &value, const T &new_value) {
+#if defined(_WIN32) || defined(_WIN64)
+    T old_value = value;
+    _ReadWriteBarrier();
+#else
+    T old_value;
+    __atomic_load(&value, &old_value, __ATOMIC_RELAXED);
+#endif
+    while (new_value < old_value) {
+        if (atomic_compare_exchange(value, old_value, new_value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <typename lambdaType>
 inline void *tls_func(const void *a) {
     const lambdaType &lambda = *static_cast<const lambdaType *>(a);
@@ -27,7 +27,7 @@
 namespace oneapi::dal::preview::detail {
 
 template <typename IndexType>
-constexpr bool is_valid_index_v = dal::detail::is_one_of_v<IndexType, std::int32_t>;
+constexpr bool is_valid_index_v = dal::detail::is_one_of_v<IndexType, std::int32_t, std::int64_t>;
 
 template <typename EdgeValue>
 constexpr bool is_valid_edge_value_v =
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+template <typename IndexType>
+compressed_topology<IndexType>::compressed_topology(const topology<IndexType>& t)
+        : _vertex_count(t.get_vertex_count()),
+          _edge_count(t.get_edge_count()) {
+    compress(t._rows_ptr, t._cols_ptr);
+}
+
+template <typename IndexType>
+compressed_topology<IndexType>::compressed_topology(const std::pair<IndexType, IndexType>* edges,
+                                                    std::int64_t edge_count) {
+    if (edge_count <= 0) {
+        throw invalid_argument(dal::detail::error_messages::empty_edge_list());
+    }
+    IndexType max_id = 0;
+    for (std::int64_t i = 0; i < edge_count; i++) {
+        if (edges[i].first < 0 || edges[i].second < 0) {
+            throw invalid_argument(dal::detail::error_messages::negative_vertex_id());
+        }
+        max_id = std::max(max_id, std::max(edges[i].first, edges[i].second));
+    }
+    const std::int64_t vertex_count = static_cast<std::int64_t>(max_id) + 1;
+
+    // both directions of every edge are kept in the neighbor lists of the undirected graph
+    auto rows_array = array<std::int64_t>::zeros(vertex_count + 1);
+    auto cols_array = array<IndexType>::empty(2 * edge_count);
+    std::int64_t* rows = rows_array.get_mutable_data();
+    IndexType* cols = cols_array.get_mutable_data();
+    for (std::int64_t i = 0; i < edge_count; i++) {
+        rows[edges[i].first + 1]++;
+        rows[edges[i].second + 1]++;
+    }
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        rows[v + 1] += rows[v];
+    }
+    for (std::int64_t i = 0; i < edge_count; i++) {
+        cols[rows[edges[i].first]++] = edges[i].second;
+        cols[rows[edges[i].second]++] = edges[i].first;
+    }
+    for (std::int64_t v = vertex_count; v > 0; v--) {
+        rows[v] = rows[v - 1];
+    }
+    rows[0] = 0;
+
+    // the neighbors are sorted, the self-loops and the multiple edges are removed in place,
+    // so the list of the vertex v starts at rows[v] and takes degrees[v] elements
+    auto degrees_array = array<std::int64_t>::empty(vertex_count);
+    std::int64_t* degrees = degrees_array.get_mutable_data();
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+        IndexType* begin = cols + rows[v];
+        IndexType* end = cols + rows[v + 1];
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+        end = std::remove(begin, end, static_cast<IndexType>(v));
+        degrees[v] = end - begin;
+    });
+
+    std::int64_t filtered_count = 0;
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        const std::int64_t begin = rows[v];
+        if (filtered_count != begin) {
+            std::copy(cols + begin, cols + begin + degrees[v], cols + filtered_count);
+        }
+        rows[v] = filtered_count;
+        filtered_count += degrees[v];
+    }
+    rows[vertex_count] = filtered_count;
+
+    _vertex_count = vertex_count;
+    _edge_count = filtered_count / 2;
+    compress(rows, cols);
+}
+
+template <typename IndexType>
+void compressed_topology<IndexType>::compress(const std::int64_t* rows, const IndexType* cols) {
+    const std::int64_t vertex_count = _vertex_count;
+
+    // the encoded size of the neighbors of the vertex v is computed at offsets[v + 1],
+    // it is negative if the neighbors are not sorted
+    _offsets = array<std::int64_t>::empty(vertex_count + 1);
+    _degrees = array<vertex_type>::empty(std::max(vertex_count, std::int64_t(1)));
+    std::int64_t* offsets = _offsets.get_mutable_data();
+    vertex_type* degrees = _degrees.get_mutable_data();
+    offsets[0] = 0;
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+        std::int64_t size = 0;
+        std::uint64_t prev = 0;
+        for (std::int64_t e = rows[v]; e < rows[v + 1]; e++) {
+            const auto neighbor = static_cast<std::uint64_t>(cols[e]);
+            if (cols[e] < 0 || neighbor < prev) {
+                size = -1;
+                break;
+            }
+            size += get_varint_size(neighbor - prev);
+            prev = neighbor;
+        }
+        offsets[v + 1] = size;
+        degrees[v] = static_cast<vertex_type>(rows[v + 1] - rows[v]);
+    });
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        if (offsets[v + 1] < 0) {
+            throw invalid_argument(dal::detail::error_messages::unsorted_vertex_neighbors());
+        }
+        offsets[v + 1] += offsets[v];
+    }
+    _compressed_size = offsets[vertex_count];
+
+    _data = array<byte_type>::empty(std::max(_compressed_size, std::int64_t(1)));
+    byte_type* data = _data.get_mutable_data();
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t v) {
+        byte_type* out = data + offsets[v];
+        std::uint64_t prev = 0;
+        for (std::int64_t e = rows[v]; e < rows[v + 1]; e++) {
+            const auto neighbor = static_cast<std::uint64_t>(cols[e]);
+            out = encode_varint(neighbor - prev, out);
+            prev = neighbor;
+        }
+    });
+
+    _offsets_ptr = _offsets.get_data();
+    _degrees_ptr = _degrees.get_data();
+    _data_ptr = _data.get_data();
+}
+
+template class ONEDAL_EXPORT compressed_topology<std::int32_t>;
+template class ONEDAL_EXPORT compressed_topology<std::int64_t>;
+
+} // namespace oneapi::dal::preview::detail
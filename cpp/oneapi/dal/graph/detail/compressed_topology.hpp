@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstring>
+#include <utility>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/graph/detail/csr_topology.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+using byte_type = std::uint8_t;
+
+/// Returns the number of bytes of the value written as the variable length integer
+inline std::int64_t get_varint_size(std::uint64_t value) {
+    std::int64_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+/// Writes the value by 7 bits per byte starting from the lowest ones,
+/// the high bit of the byte is set if the value continues in the next byte
+inline byte_type* encode_varint(std::uint64_t value, byte_type* out) {
+    while (value >= 0x80) {
+        *out++ = static_cast<byte_type>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<byte_type>(value);
+    return out;
+}
+
+inline const byte_type* decode_varint(const byte_type* in, std::uint64_t& value) {
+    value = *in & 0x7F;
+    for (std::int64_t shift = 7; *in++ & 0x80; shift += 7) {
+        value |= static_cast<std::uint64_t>(*in & 0x7F) << shift;
+    }
+    return in;
+}
+
+/// Read-only CSR topology with the compressed neighbor lists.
+/// The sorted neighbors of every vertex are stored as the gaps between the consecutive
+/// neighbors (the first one is taken from zero) written as the variable length integers,
+/// so the small gaps of the dense regions of the graph take a byte per edge.
+/// The neighbors are decoded on the fly.
+template <typename IndexType>
+class compressed_topology {
+public:
+    using vertex_type = IndexType;
+    using vertex_size_type = std::int64_t;
+    using edge_size_type = std::int64_t;
+    using vertex_edge_size_type = vertex_type;
+
+    compressed_topology() = default;
+
+    /// Compresses the neighbor lists of the topology, the neighbors of every vertex
+    /// must be sorted in ascending order
+    explicit compressed_topology(const topology<IndexType>& t);
+
+    /// Builds the compressed neighbor lists of the undirected graph with the edges
+    /// from the list. The self-loops and the multiple edges are removed like in
+    /// the graph loaded from the edge list
+    compressed_topology(const std::pair<IndexType, IndexType>* edges, std::int64_t edge_count);
+
+    ONEDAL_FORCEINLINE std::int64_t get_vertex_count() const {
+        return _vertex_count;
+    }
+
+    ONEDAL_FORCEINLINE std::int64_t get_edge_count() const {
+        return _edge_count;
+    }
+
+    /// Returns the number of bytes taken by the encoded neighbor lists
+    ONEDAL_FORCEINLINE std::int64_t get_compressed_size() const {
+        return _compressed_size;
+    }
+
+    ONEDAL_FORCEINLINE auto get_vertex_degree(const IndexType& vertex) const noexcept
+        -> vertex_edge_size_type {
+        return _degrees_ptr[vertex];
+    }
+
+    /// Decodes the neighbors of the vertex into the buffer of get_vertex_degree(vertex)
+    /// elements, returns the end of the decoded neighbors
+    vertex_type* decode_vertex_neighbors(const IndexType& vertex, vertex_type* out) const {
+        const byte_type* in = _data_ptr + _offsets_ptr[vertex];
+        const byte_type* end = _data_ptr + _offsets_ptr[vertex + 1];
+        std::uint64_t neighbor = 0;
+        constexpr std::int64_t word_size = sizeof(std::uint64_t);
+        constexpr std::uint64_t continuation_bits = 0x8080808080808080;
+        while (in < end) {
+            std::uint64_t word = continuation_bits;
+            if (end - in >= word_size) {
+                std::memcpy(&word, in, word_size);
+            }
+            if ((word & continuation_bits) == 0) {
+                // the next gaps take a byte each, decode the whole word at once
+                for (std::int64_t i = 0; i < word_size; i++) {
+                    neighbor += in[i];
+                    out[i] = static_cast<vertex_type>(neighbor);
+                }
+                in += word_size;
+                out += word_size;
+            }
+            else {
+                std::uint64_t gap;
+                in = decode_varint(in, gap);
+                neighbor += gap;
+                *out++ = static_cast<vertex_type>(neighbor);
+            }
+        }
+        return out;
+    }
+
+    /// Calls the operation for every neighbor of the vertex in ascending order
+    template <typename Operation>
+    void for_each_vertex_neighbor(const IndexType& vertex, Operation&& op) const {
+        const byte_type* in = _data_ptr + _offsets_ptr[vertex];
+        const byte_type* end = _data_ptr + _offsets_ptr[vertex + 1];
+        std::uint64_t neighbor = 0;
+        while (in < end) {
+            std::uint64_t gap;
+            in = decode_varint(in, gap);
+            neighbor += gap;
+            op(static_cast<vertex_type>(neighbor));
+        }
+    }
+
+private:
+    void compress(const std::int64_t* rows, const IndexType* cols);
+
+    array<std::int64_t> _offsets;
+    array<vertex_type> _degrees;
+    array<byte_type> _data;
+
+    const std::int64_t* _offsets_ptr = nullptr;
+    const vertex_type* _degrees_ptr = nullptr;
+    const byte_type* _data_ptr = nullptr;
+
+    std::int64_t _vertex_count = 0;
+    std::int64_t _edge_count = 0;
+    std::int64_t _compressed_size = 0;
+};
+
+} // namespace oneapi::dal::preview::detail
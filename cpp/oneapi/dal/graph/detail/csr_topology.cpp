@@ -19,5 +19,6 @@
 namespace oneapi::dal::preview::detail {
 
 template class ONEDAL_EXPORT topology<int32_t>;
+template class ONEDAL_EXPORT topology<int64_t>;
 
 } // namespace oneapi::dal::preview::detail
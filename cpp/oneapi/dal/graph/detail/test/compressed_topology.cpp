@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <set>
+#include <vector>
+
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::detail::test {
+
+template <typename IndexType>
+class compressed_topology_test {
+public:
+    void build_graph(std::int64_t vertex_count, std::int64_t max_neighbor_step) {
+        rows_.assign(1, 0);
+        cols_.clear();
+        for (std::int64_t u = 0; u < vertex_count; u++) {
+            // the neighbors are u, u + step, u + 2 * step, ... with the growing steps,
+            // so the gaps take from one to several bytes
+            std::int64_t step = 1 + u % max_neighbor_step;
+            for (std::int64_t v = u % 7; v < vertex_count; v += step, step *= 2) {
+                cols_.push_back(static_cast<IndexType>(v));
+            }
+            rows_.push_back(cols_.size());
+        }
+        vertex_count_ = vertex_count;
+    }
+
+    void check_decoding() {
+        const std::int64_t edge_count = cols_.size();
+        const auto builder =
+            directed_adjacency_vector_graph_builder<empty_value,
+                                                    empty_value,
+                                                    empty_value,
+                                                    IndexType>(vertex_count_,
+                                                               edge_count,
+                                                               rows_.data(),
+                                                               cols_.data(),
+                                                               nullptr);
+        const auto& t = dal::detail::get_impl(builder.get_graph()).get_topology();
+        const compressed_topology<IndexType> ct(t);
+
+        REQUIRE(ct.get_vertex_count() == vertex_count_);
+        REQUIRE(ct.get_edge_count() == edge_count);
+        REQUIRE(ct.get_compressed_size() < edge_count * std::int64_t(sizeof(IndexType)));
+
+        std::vector<IndexType> neighbors;
+        for (std::int64_t u = 0; u < vertex_count_; u++) {
+            const std::vector<IndexType> expected(cols_.begin() + rows_[u],
+                                                  cols_.begin() + rows_[u + 1]);
+            REQUIRE(ct.get_vertex_degree(u) == static_cast<IndexType>(expected.size()));
+
+            neighbors.assign(expected.size(), -1);
+            const IndexType* end = ct.decode_vertex_neighbors(u, neighbors.data());
+            REQUIRE(end == neighbors.data() + neighbors.size());
+            REQUIRE(neighbors == expected);
+
+            neighbors.clear();
+            ct.for_each_vertex_neighbor(u, [&](IndexType v) {
+                neighbors.push_back(v);
+            });
+            REQUIRE(neighbors == expected);
+        }
+    }
+
+    void check_unsorted_neighbors() {
+        rows_ = { 0, 2, 2 };
+        cols_ = { 1, 0 };
+        vertex_count_ = 2;
+        const auto builder =
+            directed_adjacency_vector_graph_builder<empty_value,
+                                                    empty_value,
+                                                    empty_value,
+                                                    IndexType>(vertex_count_,
+                                                               cols_.size(),
+                                                               rows_.data(),
+                                                               cols_.data(),
+                                                               nullptr);
+        const auto& t = dal::detail::get_impl(builder.get_graph()).get_topology();
+        REQUIRE_THROWS_AS(compressed_topology<IndexType>(t), invalid_argument);
+    }
+
+    void check_building_from_edge_list() {
+        // the edges are listed in both directions, repeated and mixed with the self-loops
+        const std::int64_t vertex_count = 300;
+        std::vector<std::pair<IndexType, IndexType>> edges;
+        std::vector<std::set<IndexType>> expected(vertex_count);
+        for (std::int64_t u = 0; u < vertex_count; u++) {
+            for (std::int64_t v = (u * 7) % 13; v < vertex_count; v += 1 + u % 5) {
+                edges.emplace_back(static_cast<IndexType>(v), static_cast<IndexType>(u));
+                edges.emplace_back(static_cast<IndexType>(u), static_cast<IndexType>(v));
+                if (u != v) {
+                    expected[u].insert(static_cast<IndexType>(v));
+                    expected[v].insert(static_cast<IndexType>(u));
+                }
+            }
+        }
+        const compressed_topology<IndexType> ct(edges.data(), edges.size());
+
+        std::int64_t degree_sum = 0;
+        for (std::int64_t u = 0; u < vertex_count; u++) {
+            degree_sum += expected[u].size();
+        }
+        REQUIRE(ct.get_vertex_count() == vertex_count);
+        REQUIRE(ct.get_edge_count() == degree_sum / 2);
+
+        std::vector<IndexType> neighbors;
+        for (std::int64_t u = 0; u < vertex_count; u++) {
+            const std::vector<IndexType> expected_neighbors(expected[u].begin(), expected[u].end());
+            REQUIRE(ct.get_vertex_degree(u) == static_cast<IndexType>(expected_neighbors.size()));
+
+            neighbors.assign(expected_neighbors.size(), -1);
+            ct.decode_vertex_neighbors(u, neighbors.data());
+            REQUIRE(neighbors == expected_neighbors);
+        }
+    }
+
+private:
+    std::vector<std::int64_t> rows_;
+    std::vector<IndexType> cols_;
+    std::int64_t vertex_count_ = 0;
+};
+
+using index_types = std::tuple<std::int32_t, std::int64_t>;
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "compressed topology decodes the neighbors",
+                     "[graph][compressed_topology]",
+                     index_types) {
+    this->build_graph(1000, 3);
+    this->check_decoding();
+}
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "compressed topology decodes the long gaps",
+                     "[graph][compressed_topology]",
+                     index_types) {
+    this->build_graph(20000, 500);
+    this->check_decoding();
+}
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "compressed topology throws on unsorted neighbors",
+                     "[graph][compressed_topology]",
+                     index_types) {
+    this->check_unsorted_neighbors();
+}
+
+TEMPLATE_LIST_TEST_M(compressed_topology_test,
+                     "compressed topology is built from the edge list",
+                     "[graph][compressed_topology]",
+                     index_types) {
+    this->check_building_from_edge_list();
+}
+
+} // namespace oneapi::dal::preview::detail::test
@@ -19,6 +19,7 @@
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/detail/compressed_topology.hpp"
 #include "oneapi/dal/graph/detail/container.hpp"
 #include "oneapi/dal/graph/detail/csr_topology.hpp"
 
@@ -127,6 +128,23 @@ public:
     template <typename... Args>
     inline void set_topology(Args&&... args) {
         _topology.set_topology(std::forward<Args>(args)...);
+        _compressed_topology = compressed_topology<IndexType>();
+    }
+
+    /// Builds the compressed copy of the topology, the algorithms that support
+    /// the compressed neighbor lists read it instead of the topology.
+    /// The neighbors of every vertex must be sorted in ascending order
+    inline void compress_topology() {
+        _compressed_topology = compressed_topology<IndexType>(_topology);
+    }
+
+    inline bool has_compressed_topology() const {
+        return _topology.get_vertex_count() > 0 &&
+               _compressed_topology.get_vertex_count() == _topology.get_vertex_count();
+    }
+
+    inline const compressed_topology<IndexType>& get_compressed_topology() const {
+        return _compressed_topology;
     }
 
     inline topology<IndexType>& get_topology() {
@@ -162,6 +180,7 @@ public:
 
 private:
     topology<IndexType> _topology;
+    compressed_topology<IndexType> _compressed_topology;
     vertex_values<VertexValue> _vertex_values;
     edge_values<EdgeValue> _edge_values;
 };
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdlib>
+
 #include "oneapi/dal/io/detail/load_graph_service.hpp"
 #include "src/externals/service_service.h"
 
@@ -23,6 +25,10 @@ ONEDAL_EXPORT std::int32_t daal_string_to_int(const char* nptr, char** endptr) {
     return daal::internal::Service<>::serv_string_to_int(nptr, endptr);
 }
 
+ONEDAL_EXPORT std::int64_t daal_string_to_int64(const char* nptr, char** endptr) {
+    return std::strtoll(nptr, endptr, 10);
+}
+
 ONEDAL_EXPORT double daal_string_to_double(const char* nptr, char** endptr) {
     return daal::internal::Service<>::serv_string_to_double(nptr, endptr);
 }
@@ -32,11 +32,8 @@
 
 namespace oneapi::dal::preview::load_graph::detail {
 
-template <typename EdgeList>
-inline void load_edge_list(const std::string &name, EdgeList &elist);
-
-template <>
-inline void load_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
+template <typename Vertex>
+inline void load_edge_list(const std::string &name, edge_list<Vertex> &elist) {
     std::ifstream file(name);
     if (!file.is_open()) {
         throw invalid_argument(dal::detail::error_messages::file_not_found());
@@ -45,8 +42,8 @@ inline void load_edge_list(const std::string &name, edge_list<std::int32_t> &eli
     elist.reserve(1024);
     char source_vertex[32], destination_vertex[32];
     while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
+        auto edge = std::make_pair(daal_string_to<Vertex>(&source_vertex[0], 0),
+                                   daal_string_to<Vertex>(&destination_vertex[0], 0));
         elist.push_back(edge);
     }
 
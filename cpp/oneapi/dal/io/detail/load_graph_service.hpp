@@ -22,6 +22,8 @@ namespace oneapi::dal::preview::load_graph::detail {
 
 ONEDAL_EXPORT std::int32_t daal_string_to_int(const char *nptr, char **endptr);
 
+ONEDAL_EXPORT std::int64_t daal_string_to_int64(const char *nptr, char **endptr);
+
 ONEDAL_EXPORT double daal_string_to_double(const char *nptr, char **endptr);
 
 template <typename T>
@@ -32,6 +34,11 @@ inline std::int32_t daal_string_to(const char *nptr, char **endptr) {
     return daal_string_to_int(nptr, endptr);
 }
 
+template <>
+inline std::int64_t daal_string_to(const char *nptr, char **endptr) {
+    return daal_string_to_int64(nptr, endptr);
+}
+
 template <>
 inline double daal_string_to(const char *nptr, char **endptr) {
     return daal_string_to_double(nptr, endptr);
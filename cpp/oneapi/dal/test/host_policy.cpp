@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::test {
+
+TEST("host_policy does not limit threads by default") {
+    const detail::host_policy policy;
+
+    REQUIRE(policy.get_max_concurrency() == 0);
+    REQUIRE(policy.get_numa_node() == -1);
+    REQUIRE(policy.get_scratch_arena_enabled() == false);
+}
+
+TEST("host_policy keeps task arena constraints") {
+    detail::host_policy policy;
+    policy.set_max_concurrency(2).set_numa_node(0);
+
+    REQUIRE(policy.get_max_concurrency() == 2);
+    REQUIRE(policy.get_numa_node() == 0);
+}
+
+TEST("host_policy keeps scratch arena flag") {
+    detail::host_policy policy;
+    policy.set_scratch_arena_enabled(true);
+
+    REQUIRE(policy.get_scratch_arena_enabled() == true);
+}
+
+TEST("host_policy throws if invalid task arena constraints are given") {
+    detail::host_policy policy;
+
+    REQUIRE_THROWS_AS(policy.set_max_concurrency(-1), invalid_argument);
+    REQUIRE_THROWS_AS(policy.set_numa_node(-2), invalid_argument);
+}
+
+TEST("task_arena_scope limits the number of threads") {
+    const std::int64_t max_concurrency = 1;
+    detail::host_policy policy;
+    policy.set_max_concurrency(max_concurrency);
+
+    {
+        const backend::task_arena_scope scope{ policy };
+        REQUIRE(detail::threader_get_max_threads() == max_concurrency);
+
+        std::int32_t max_threads_inside = 0;
+        detail::threader_for(1, 1, [&](std::int32_t) {
+            max_threads_inside = detail::threader_get_max_threads();
+        });
+        REQUIRE(max_threads_inside == max_concurrency);
+    }
+}
+
+TEST("dispatch_by_cpu runs the operation in the task arena of the policy") {
+    const std::int64_t max_concurrency = 1;
+    detail::host_policy policy;
+    policy.set_max_concurrency(max_concurrency);
+
+    const backend::context_cpu ctx{ policy };
+    const std::int32_t max_threads = backend::dispatch_by_cpu(ctx, [&](auto) {
+        std::int32_t max_threads_inside = 0;
+        detail::threader_for(1, 1, [&](std::int32_t) {
+            max_threads_inside = detail::threader_get_max_threads();
+        });
+        return max_threads_inside;
+    });
+    REQUIRE(max_threads == max_concurrency);
+}
+
+TEST("task_arena_scope throws if NUMA node is not available") {
+    detail::host_policy policy;
+    policy.set_numa_node(1 << 20);
+
+    REQUIRE_THROWS_AS(backend::task_arena_scope{ policy }, invalid_argument);
+}
+
+} // namespace oneapi::dal::test
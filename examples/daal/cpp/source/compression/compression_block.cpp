@@ -0,0 +1,141 @@
+/* file: compression_block.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the compression of the data split into blocks that are
+!    compressed and decompressed in parallel
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COMPRESSION_BLOCK"></a>
+ * \example compression_block.cpp
+ */
+
+#include <cstring>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+string datasetFileName = "../data/batch/logitboost_train.csv";
+
+const size_t blockSize = 64 * 1024; /* Size of the raw data blocks compressed independently */
+const size_t nFrames   = 3;         /* Number of frames the data is compressed to */
+
+bool hasError(const services::SharedPtr<services::ErrorCollection> & errors, services::ErrorID id);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Read data from a file */
+    byte * sentData       = NULL;
+    const size_t sentSize = readTextFile(datasetFileName, &sentData);
+
+    /* Create a compressor and a parameter of the block compression */
+    Compressor<zlib> compressor;
+    compressor.parameter.level = level9;
+    BlockCompressionParameter parameter(blockSize);
+
+    /* Compress the data into several frames: the current frame is closed when the compressed data is read from the archive */
+    CompressedDataArchive compressedArchive(&compressor, parameter);
+    vector<byte> compressedData;
+    const size_t frameSize = (sentSize + nFrames - 1) / nFrames;
+    for (size_t offset = 0; offset < sentSize; offset += frameSize)
+    {
+        compressedArchive.write(sentData + offset, (sentSize - offset < frameSize ? sentSize - offset : frameSize));
+
+        const size_t compressedFrameSize = compressedArchive.getSizeOfArchive();
+        compressedData.resize(compressedData.size() + compressedFrameSize);
+        compressedArchive.copyArchiveToArray(&compressedData[compressedData.size() - compressedFrameSize], compressedFrameSize);
+    }
+    if (compressedArchive.getErrors()->size() != 0) return 1;
+
+    /* Decompress all the frames in parallel */
+    Decompressor<zlib> decompressor;
+    DecompressedDataArchive decompressedArchive(&decompressor, parameter);
+    decompressedArchive.write(&compressedData[0], compressedData.size());
+
+    const size_t receivedSize = decompressedArchive.getSizeOfArchive();
+    vector<byte> receivedData(receivedSize);
+    decompressedArchive.copyArchiveToArray(&receivedData[0], receivedSize);
+    if (decompressedArchive.getErrors()->size() != 0) return 1;
+
+    const bool isEqual = (receivedSize == sentSize && memcmp(&receivedData[0], sentData, sentSize) == 0);
+    std::cout << "Compressed " << sentSize << " bytes to " << compressedData.size() << " bytes in " << nFrames << " frames" << std::endl;
+    std::cout << "Decompressed data " << (isEqual ? "matches" : "does not match") << " the original data" << std::endl;
+
+    /* Decompress a single block without decompressing the others */
+    Decompressor<zlib> blockDecompressor;
+    BlockDecompressionStream blockStream(&blockDecompressor);
+    DataBlock compressedBlock(&compressedData[0], compressedData.size());
+    blockStream.push_back(&compressedBlock);
+
+    const size_t nBlocks = blockStream.getNumberOfBlocks();
+    const size_t iBlock  = nBlocks / 2;
+    size_t blockOffset   = 0;
+    for (size_t i = 0; i < iBlock; i++)
+    {
+        blockOffset += blockStream.getDecompressedBlockSize(i);
+    }
+    const size_t blockRawSize = blockStream.getDecompressedBlockSize(iBlock);
+    vector<byte> blockData(blockRawSize);
+    const size_t readSize = blockStream.copyDecompressedBlock(iBlock, &blockData[0], blockRawSize);
+
+    const bool isBlockEqual = (readSize == blockRawSize && memcmp(&blockData[0], sentData + blockOffset, blockRawSize) == 0);
+    std::cout << "Block " << iBlock << " of " << nBlocks << (isBlockEqual ? " matches" : " does not match") << " the original data" << std::endl;
+
+    /* The truncated frame is reported when all the compressed data is written to the stream */
+    Decompressor<zlib> truncatedDecompressor;
+    BlockDecompressionStream truncatedStream(&truncatedDecompressor);
+    DataBlock truncatedBlock(&compressedData[0], compressedData.size() - 1);
+    truncatedStream.push_back(&truncatedBlock);
+    truncatedStream.closeInput();
+    const bool isTruncatedFound = hasError(truncatedStream.getErrors(), services::ErrorCompressionIncorrectBlockFrame);
+
+    /* The corrupted header of the frame is reported when the frame is parsed */
+    vector<byte> corruptedData(compressedData);
+    corruptedData[0] ^= 0xFF;
+    Decompressor<zlib> corruptedDecompressor;
+    BlockDecompressionStream corruptedStream(&corruptedDecompressor);
+    DataBlock corruptedBlock(&corruptedData[0], corruptedData.size());
+    corruptedStream.push_back(&corruptedBlock);
+    corruptedStream.getDecompressedDataSize();
+    const bool isCorruptedFound = hasError(corruptedStream.getErrors(), services::ErrorCompressionIncorrectBlockFrame);
+
+    std::cout << "Truncated frame is " << (isTruncatedFound ? "detected" : "not detected") << std::endl;
+    std::cout << "Corrupted frame is " << (isCorruptedFound ? "detected" : "not detected") << std::endl;
+
+    delete[] sentData;
+
+    return (isEqual && isBlockEqual && isTruncatedFound && isCorruptedFound) ? 0 : 1;
+}
+
+bool hasError(const services::SharedPtr<services::ErrorCollection> & errors, services::ErrorID id)
+{
+    const services::KernelErrorCollection & kernelErrors = *(errors->getErrors());
+    for (size_t i = 0; i < kernelErrors.size(); i++)
+    {
+        if (kernelErrors[i]->id() == id) return true;
+    }
+    return false;
+}
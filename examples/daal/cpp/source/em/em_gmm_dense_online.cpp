@@ -0,0 +1,185 @@
+/* file: em_gmm_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) in the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_DENSE_ONLINE"></a>
+ * \example em_gmm_dense_online.cpp
+ */
+
+#include <cmath>
+#include <random>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nComponents     = 2;
+const size_t nFeatures       = 2;
+const size_t nBlocks         = 6;
+const size_t nVectorsInBlock = 1000;
+
+/* Block of the data without the observations of the last component */
+const size_t emptyComponentBlock = 3;
+
+const double separation = 100.0;
+const double sigma      = 1.0;
+
+/* Returns the share of the observations of the component in the block of data */
+double getComponentShare(size_t iBlock, size_t k)
+{
+    if (iBlock == emptyComponentBlock)
+    {
+        return (k == 0 ? 1.0 : 0.0);
+    }
+    return 1.0 / nComponents;
+}
+
+/* Generates the block of data: Gaussian clusters centered at (k * separation, ..., k * separation) */
+NumericTablePtr generateBlock(size_t iBlock, std::mt19937 & generator)
+{
+    std::normal_distribution<double> normal(0.0, sigma);
+
+    services::Status s;
+    NumericTablePtr block = HomogenNumericTable<double>::create(nFeatures, nVectorsInBlock, NumericTable::doAllocate, &s);
+    checkStatus(s);
+    BlockDescriptor<double> rows;
+    block->getBlockOfRows(0, nVectorsInBlock, writeOnly, rows);
+    size_t i = 0;
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        const size_t nVectorsInComponent = (size_t)(getComponentShare(iBlock, k) * nVectorsInBlock);
+        for (size_t end = i + nVectorsInComponent; i < end; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                rows.getBlockPtr()[i * nFeatures + j] = k * separation + normal(generator);
+            }
+        }
+    }
+    block->releaseBlockOfRows(rows);
+    return block;
+}
+
+int main(int argc, char * argv[])
+{
+    services::Status s;
+
+    /* Initial model: equal weights, means at the centers of the clusters and unit covariances */
+    NumericTablePtr weights = HomogenNumericTable<double>::create(nComponents, 1, NumericTable::doAllocate, 1.0 / nComponents, &s);
+    checkStatus(s);
+    NumericTablePtr means = HomogenNumericTable<double>::create(nFeatures, nComponents, NumericTable::doAllocate, &s);
+    checkStatus(s);
+    BlockDescriptor<double> block;
+    means->getBlockOfRows(0, nComponents, writeOnly, block);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            block.getBlockPtr()[k * nFeatures + j] = k * separation;
+        }
+    }
+    means->releaseBlockOfRows(block);
+
+    DataCollectionPtr covariances(new DataCollection());
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        NumericTablePtr covariance = HomogenNumericTable<double>::create(nFeatures, nFeatures, NumericTable::doAllocate, 0.0, &s);
+        checkStatus(s);
+        covariance->getBlockOfRows(0, nFeatures, readWrite, block);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            block.getBlockPtr()[j * nFeatures + j] = sigma * sigma;
+        }
+        covariance->releaseBlockOfRows(block);
+        covariances->push_back(covariance);
+    }
+
+    /* Create an algorithm to fit the GMM in the online processing mode */
+    em_gmm::Online<> algorithm(nComponents);
+    algorithm.input.set(em_gmm::inputWeights, weights);
+    algorithm.input.set(em_gmm::inputMeans, means);
+    algorithm.input.set(em_gmm::inputCovariances, covariances);
+
+    /* Expected weights follow the running shares of the components blended with the same step sizes.
+       The initial weights are the shares of the zeroth block */
+    double expectedShares[nComponents];
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        expectedShares[k] = 1.0 / nComponents;
+    }
+
+    std::mt19937 generator(777);
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        /* The last component gets no mass in one of the blocks, its weight is decreased instead of failing the computation */
+        algorithm.input.set(em_gmm::data, generateBlock(iBlock, generator));
+        checkStatus(algorithm.compute());
+
+        const double gamma = std::pow(iBlock + 2 + algorithm.parameter.stepSizeOffset, -algorithm.parameter.stepSizeDecay);
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            expectedShares[k] = (1.0 - gamma) * expectedShares[k] + gamma * getComponentShare(iBlock, k);
+        }
+    }
+
+    /* Compute the parameters of the GMM from the partial results */
+    checkStatus(algorithm.finalizeCompute());
+    em_gmm::ResultPtr result = algorithm.getResult();
+
+    printNumericTable(result->get(em_gmm::weights), "Weights");
+    printNumericTable(result->get(em_gmm::means), "Means");
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        printNumericTable(result->get(em_gmm::covariances, k), "Covariance");
+    }
+
+    bool isCorrect = true;
+
+    result->get(em_gmm::weights)->getBlockOfRows(0, 1, readOnly, block);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        isCorrect = isCorrect && (std::fabs(block.getBlockPtr()[k] - expectedShares[k]) < 1.0e-6);
+    }
+    result->get(em_gmm::weights)->releaseBlockOfRows(block);
+
+    /* The means of the empty component in the block do not affect the estimated means */
+    result->get(em_gmm::means)->getBlockOfRows(0, nComponents, readOnly, block);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            isCorrect = isCorrect && (std::fabs(block.getBlockPtr()[k * nFeatures + j] - k * separation) < 0.5 * sigma);
+        }
+    }
+    result->get(em_gmm::means)->releaseBlockOfRows(block);
+
+    if (!isCorrect)
+    {
+        std::cout << "The weights or the means of the GMM are not correct" << std::endl;
+    }
+    return isCorrect ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+/* file: em_gmm_diagonal_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) with diagonal covariances in single precision
+!    on the data with a large offset
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_DIAGONAL_BATCH"></a>
+ * \example em_gmm_diagonal_dense_batch.cpp
+ */
+
+#include <cmath>
+#include <random>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float dataFPType; /* Data floating-point type */
+
+/* Input data set parameters */
+const size_t nComponents         = 2;
+const size_t nFeatures           = 3;
+const size_t nVectorsInComponent = 1000;
+
+/* The clusters are far from the origin compared to their size */
+const dataFPType offset     = 10000.0f;
+const dataFPType separation = 10.0f;
+const dataFPType sigma      = 1.0f;
+
+int main(int argc, char * argv[])
+{
+    /* Generate the data: two Gaussian clusters centered at (offset, ..., offset) and (offset + separation, ..., offset + separation) */
+    services::Status s;
+    NumericTablePtr data = HomogenNumericTable<dataFPType>::create(nFeatures, nComponents * nVectorsInComponent, NumericTable::doAllocate, &s);
+    checkStatus(s);
+
+    BlockDescriptor<dataFPType> block;
+    data->getBlockOfRows(0, nComponents * nVectorsInComponent, writeOnly, block);
+    dataFPType * dataArray = block.getBlockPtr();
+
+    std::mt19937 generator(777);
+    std::normal_distribution<dataFPType> normal(0.0f, sigma);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t i = 0; i < nVectorsInComponent * nFeatures; i++)
+        {
+            dataArray[k * nVectorsInComponent * nFeatures + i] = offset + k * separation + normal(generator);
+        }
+    }
+    data->releaseBlockOfRows(block);
+
+    /* Create an algorithm object to initialize the EM algorithm for the GMM with diagonal covariances */
+    em_gmm::init::Batch<dataFPType> initAlgorithm(nComponents);
+    initAlgorithm.parameter.covarianceStorage = em_gmm::diagonal;
+
+    /* Compute initial values for the EM algorithm for the GMM */
+    initAlgorithm.input.set(em_gmm::init::data, data);
+    checkStatus(initAlgorithm.compute());
+
+    /* Create an algorithm object for the EM algorithm for the GMM with diagonal covariances */
+    em_gmm::Batch<dataFPType> algorithm(nComponents);
+    algorithm.parameter.covarianceStorage = em_gmm::diagonal;
+
+    algorithm.input.set(em_gmm::data, data);
+    algorithm.input.set(em_gmm::inputValues, initAlgorithm.getResult());
+
+    /* Compute the results of the EM algorithm for the GMM */
+    checkStatus(algorithm.compute());
+
+    em_gmm::ResultPtr result = algorithm.getResult();
+
+    /* Print the results */
+    printNumericTable(result->get(em_gmm::weights), "Weights");
+    printNumericTable(result->get(em_gmm::means), "Means");
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        printNumericTable(result->get(em_gmm::covariances, i), "Covariance");
+    }
+
+    /* Every estimated mean must be close to the center of one of the clusters */
+    NumericTablePtr means = result->get(em_gmm::means);
+    means->getBlockOfRows(0, nComponents, readOnly, block);
+    const dataFPType * meansArray = block.getBlockPtr();
+    bool isCorrect                = true;
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const dataFPType distance0 = std::fabs(meansArray[k * nFeatures + j] - offset);
+            const dataFPType distance1 = std::fabs(meansArray[k * nFeatures + j] - offset - separation);
+            isCorrect                  = isCorrect && (distance0 < 0.5f * sigma || distance1 < 0.5f * sigma);
+        }
+    }
+    means->releaseBlockOfRows(block);
+
+    if (!isCorrect)
+    {
+        std::cout << "The means are not found" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
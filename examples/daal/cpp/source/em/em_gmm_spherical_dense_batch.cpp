@@ -0,0 +1,193 @@
+/* file: em_gmm_spherical_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) with diagonal and spherical covariances
+!    in double precision. The results are compared with the results
+!    computed in single precision
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_SPHERICAL_BATCH"></a>
+ * \example em_gmm_spherical_dense_batch.cpp
+ */
+
+#include <cmath>
+#include <random>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nComponents         = 3;
+const size_t nFeatures           = 4;
+const size_t nVectorsInComponent = 1000;
+const size_t nVectors            = nComponents * nVectorsInComponent;
+
+const double separation = 10.0;
+const double sigma      = 1.0;
+
+/* Maximal difference between the results computed in double and in single precision */
+const double tolerance = 1.0e-3;
+
+template <typename FPType>
+em_gmm::ResultPtr computeEM(const vector<double> & dataArray, em_gmm::CovarianceStorageId covarianceStorage)
+{
+    services::Status s;
+    NumericTablePtr data = HomogenNumericTable<FPType>::create(nFeatures, nVectors, NumericTable::doAllocate, &s);
+    checkStatus(s);
+    BlockDescriptor<FPType> block;
+    data->getBlockOfRows(0, nVectors, writeOnly, block);
+    for (size_t i = 0; i < nVectors * nFeatures; i++)
+    {
+        block.getBlockPtr()[i] = (FPType)dataArray[i];
+    }
+    data->releaseBlockOfRows(block);
+
+    /* The initial means are shifted from the centers of the clusters */
+    NumericTablePtr weights = HomogenNumericTable<FPType>::create(nComponents, 1, NumericTable::doAllocate, FPType(1.0 / nComponents), &s);
+    checkStatus(s);
+    NumericTablePtr means = HomogenNumericTable<FPType>::create(nFeatures, nComponents, NumericTable::doAllocate, &s);
+    checkStatus(s);
+    means->getBlockOfRows(0, nComponents, writeOnly, block);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            block.getBlockPtr()[k * nFeatures + j] = FPType(k * separation + 0.5 * sigma);
+        }
+    }
+    means->releaseBlockOfRows(block);
+
+    DataCollectionPtr covariances(new DataCollection());
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        covariances->push_back(HomogenNumericTable<FPType>::create(nFeatures, 1, NumericTable::doAllocate, FPType(2 * sigma * sigma), &s));
+        checkStatus(s);
+    }
+
+    em_gmm::Batch<FPType> algorithm(nComponents);
+    algorithm.parameter.covarianceStorage = covarianceStorage;
+
+    algorithm.input.set(em_gmm::data, data);
+    algorithm.input.set(em_gmm::inputWeights, weights);
+    algorithm.input.set(em_gmm::inputMeans, means);
+    algorithm.input.set(em_gmm::inputCovariances, covariances);
+
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+/* Returns the maximal difference between the elements of the tables */
+double maxDifference(const NumericTablePtr & first, const NumericTablePtr & second)
+{
+    const size_t nRows = first->getNumberOfRows();
+    const size_t nCols = first->getNumberOfColumns();
+
+    BlockDescriptor<double> firstBlock, secondBlock;
+    first->getBlockOfRows(0, nRows, readOnly, firstBlock);
+    second->getBlockOfRows(0, nRows, readOnly, secondBlock);
+    double difference = 0;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        const double elementDifference = std::fabs(firstBlock.getBlockPtr()[i] - secondBlock.getBlockPtr()[i]);
+        difference                     = (elementDifference > difference ? elementDifference : difference);
+    }
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return difference;
+}
+
+bool checkResult(const em_gmm::ResultPtr & result, const em_gmm::ResultPtr & floatResult, em_gmm::CovarianceStorageId covarianceStorage)
+{
+    bool isCorrect = true;
+
+    /* Every estimated mean must be close to the center of its cluster */
+    NumericTablePtr means = result->get(em_gmm::means);
+    BlockDescriptor<double> block;
+    means->getBlockOfRows(0, nComponents, readOnly, block);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            isCorrect = isCorrect && (std::fabs(block.getBlockPtr()[k * nFeatures + j] - k * separation) < 0.5 * sigma);
+        }
+    }
+    means->releaseBlockOfRows(block);
+
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        /* The variances of the spherical covariance are equal */
+        NumericTablePtr covariance = result->get(em_gmm::covariances, k);
+        covariance->getBlockOfRows(0, 1, readOnly, block);
+        for (size_t j = 1; j < nFeatures && covarianceStorage == em_gmm::spherical; j++)
+        {
+            isCorrect = isCorrect && (block.getBlockPtr()[j] == block.getBlockPtr()[0]);
+        }
+        covariance->releaseBlockOfRows(block);
+
+        isCorrect = isCorrect && (maxDifference(covariance, floatResult->get(em_gmm::covariances, k)) < tolerance);
+    }
+
+    isCorrect = isCorrect && (maxDifference(result->get(em_gmm::weights), floatResult->get(em_gmm::weights)) < tolerance);
+    isCorrect = isCorrect && (maxDifference(means, floatResult->get(em_gmm::means)) < tolerance);
+    return isCorrect;
+}
+
+int main(int argc, char * argv[])
+{
+    /* Generate the data: Gaussian clusters centered at (k * separation, ..., k * separation) */
+    vector<double> dataArray(nVectors * nFeatures);
+    std::mt19937 generator(777);
+    std::normal_distribution<double> normal(0.0, sigma);
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        for (size_t i = 0; i < nVectorsInComponent * nFeatures; i++)
+        {
+            dataArray[k * nVectorsInComponent * nFeatures + i] = k * separation + normal(generator);
+        }
+    }
+
+    const em_gmm::CovarianceStorageId covarianceStorages[] = { em_gmm::diagonal, em_gmm::spherical };
+    const char * covarianceStorageNames[]                 = { "diagonal", "spherical" };
+
+    bool isCorrect = true;
+    for (size_t i = 0; i < 2; i++)
+    {
+        em_gmm::ResultPtr result      = computeEM<double>(dataArray, covarianceStorages[i]);
+        em_gmm::ResultPtr floatResult = computeEM<float>(dataArray, covarianceStorages[i]);
+
+        std::cout << "GMM with " << covarianceStorageNames[i] << " covariances:" << std::endl;
+        printNumericTable(result->get(em_gmm::weights), "Weights");
+        printNumericTable(result->get(em_gmm::means), "Means");
+
+        const bool isStorageCorrect = checkResult(result, floatResult, covarianceStorages[i]);
+        if (!isStorageCorrect)
+        {
+            std::cout << "The results with " << covarianceStorageNames[i] << " covariances are not correct" << std::endl;
+        }
+        isCorrect = isCorrect && isStorageCorrect;
+    }
+
+    return isCorrect ? 0 : 1;
+}
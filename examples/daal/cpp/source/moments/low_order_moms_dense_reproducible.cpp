@@ -0,0 +1,137 @@
+/* file: low_order_moms_dense_reproducible.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of checking that low order moments computed in the batch and
+!    online processing modes do not depend on the number of threads
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOW_ORDER_MOMENTS_DENSE_REPRODUCIBLE">
+ * \example low_order_moms_dense_reproducible.cpp
+ */
+
+#include <cstring>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nFeatures       = 10;
+const size_t nVectors        = 20000;
+const size_t nVectorsInBlock = 2500;
+
+NumericTablePtr createData()
+{
+    NumericTablePtr data(new HomogenNumericTable<double>(nFeatures, nVectors, NumericTable::doAllocate));
+    BlockDescriptor<double> block;
+    data->getBlockOfRows(0, nVectors, writeOnly, block);
+    double * values = block.getBlockPtr();
+
+    /* Values of different magnitudes, so the rounding errors depend on the order of the summation */
+    unsigned int state = 777;
+    for (size_t i = 0; i < nVectors * nFeatures; i++)
+    {
+        state     = state * 1103515245u + 12345u;
+        values[i] = (double)(state >> 8) / (double)(1u << 24) * (double)(1 + i % nFeatures) * 1.0e3 - 1.0e2;
+    }
+    data->releaseBlockOfRows(block);
+    return data;
+}
+
+low_order_moments::ResultPtr computeBatch(const NumericTablePtr & data)
+{
+    low_order_moments::Batch<double> algorithm;
+    algorithm.input.set(low_order_moments::data, data);
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+low_order_moments::ResultPtr computeOnline(const NumericTablePtr & data)
+{
+    low_order_moments::Online<double> algorithm;
+
+    BlockDescriptor<double> block;
+    for (size_t i = 0; i < nVectors; i += nVectorsInBlock)
+    {
+        data->getBlockOfRows(i, nVectorsInBlock, readOnly, block);
+        NumericTablePtr dataBlock(new HomogenNumericTable<double>(block.getBlockPtr(), nFeatures, nVectorsInBlock));
+
+        algorithm.input.set(low_order_moments::data, dataBlock);
+        checkStatus(algorithm.compute());
+        data->releaseBlockOfRows(block);
+    }
+
+    checkStatus(algorithm.finalizeCompute());
+    return algorithm.getResult();
+}
+
+bool isBitwiseEqual(const low_order_moments::ResultPtr & expected, const low_order_moments::ResultPtr & actual)
+{
+    for (size_t id = 0; id <= low_order_moments::lastResultId; id++)
+    {
+        NumericTablePtr expectedTable = expected->get((low_order_moments::ResultId)id);
+        NumericTablePtr actualTable   = actual->get((low_order_moments::ResultId)id);
+
+        BlockDescriptor<double> expectedBlock, actualBlock;
+        expectedTable->getBlockOfRows(0, 1, readOnly, expectedBlock);
+        actualTable->getBlockOfRows(0, 1, readOnly, actualBlock);
+        const bool isEqual = (memcmp(expectedBlock.getBlockPtr(), actualBlock.getBlockPtr(), nFeatures * sizeof(double)) == 0);
+        expectedTable->releaseBlockOfRows(expectedBlock);
+        actualTable->releaseBlockOfRows(actualBlock);
+
+        if (!isEqual) return false;
+    }
+    return true;
+}
+
+int main(int argc, char * argv[])
+{
+    NumericTablePtr data = createData();
+
+    const size_t nMaxThreads = services::Environment::getInstance()->getNumberOfThreads();
+    const size_t nThreads[]  = { 1, 2, nMaxThreads };
+
+    /* Compute the reference results on one thread */
+    services::Environment::getInstance()->setNumberOfThreads(nThreads[0]);
+    low_order_moments::ResultPtr batchResult  = computeBatch(data);
+    low_order_moments::ResultPtr onlineResult = computeOnline(data);
+
+    bool isEqual = true;
+    for (size_t i = 1; i < sizeof(nThreads) / sizeof(nThreads[0]); i++)
+    {
+        services::Environment::getInstance()->setNumberOfThreads(nThreads[i]);
+
+        const bool isBatchEqual  = isBitwiseEqual(batchResult, computeBatch(data));
+        const bool isOnlineEqual = isBitwiseEqual(onlineResult, computeOnline(data));
+        std::cout << "Number of threads " << nThreads[i] << ": batch results " << (isBatchEqual ? "match" : "do not match") << ", online results "
+                  << (isOnlineEqual ? "match" : "do not match") << " the results on one thread" << std::endl;
+        isEqual = isEqual && isBatchEqual && isOnlineEqual;
+    }
+    services::Environment::getInstance()->setNumberOfThreads(nMaxThreads);
+
+    printNumericTable(batchResult->get(low_order_moments::mean), "Mean:");
+    printNumericTable(batchResult->get(low_order_moments::variance), "Variance:");
+
+    return isEqual ? 0 : 1;
+}
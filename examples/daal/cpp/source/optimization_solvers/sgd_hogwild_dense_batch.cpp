@@ -0,0 +1,189 @@
+/* file: sgd_hogwild_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the asynchronous (hogwild) Stochastic gradient descent and SAGA algorithms
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SGD_HOGWILD_BATCH"></a>
+ * \example sgd_hogwild_dense_batch.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+string datasetFileName = "../data/batch/mse.csv";
+
+const size_t nIterations = 1000;
+const size_t nFeatures   = 3;
+
+/* Learning rate sequences of several elements */
+const size_t nSgdLearningRates            = 4;
+float sgdLearningRates[nSgdLearningRates] = { 1.0f, 0.5f, 0.25f, 0.125f };
+const float sagaLearningRate              = 0.1f;
+
+/* The deterministic hogwild methods apply the updates in the order of batch indices like the default methods */
+const float tolerance = 1.0e-4f;
+
+float initialPoint[nFeatures + 1] = { 8, 2, 1, 4 };
+
+NumericTablePtr createBatchIndices(size_t nVectors)
+{
+    NumericTablePtr batchIndices(new HomogenNumericTable<int>(1, nIterations, NumericTable::doAllocate));
+    BlockDescriptor<int> block;
+    batchIndices->getBlockOfRows(0, nIterations, writeOnly, block);
+    int * indices = block.getBlockPtr();
+    for (size_t i = 0; i < nIterations; i++)
+    {
+        indices[i] = (int)((i * 7 + 3) % nVectors);
+    }
+    batchIndices->releaseBlockOfRows(block);
+    return batchIndices;
+}
+
+NumericTablePtr createSagaLearningRates()
+{
+    /* SAGA accepts the sequence with one learning rate per iteration */
+    NumericTablePtr learningRates(new HomogenNumericTable<>(1, nIterations, NumericTable::doAllocate));
+    BlockDescriptor<> block;
+    learningRates->getBlockOfRows(0, nIterations, writeOnly, block);
+    float * rates = block.getBlockPtr();
+    for (size_t i = 0; i < nIterations; i++)
+    {
+        rates[i] = sagaLearningRate / (float)(1 + i % 4);
+    }
+    learningRates->releaseBlockOfRows(block);
+    return learningRates;
+}
+
+bool checkMinimum(const NumericTablePtr & expected, const NumericTablePtr & actual, const char * message)
+{
+    BlockDescriptor<> expectedBlock, actualBlock;
+    expected->getBlockOfRows(0, nFeatures + 1, readOnly, expectedBlock);
+    actual->getBlockOfRows(0, nFeatures + 1, readOnly, actualBlock);
+    const float * expectedArray = expectedBlock.getBlockPtr();
+    const float * actualArray   = actualBlock.getBlockPtr();
+
+    bool isEqual = true;
+    for (size_t i = 0; i < nFeatures + 1; i++)
+    {
+        const float scale = std::fabs(expectedArray[i]) > 1.0f ? std::fabs(expectedArray[i]) : 1.0f;
+        if (std::fabs(expectedArray[i] - actualArray[i]) > tolerance * scale) isEqual = false;
+    }
+    expected->releaseBlockOfRows(expectedBlock);
+    actual->releaseBlockOfRows(actualBlock);
+
+    std::cout << message << (isEqual ? " matches" : " does not match") << " the default method" << std::endl;
+    return isEqual;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and values for dependent variable */
+    NumericTablePtr data(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr dependentVariables(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, dependentVariables));
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    size_t nVectors = data->getNumberOfRows();
+
+    services::SharedPtr<optimization_solver::mse::Batch<> > mseObjectiveFunction(new optimization_solver::mse::Batch<>(nVectors));
+    mseObjectiveFunction->input.set(optimization_solver::mse::data, data);
+    mseObjectiveFunction->input.set(optimization_solver::mse::dependentVariables, dependentVariables);
+
+    NumericTablePtr batchIndices = createBatchIndices(nVectors);
+    NumericTablePtr sgdLearningRateSequence(new HomogenNumericTable<>(sgdLearningRates, 1, nSgdLearningRates));
+    NumericTablePtr sagaLearningRateSequence = createSagaLearningRates();
+
+    /* Create objects to compute the Stochastic gradient descent result using the default and the hogwild methods */
+    optimization_solver::sgd::Batch<> sgdAlgorithm(mseObjectiveFunction);
+    optimization_solver::sgd::Batch<float, optimization_solver::sgd::hogwild> sgdHogwildAlgorithm(mseObjectiveFunction);
+
+    sgdAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                           NumericTablePtr(new HomogenNumericTable<>(initialPoint, 1, nFeatures + 1)));
+    sgdAlgorithm.parameter.learningRateSequence = sgdLearningRateSequence;
+    sgdAlgorithm.parameter.batchIndices         = batchIndices;
+    sgdAlgorithm.parameter.nIterations          = nIterations;
+    sgdAlgorithm.parameter.accuracyThreshold    = 0.0;
+
+    sgdHogwildAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                                  NumericTablePtr(new HomogenNumericTable<>(initialPoint, 1, nFeatures + 1)));
+    sgdHogwildAlgorithm.parameter.learningRateSequence = sgdLearningRateSequence;
+    sgdHogwildAlgorithm.parameter.batchIndices         = batchIndices;
+    sgdHogwildAlgorithm.parameter.nIterations          = nIterations;
+    sgdHogwildAlgorithm.parameter.accuracyThreshold    = 0.0;
+    sgdHogwildAlgorithm.parameter.deterministic        = true;
+
+    /* Compute the Stochastic gradient descent results */
+    checkStatus(sgdAlgorithm.compute());
+    checkStatus(sgdHogwildAlgorithm.compute());
+
+    NumericTablePtr sgdMinimum        = sgdAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    NumericTablePtr sgdHogwildMinimum = sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    printNumericTable(sgdHogwildMinimum, "SGD hogwild minimum:");
+    printNumericTable(sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations), "Number of iterations performed:");
+
+    /* Create objects to compute the SAGA result using the default and the hogwild methods */
+    optimization_solver::saga::Batch<> sagaAlgorithm(mseObjectiveFunction);
+    optimization_solver::saga::Batch<float, optimization_solver::saga::hogwild> sagaHogwildAlgorithm(mseObjectiveFunction);
+
+    sagaAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                            NumericTablePtr(new HomogenNumericTable<>(initialPoint, 1, nFeatures + 1)));
+    sagaAlgorithm.parameter().learningRateSequence = sagaLearningRateSequence;
+    sagaAlgorithm.parameter().batchIndices         = batchIndices;
+    sagaAlgorithm.parameter().batchSize            = 1;
+    sagaAlgorithm.parameter().nIterations          = nIterations;
+    sagaAlgorithm.parameter().accuracyThreshold    = 0.0;
+
+    sagaHogwildAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                                   NumericTablePtr(new HomogenNumericTable<>(initialPoint, 1, nFeatures + 1)));
+    sagaHogwildAlgorithm.parameter().learningRateSequence = sagaLearningRateSequence;
+    sagaHogwildAlgorithm.parameter().batchIndices         = batchIndices;
+    sagaHogwildAlgorithm.parameter().batchSize            = 1;
+    sagaHogwildAlgorithm.parameter().nIterations          = nIterations;
+    sagaHogwildAlgorithm.parameter().accuracyThreshold    = 0.0;
+    sagaHogwildAlgorithm.parameter().deterministic        = true;
+
+    /* Compute the SAGA results */
+    checkStatus(sagaAlgorithm.compute());
+    checkStatus(sagaHogwildAlgorithm.compute());
+
+    NumericTablePtr sagaMinimum        = sagaAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    NumericTablePtr sagaHogwildMinimum = sagaHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+    printNumericTable(sagaHogwildMinimum, "SAGA hogwild minimum:");
+    printNumericTable(sagaHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations), "Number of iterations performed:");
+
+    const bool sgdIsEqual  = checkMinimum(sgdMinimum, sgdHogwildMinimum, "SGD hogwild minimum");
+    const bool sagaIsEqual = checkMinimum(sagaMinimum, sagaHogwildMinimum, "SAGA hogwild minimum");
+    return (sgdIsEqual && sagaIsEqual) ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/* file: huge_pages.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of backing numeric tables and temporary buffers of the
+!    algorithms with 2MB pages
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-HUGE_PAGES"></a>
+ * \example huge_pages.cpp
+ */
+
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters: the table takes 3.2MB,
+   the cross-product computed by the covariance algorithm takes 320KB */
+const size_t nFeatures = 200;
+const size_t nVectors  = 2000;
+
+/* Minimal size of the numeric tables and the temporary buffers backed by huge pages */
+const size_t hugePagesThreshold = 64 * 1024;
+
+const size_t hugePageSize = 2 * 1024 * 1024;
+
+typedef services::SharedPtr<HomogenNumericTable<double> > HomogenTablePtr;
+
+/* Returns true if the memory is backed by huge pages. On Linux the memory backed by huge pages is
+   mapped at the 2MB boundary and the data starts at the default alignment from it */
+bool isHugePagesMemory(const void * ptr)
+{
+#if defined(__linux__)
+    return (size_t)ptr % hugePageSize == DAAL_MALLOC_DEFAULT_ALIGNMENT;
+#else
+    return true;
+#endif
+}
+
+void fillTable(const HomogenTablePtr & table)
+{
+    double * data      = table->getArray();
+    const size_t nRows = table->getNumberOfRows();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            data[i * nFeatures + j] = (double)((i * 7 + j * 13) % 101) / (double)(j + 1);
+        }
+    }
+}
+
+NumericTablePtr computeCovariance(const NumericTablePtr & data)
+{
+    covariance::Batch<double> algorithm;
+    algorithm.input.set(covariance::data, data);
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(covariance::covariance);
+}
+
+double maxDifference(const NumericTablePtr & first, const NumericTablePtr & second)
+{
+    BlockDescriptor<double> firstBlock, secondBlock;
+    first->getBlockOfRows(0, nFeatures, readOnly, firstBlock);
+    second->getBlockOfRows(0, nFeatures, readOnly, secondBlock);
+    double difference = 0;
+    for (size_t i = 0; i < nFeatures * nFeatures; i++)
+    {
+        const double elementDifference = std::fabs(firstBlock.getBlockPtr()[i] - secondBlock.getBlockPtr()[i]);
+        difference                     = (elementDifference > difference ? elementDifference : difference);
+    }
+    first->releaseBlockOfRows(firstBlock);
+    second->releaseBlockOfRows(secondBlock);
+    return difference;
+}
+
+int main(int argc, char * argv[])
+{
+    services::Status s;
+
+    /* Request huge pages for a numeric table explicitly */
+    HomogenTablePtr table = HomogenNumericTable<double>::create(nFeatures, nVectors, daal::hugePages, &s);
+    checkStatus(s);
+    fillTable(table);
+    const bool isTableOnHugePages = isHugePagesMemory(table->getArray());
+
+    /* The memory of the same type is allocated when the table grows */
+    checkStatus(table->resize(2 * nVectors));
+    fillTable(table);
+    const bool isResizedOnHugePages = isHugePagesMemory(table->getArray());
+
+    /* Compute the reference result with the temporary buffers of the algorithm allocated in a usual way */
+    checkStatus(table->resize(nVectors));
+    NumericTablePtr expected = computeCovariance(table);
+
+    /* Back the tables and the temporary buffers of the algorithms that are larger than the threshold by huge pages */
+    services::Environment::getInstance()->setHugePagesThreshold(hugePagesThreshold);
+
+    HomogenTablePtr dramTable = HomogenNumericTable<double>::create(nFeatures, nVectors, NumericTable::doAllocate, &s);
+    checkStatus(s);
+    fillTable(dramTable);
+    const bool isDramTableOnHugePages = isHugePagesMemory(dramTable->getArray());
+
+    NumericTablePtr actual = computeCovariance(dramTable);
+
+    /* Free the memory backed by huge pages and disable huge pages */
+    table     = HomogenTablePtr();
+    dramTable = HomogenTablePtr();
+    services::Environment::getInstance()->setHugePagesThreshold(0);
+
+    const bool isEqual = (maxDifference(expected, actual) < 1.0e-10);
+
+    std::cout << "Table with huge pages requested is " << (isTableOnHugePages ? "" : "not ") << "backed by huge pages" << std::endl;
+    std::cout << "Resized table is " << (isResizedOnHugePages ? "" : "not ") << "backed by huge pages" << std::endl;
+    std::cout << "Table larger than the threshold is " << (isDramTableOnHugePages ? "" : "not ") << "backed by huge pages" << std::endl;
+    std::cout << "Covariance computed with huge pages " << (isEqual ? "matches" : "does not match") << " the reference" << std::endl;
+    printNumericTable(actual, "Covariance matrix (upper left corner):", 5, 5);
+
+    return (isTableOnHugePages && isResizedOnHugePages && isDramTableOnHugePages && isEqual) ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+/* file: DataStructuresDirectBuffer.java */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+ //  Content:
+ //     Java example of creating numeric tables over the memory of direct buffers without copying it
+ ////////////////////////////////////////////////////////////////////////////////
+ */
+
+/**
+ * <a name="DAAL-EXAMPLE-JAVA-DATASTRUCTURESDIRECTBUFFER">
+ * @example DataStructuresDirectBuffer.java
+ */
+
+package com.intel.daal.examples.datasource;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.LongBuffer;
+import com.intel.daal.data_management.data.CSRNumericTable;
+import com.intel.daal.data_management.data.HomogenNumericTable;
+import com.intel.daal.services.DaalContext;
+
+
+class DataStructuresDirectBuffer {
+    private static final int nVectors  = 4;
+    private static final int nFeatures = 3;
+
+    private static DaalContext context = new DaalContext();
+
+    public static void main(String[] args) throws IllegalAccessException {
+        System.out.println("Numeric tables over direct buffers example\n");
+
+        /* Create a homogeneous numeric table over the direct buffer with the native byte order */
+        ByteBuffer byteData = ByteBuffer.allocateDirect(nVectors * nFeatures * 8 /* sizeof(double) */);
+        DoubleBuffer data   = byteData.order(ByteOrder.nativeOrder()).asDoubleBuffer();
+        for (int i = 0; i < nVectors * nFeatures; i++) {
+            data.put(i, (double)i);
+        }
+        HomogenNumericTable dataTable = new HomogenNumericTable(context, data, nFeatures, nVectors);
+
+        /* The table uses the memory of the buffer, so the changes of the buffer are visible in the table */
+        data.put(0, 100.0);
+        DoubleBuffer block = dataTable.getBlockOfRows(0, nVectors, DoubleBuffer.allocate(nVectors * nFeatures));
+        checkValue(block.get(0), 100.0, "Homogeneous table does not use the memory of the direct buffer");
+        dataTable.releaseBlockOfRows(0, nVectors, block);
+
+        /* Blocks of rows that point to the memory of the table are returned only if they are enabled */
+        dataTable.setBlockViewsEnabled(true);
+        DoubleBuffer view = dataTable.getBlockOfRows(1, 2, DoubleBuffer.allocate(2 * nFeatures));
+        view.put(0, -1.0);
+        dataTable.releaseBlockOfRows(1, 2, view);
+        checkValue(data.get(nFeatures), -1.0, "Block of rows does not point to the memory of the table");
+        dataTable.setBlockViewsEnabled(false);
+
+        /* The buffer with non-zero position is rejected, the memory is used starting from the first element */
+        DoubleBuffer shiftedData = ByteBuffer.allocateDirect(nVectors * nFeatures * 8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+        shiftedData.position(1);
+        boolean isRejected = false;
+        try {
+            new HomogenNumericTable(context, shiftedData, nFeatures, nVectors);
+        } catch (IllegalArgumentException e) {
+            isRejected = true;
+        }
+        if (!isRejected) {
+            throw new RuntimeException("Direct buffer with non-zero position is accepted");
+        }
+
+        /* Create a CSR numeric table over the direct buffers: one-based indexing, one non-zero value in a row */
+        DoubleBuffer values   = ByteBuffer.allocateDirect(nVectors * 8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+        LongBuffer colIndices = ByteBuffer.allocateDirect(nVectors * 8).order(ByteOrder.nativeOrder()).asLongBuffer();
+        LongBuffer rowOffsets = ByteBuffer.allocateDirect((nVectors + 1) * 8).order(ByteOrder.nativeOrder()).asLongBuffer();
+        for (int i = 0; i < nVectors; i++) {
+            values.put(i, (double)(i + 1));
+            colIndices.put(i, i % nFeatures + 1);
+            rowOffsets.put(i, i + 1);
+        }
+        rowOffsets.put(nVectors, nVectors + 1);
+        CSRNumericTable csrTable = new CSRNumericTable(context, values, colIndices, rowOffsets, nFeatures, nVectors,
+                                                       CSRNumericTable.Indexing.oneBased);
+
+        DoubleBuffer csrBlock = csrTable.getBlockOfRows(0, nVectors, DoubleBuffer.allocate(nVectors * nFeatures));
+        for (int i = 0; i < nVectors; i++) {
+            checkValue(csrBlock.get(i * nFeatures + i % nFeatures), (double)(i + 1), "CSR table does not use the memory of the direct buffers");
+        }
+        csrTable.releaseBlockOfRows(0, nVectors, csrBlock);
+
+        System.out.println("Numeric tables use the memory of the direct buffers");
+
+        context.dispose();
+    }
+
+    private static void checkValue(double value, double expected, String message) {
+        if (value != expected) {
+            throw new RuntimeException(message);
+        }
+    }
+}
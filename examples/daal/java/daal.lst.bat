@@ -44,6 +44,7 @@ covariance\CovDenseDistr ^
 covariance\CovDenseOnline ^
 datasource\DataSourceFeatureExtraction ^
 datasource\DataStructuresHomogen ^
+datasource\DataStructuresDirectBuffer ^
 datasource\DataStructuresAOS ^
 datasource\DataStructuresSOA ^
 datasource\DataStructuresCSR ^
@@ -225,6 +225,46 @@ public class CSRNumericTable extends NumericTable {
         tableImpl = new CSRNumericTableImpl(context, data, colIndices, rowOffsets, nFeatures, nVectors);
     }
 
+    /**
+     * Constructs sparse CSR numeric table that uses the memory of the direct buffers without copying it.
+     * The buffers must have the native byte order
+     *
+     * @param context       Context to manage created CSR numeric table
+     * @param data          Direct buffer of doubles with values in the CSR layout
+     * @param colIndices    Direct buffer of column indices in the CSR layout. The values of indices are determined by the index base
+     * @param rowOffsets    Direct buffer of row indices in the CSR layout. The size of the buffer is nVectors+1. The first element is 0/1
+     *                          in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     * @param nFeatures     Number of columns in the corresponding dense table
+     * @param nVectors      Number of rows in the corresponding dense table
+     * @param indexing      %Indexing scheme used to access data in the CSR layout
+     *  Note: Present version of Intel(R) oneAPI Data Analytics Library supports 1-based indexing only
+     */
+    public CSRNumericTable(DaalContext context, DoubleBuffer data, LongBuffer colIndices, LongBuffer rowOffsets, long nFeatures,
+            long nVectors, Indexing indexing) {
+        super(context);
+        tableImpl = new CSRNumericTableImpl(context, data, colIndices, rowOffsets, nFeatures, nVectors, indexing);
+    }
+
+    /**
+     * Constructs sparse CSR numeric table that uses the memory of the direct buffers without copying it.
+     * The buffers must have the native byte order
+     *
+     * @param context       Context to manage created CSR numeric table
+     * @param data          Direct buffer of floats with values in the CSR layout
+     * @param colIndices    Direct buffer of column indices in the CSR layout. The values of indices are determined by the index base
+     * @param rowOffsets    Direct buffer of row indices in the CSR layout. The size of the buffer is nVectors+1. The first element is 0/1
+     *                          in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     * @param nFeatures     Number of columns in the corresponding dense table
+     * @param nVectors      Number of rows in the corresponding dense table
+     * @param indexing      %Indexing scheme used to access data in the CSR layout
+     *  Note: Present version of Intel(R) oneAPI Data Analytics Library supports 1-based indexing only
+     */
+    public CSRNumericTable(DaalContext context, FloatBuffer data, LongBuffer colIndices, LongBuffer rowOffsets, long nFeatures,
+            long nVectors, Indexing indexing) {
+        super(context);
+        tableImpl = new CSRNumericTableImpl(context, data, colIndices, rowOffsets, nFeatures, nVectors, indexing);
+    }
+
     /**
     * Constructs homogeneous numeric table from C++ homogeneous numeric
     *        table
@@ -22,6 +22,7 @@
 package com.intel.daal.data_management.data;
 
 import com.intel.daal.utils.*;
+import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
 import java.nio.DoubleBuffer;
@@ -188,6 +189,48 @@ public class CSRNumericTableImpl extends NumericTableImpl {
         initialize(data, colIndices, rowOffsets, nFeatures, nVectors);
     }
 
+    /**
+     * Constructs sparse CSR numeric table that uses the memory of the direct buffers without copying it
+     *
+     * @param context       Context to manage created CSR numeric table
+     * @param data          Direct buffer of values in the CSR layout
+     * @param colIndices    Direct buffer of column indices in the CSR layout. The values of indices are determined by the index base
+     * @param rowOffsets    Direct buffer of row indices in the CSR layout. The size of the buffer is nVectors+1. The first element is 0/1
+     *                          in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     * @param nFeatures     Number of columns in the corresponding dense table
+     * @param nVectors      Number of rows in the corresponding dense table
+     * @param indexing      %Indexing scheme used to access data in the CSR layout
+     *  Note: Present version of Intel(R) oneAPI Data Analytics Library supports 1-based indexing only
+     */
+    public CSRNumericTableImpl(DaalContext context, DoubleBuffer data, LongBuffer colIndices, LongBuffer rowOffsets, long nFeatures,
+            long nVectors, CSRNumericTable.Indexing indexing) {
+        super(context);
+        checkDirectBuffers(data, data.order(), colIndices, rowOffsets, nVectors);
+        cObject = dInitDirect(data, colIndices, rowOffsets, nFeatures, nVectors, indexing.getValue());
+        initializeDirect(Double.class, nFeatures);
+    }
+
+    /**
+     * Constructs sparse CSR numeric table that uses the memory of the direct buffers without copying it
+     *
+     * @param context       Context to manage created CSR numeric table
+     * @param data          Direct buffer of values in the CSR layout
+     * @param colIndices    Direct buffer of column indices in the CSR layout. The values of indices are determined by the index base
+     * @param rowOffsets    Direct buffer of row indices in the CSR layout. The size of the buffer is nVectors+1. The first element is 0/1
+     *                          in zero-/one-based indexing. The last element is ptr_size+0/1 in zero-/one-based indexing
+     * @param nFeatures     Number of columns in the corresponding dense table
+     * @param nVectors      Number of rows in the corresponding dense table
+     * @param indexing      %Indexing scheme used to access data in the CSR layout
+     *  Note: Present version of Intel(R) oneAPI Data Analytics Library supports 1-based indexing only
+     */
+    public CSRNumericTableImpl(DaalContext context, FloatBuffer data, LongBuffer colIndices, LongBuffer rowOffsets, long nFeatures,
+            long nVectors, CSRNumericTable.Indexing indexing) {
+        super(context);
+        checkDirectBuffers(data, data.order(), colIndices, rowOffsets, nVectors);
+        cObject = sInitDirect(data, colIndices, rowOffsets, nFeatures, nVectors, indexing.getValue());
+        initializeDirect(Float.class, nFeatures);
+    }
+
     /**
     * Constructs homogeneous numeric table from C++ homogeneous numeric
     *        table
@@ -641,6 +684,28 @@ public class CSRNumericTableImpl extends NumericTableImpl {
         initDataDictionary(data.getClass().getComponentType(), nFeatures);
     }
 
+    private void initializeDirect(Class<?> cls, long nFeatures) {
+        this.type = cls;
+        this.dataAllocatedInJava = false;
+        initDataDictionary(cls, nFeatures);
+    }
+
+    private static void checkDirectBuffers(Buffer data, ByteOrder order, LongBuffer colIndices, LongBuffer rowOffsets, long nVectors) {
+        if (!data.isDirect() || !colIndices.isDirect() || !rowOffsets.isDirect()) {
+            throw new IllegalArgumentException("buffers must be direct");
+        }
+        if (order != ByteOrder.nativeOrder() || colIndices.order() != ByteOrder.nativeOrder() || rowOffsets.order() != ByteOrder.nativeOrder()) {
+            throw new IllegalArgumentException("byte order of the buffers must be native");
+        }
+        if (rowOffsets.capacity() < nVectors + 1) {
+            throw new IllegalArgumentException("size of the row offsets buffer is less than nVectors + 1");
+        }
+        long dataSize = rowOffsets.get((int)nVectors) - rowOffsets.get(0);
+        if (data.capacity() < dataSize || colIndices.capacity() < dataSize) {
+            throw new IllegalArgumentException("size of the data or column indices buffer is less than the number of non-zero values");
+        }
+    }
+
     private void initDataDictionary(Class<?> cls, long nFeatures) {
         dict = new DataDictionary(getContext(), nFeatures, cGetCDataDictionary(cObject));
         dict.setFeature(cls, 0);
@@ -649,6 +714,10 @@ public class CSRNumericTableImpl extends NumericTableImpl {
     /* Creates CSR numeric table with nColumns columns and nRows rows */
     protected native long initCSRNumericTable(long nColumns, long nRows);
 
+    /* Creates C++ CSR numeric table over the memory of the direct buffers */
+    private native long dInitDirect(Buffer data, LongBuffer colIndices, LongBuffer rowOffsets, long nColumns, long nRows, int indexing);
+    private native long sInitDirect(Buffer data, LongBuffer colIndices, LongBuffer rowOffsets, long nColumns, long nRows, int indexing);
+
     @Override
     protected void onUnpack(DaalContext context) {
         if (dataAllocatedInJava) {
@@ -25,6 +25,7 @@ import com.intel.daal.utils.*;
 import java.nio.DoubleBuffer;
 import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
+import java.nio.LongBuffer;
 
 import com.intel.daal.services.DaalContext;
 
@@ -277,6 +278,122 @@ public class HomogenNumericTable extends NumericTable {
         tableImpl = new HomogenNumericTableArrayImpl(context, data, nFeatures, nVectors, constValue, featuresEqual);
     }
 
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of doubles without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param data      Direct buffer of size nVectors x nFeatures
+     * @param nFeatures Number of features in numeric table
+     * @param nVectors  Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, DoubleBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of doubles without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context        Context to manage created homogeneous numeric table
+     * @param featuresEqual  Flag that makes all features in the Numeric Table Data Dictionary equal
+     * @param data           Direct buffer of size nVectors x nFeatures
+     * @param nFeatures      Number of features in numeric table
+     * @param nVectors       Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, DoubleBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, featuresEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of floats without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param data      Direct buffer of size nVectors x nFeatures
+     * @param nFeatures Number of features in numeric table
+     * @param nVectors  Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, FloatBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of floats without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context        Context to manage created homogeneous numeric table
+     * @param featuresEqual  Flag that makes all features in the Numeric Table Data Dictionary equal
+     * @param data           Direct buffer of size nVectors x nFeatures
+     * @param nFeatures      Number of features in numeric table
+     * @param nVectors       Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, FloatBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, featuresEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of longs without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param data      Direct buffer of size nVectors x nFeatures
+     * @param nFeatures Number of features in numeric table
+     * @param nVectors  Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, LongBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of longs without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context        Context to manage created homogeneous numeric table
+     * @param featuresEqual  Flag that makes all features in the Numeric Table Data Dictionary equal
+     * @param data           Direct buffer of size nVectors x nFeatures
+     * @param nFeatures      Number of features in numeric table
+     * @param nVectors       Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, LongBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, featuresEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of integers without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param data      Direct buffer of size nVectors x nFeatures
+     * @param nFeatures Number of features in numeric table
+     * @param nVectors  Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, IntBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer of integers without copying it.
+     * The buffer must have the native byte order, the data is modified in place by the table
+     *
+     * @param context        Context to manage created homogeneous numeric table
+     * @param featuresEqual  Flag that makes all features in the Numeric Table Data Dictionary equal
+     * @param data           Direct buffer of size nVectors x nFeatures
+     * @param nFeatures      Number of features in numeric table
+     * @param nVectors       Number of feature vectors in numeric table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, IntBuffer data, long nFeatures, long nVectors) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, data, nFeatures, nVectors, featuresEqual);
+    }
+
     /**
      * Constructs homogeneous numeric table from C++ homogeneous numeric
      *        table
@@ -584,6 +701,19 @@ public class HomogenNumericTable extends NumericTable {
         tableImpl.releaseBlockOfColumnValues(featureIndex, vectorIndex, vectorNum, buf);
     }
 
+    /**
+     * Enables or disables the blocks of rows returned by getBlockOfRows() that point to the memory of the table instead of copies.
+     * Such blocks are returned for the tables created over direct buffers or C++ tables if the table stores values of the requested type.
+     * The block keeps the memory of the table while the block is reachable, the blocks are disabled by default
+     *
+     * @param enabled  Flag that enables the blocks of rows that point to the memory of the table
+     */
+    public void setBlockViewsEnabled(boolean enabled) {
+        if (tableImpl instanceof HomogenNumericTableByteBufferImpl) {
+            ((HomogenNumericTableByteBufferImpl)tableImpl).setBlockViewsEnabled(enabled);
+        }
+    }
+
     /**
      * Gets data as an array of doubles
      * @return Table data as an array of double
@@ -22,12 +22,18 @@
 package com.intel.daal.data_management.data;
 
 import com.intel.daal.utils.*;
+import java.lang.ref.PhantomReference;
+import java.lang.ref.ReferenceQueue;
+import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
 import java.nio.DoubleBuffer;
 import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
 import java.nio.LongBuffer;
+import java.util.Collections;
+import java.util.HashSet;
+import java.util.Set;
 
 import com.intel.daal.services.DaalContext;
 
@@ -40,6 +46,25 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
 
     private static final long maxBufferSize = 2147483647;
 
+    /* Flag that enables the blocks of rows that point to the memory of the C++ table */
+    private boolean blockViewsEnabled = false;
+
+    /**
+     * Reference to the block of rows that points to the memory of the C++ table.
+     * The memory is kept by the C++ reference arrayRef until the block becomes unreachable
+     */
+    private static class BlockViewReference extends PhantomReference<Buffer> {
+        final long arrayRef;
+
+        BlockViewReference(Buffer view, long arrayRef) {
+            super(view, blockViewQueue);
+            this.arrayRef = arrayRef;
+        }
+    }
+
+    private static final ReferenceQueue<Buffer> blockViewQueue = new ReferenceQueue<Buffer>();
+    private static final Set<BlockViewReference> blockViews = Collections.synchronizedSet(new HashSet<BlockViewReference>());
+
     /** @private */
     static {
         LibUtils.loadLibrary();
@@ -120,6 +145,38 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         }
     }
 
+    /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,DataDictionary.FeaturesEqual,DoubleBuffer,long,long) */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, DoubleBuffer data, long nColumns, long nRows,
+            DataDictionary.FeaturesEqual featuresEqual) {
+        super(context);
+        checkDirectBuffer(data, data.order(), nColumns, nRows);
+        initHomogenNumericTable(context, Double.class, data, nColumns, nRows, featuresEqual);
+    }
+
+    /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,DataDictionary.FeaturesEqual,FloatBuffer,long,long) */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, FloatBuffer data, long nColumns, long nRows,
+            DataDictionary.FeaturesEqual featuresEqual) {
+        super(context);
+        checkDirectBuffer(data, data.order(), nColumns, nRows);
+        initHomogenNumericTable(context, Float.class, data, nColumns, nRows, featuresEqual);
+    }
+
+    /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,DataDictionary.FeaturesEqual,LongBuffer,long,long) */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, LongBuffer data, long nColumns, long nRows,
+            DataDictionary.FeaturesEqual featuresEqual) {
+        super(context);
+        checkDirectBuffer(data, data.order(), nColumns, nRows);
+        initHomogenNumericTable(context, Long.class, data, nColumns, nRows, featuresEqual);
+    }
+
+    /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,DataDictionary.FeaturesEqual,IntBuffer,long,long) */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, IntBuffer data, long nColumns, long nRows,
+            DataDictionary.FeaturesEqual featuresEqual) {
+        super(context);
+        checkDirectBuffer(data, data.order(), nColumns, nRows);
+        initHomogenNumericTable(context, Integer.class, data, nColumns, nRows, featuresEqual);
+    }
+
     /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,Class<? extends Number>,DataDictionary) */
     public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, DataDictionary dict) {
         super(context);
@@ -166,6 +223,13 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         if (bufferSize * 8 > maxBufferSize) {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
+        if (blockViewsEnabled) {
+            long[] arrayRef = new long[1];
+            ByteBuffer byteView = getDoubleBlockView(getCObject(), vectorIndex, vectorNum, arrayRef);
+            if (byteView != null) {
+                return keepBlockView(byteView.order(ByteOrder.nativeOrder()).asDoubleBuffer(), arrayRef[0]);
+            }
+        }
         ByteBuffer byteBuf = ByteBuffer.allocateDirect((int)(bufferSize * 8) /* sizeof(double) */);
         byteBuf.order(ByteOrder.LITTLE_ENDIAN);
         byteBuf = getDoubleBlockBuffer(getCObject(), vectorIndex, vectorNum, byteBuf);
@@ -184,6 +248,13 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         if (bufferSize * 4 > maxBufferSize) {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
+        if (blockViewsEnabled) {
+            long[] arrayRef = new long[1];
+            ByteBuffer byteView = getFloatBlockView(getCObject(), vectorIndex, vectorNum, arrayRef);
+            if (byteView != null) {
+                return keepBlockView(byteView.order(ByteOrder.nativeOrder()).asFloatBuffer(), arrayRef[0]);
+            }
+        }
         ByteBuffer byteBuf = ByteBuffer.allocateDirect((int)(bufferSize * 4) /* sizeof(float) */);
         byteBuf.order(ByteOrder.LITTLE_ENDIAN);
         byteBuf = getFloatBlockBuffer(getCObject(), vectorIndex, vectorNum, byteBuf);
@@ -202,6 +273,13 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         if (bufferSize * 4> maxBufferSize) {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
+        if (blockViewsEnabled) {
+            long[] arrayRef = new long[1];
+            ByteBuffer byteView = getIntBlockView(getCObject(), vectorIndex, vectorNum, arrayRef);
+            if (byteView != null) {
+                return keepBlockView(byteView.order(ByteOrder.nativeOrder()).asIntBuffer(), arrayRef[0]);
+            }
+        }
         ByteBuffer byteBuf = ByteBuffer.allocateDirect((int)(bufferSize * 4) /* sizeof(int) */);
         byteBuf.order(ByteOrder.LITTLE_ENDIAN);
         byteBuf = getIntBlockBuffer(getCObject(), vectorIndex, vectorNum, byteBuf);
@@ -271,6 +349,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
 
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder() && buf.capacity() >= bufferSize) {
+            // Direct buffers are passed to C++ NumericTable object without intermediate copies
+            releaseDoubleBlockBuffer(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         double[] data = new double[buf.capacity()];
         buf.position(0);
         buf.get(data);
@@ -293,6 +377,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
 
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder() && buf.capacity() >= bufferSize) {
+            // Direct buffers are passed to C++ NumericTable object without intermediate copies
+            releaseFloatBlockBuffer(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         float[] data = new float[buf.capacity()];
         buf.position(0);
         buf.get(data);
@@ -315,6 +405,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
             throw new IllegalArgumentException("size of the block of rows cannot exceed 2 gigabytes");
         }
 
+        if (buf.isDirect() && buf.order() == ByteOrder.nativeOrder() && buf.capacity() >= bufferSize) {
+            // Direct buffers are passed to C++ NumericTable object without intermediate copies
+            releaseIntBlockBuffer(getCObject(), vectorIndex, vectorNum, buf);
+            return;
+        }
+
         int[] data = new int[buf.capacity()];
         buf.position(0);
         buf.get(data);
@@ -613,6 +709,68 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         }
     }
 
+    /**
+     * Enables or disables the blocks of rows returned by getBlockOfRows() that point to the memory of the C++ table instead of copies
+     * @param enabled  Flag that enables the blocks of rows that point to the memory of the table
+     */
+    public void setBlockViewsEnabled(boolean enabled) {
+        blockViewsEnabled = enabled;
+        releaseUnreachableBlockViews();
+    }
+
+    /* Keeps the memory of the C++ table referenced by arrayRef while the block of rows is reachable */
+    private static <T extends Buffer> T keepBlockView(T view, long arrayRef) {
+        releaseUnreachableBlockViews();
+        blockViews.add(new BlockViewReference(view, arrayRef));
+        return view;
+    }
+
+    /* Releases the memory of the C++ tables kept by the blocks of rows that became unreachable */
+    private static void releaseUnreachableBlockViews() {
+        BlockViewReference ref;
+        while ((ref = (BlockViewReference)blockViewQueue.poll()) != null) {
+            blockViews.remove(ref);
+            releaseArrayRef(ref.arrayRef);
+        }
+    }
+
+    private void initHomogenNumericTable(DaalContext context, Class<? extends Number> cls, Buffer data, long nColumns, long nRows,
+            DataDictionary.FeaturesEqual featuresEqual) {
+        if (cls == Double.class) {
+            cObject = dInitDirect(data, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Float.class) {
+            cObject = sInitDirect(data, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Long.class) {
+            cObject = lInitDirect(data, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Integer.class) {
+            cObject = iInitDirect(data, nColumns, nRows, featuresEqual.ordinal());
+        } else {
+            throw new IllegalArgumentException("type unsupported");
+        }
+        dict = new DataDictionary(context, nColumns, cGetCDataDictionary(cObject));
+        if (dict.getFeaturesEqual().ordinal() == DataDictionary.FeaturesEqual.equal.ordinal()) {
+            dict.setFeature(cls, 0);
+        } else {
+            for (int i = 0; i < nColumns; i++) {
+                dict.setFeature(cls, i);
+            }
+        }
+        type = cls;
+        dataAllocatedInJava = false;
+    }
+
+    private static void checkDirectBuffer(Buffer data, ByteOrder order, long nColumns, long nRows) {
+        if (!data.isDirect()) {
+            throw new IllegalArgumentException("buffer must be direct");
+        }
+        if (order != ByteOrder.nativeOrder()) {
+            throw new IllegalArgumentException("byte order of the buffer must be native");
+        }
+        if (data.capacity() < nColumns * nRows) {
+            throw new IllegalArgumentException("size of the buffer is less than nColumns * nRows");
+        }
+    }
+
     private void initHomogenNumericTable(DaalContext context, Class<? extends Number> cls, DataDictionary dict) {
         this.dict = dict;
         cObject = dictInit(dict.getCObject());
@@ -627,6 +785,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native long iInit(long nColumns, int featuresEqual);
     private native long dictInit(long cObject);
 
+    /* Creates C++ HomogenNumericTable object over the memory of the direct buffer */
+    private native long dInitDirect(Buffer data, long nColumns, long nRows, int featuresEqual);
+    private native long sInitDirect(Buffer data, long nColumns, long nRows, int featuresEqual);
+    private native long lInitDirect(Buffer data, long nColumns, long nRows, int featuresEqual);
+    private native long iInitDirect(Buffer data, long nColumns, long nRows, int featuresEqual);
+
     private native void cAllocateDataMemoryDouble(long cObject);
     private native void cAllocateDataMemoryFloat(long cObject);
     private native void cAllocateDataMemoryLong(long cObject);
@@ -645,9 +809,16 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native ByteBuffer getFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
     private native ByteBuffer getIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
 
-    private native void releaseDoubleBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
-    private native void releaseFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
-    private native void releaseIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, ByteBuffer buffer);
+    /* Gets NIO buffer pointing to the rows of the C++ table, null if the table stores values of other type.
+       arrayRef[0] receives the reference to the table memory that must be released by releaseArrayRef() */
+    private native ByteBuffer getDoubleBlockView(long cObject, long vectorIndex, long vectorNum, long[] arrayRef);
+    private native ByteBuffer getFloatBlockView(long cObject, long vectorIndex, long vectorNum, long[] arrayRef);
+    private native ByteBuffer getIntBlockView(long cObject, long vectorIndex, long vectorNum, long[] arrayRef);
+    private static native void releaseArrayRef(long arrayRef);
+
+    private native void releaseDoubleBlockBuffer(long cObject, long vectorIndex, long vectorNum, Buffer buffer);
+    private native void releaseFloatBlockBuffer(long cObject, long vectorIndex, long vectorNum, Buffer buffer);
+    private native void releaseIntBlockBuffer(long cObject, long vectorIndex, long vectorNum, Buffer buffer);
 
     private native void assignLong(long cObject, long constValue);
     private native void assignInt(long cObject, int constValue);
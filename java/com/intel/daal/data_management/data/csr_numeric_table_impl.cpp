@@ -27,10 +27,42 @@
 #include "java_csr_numeric_table.h"
 #include "daal.h"
 #include "com/intel/daal/common_helpers_functions.h"
+#include "java_direct_buffer.h"
 
 using namespace daal;
 using namespace daal::data_management;
 
+template <typename T>
+static jlong initDirectCSRNumericTable(JNIEnv * env, jobject data, jobject colIndices, jobject rowOffsets, jlong nFeatures, jlong nVectors,
+                                       jint indexing)
+{
+    services::SharedPtr<T> values = wrapJavaDirectBuffer<T>(env, data);
+    if (!values)
+    {
+        return 0;
+    }
+    services::SharedPtr<size_t> cols = wrapJavaDirectBuffer<size_t>(env, colIndices);
+    if (!cols)
+    {
+        return 0;
+    }
+    services::SharedPtr<size_t> rows = wrapJavaDirectBuffer<size_t>(env, rowOffsets);
+    if (!rows)
+    {
+        return 0;
+    }
+
+    services::Status st;
+    CSRNumericTablePtr tbl =
+        CSRNumericTable::create<T>(values, cols, rows, (size_t)nFeatures, (size_t)nVectors, (CSRNumericTableIface::CSRIndexing)indexing, &st);
+    if (!st)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), st.getDescription());
+        return 0;
+    }
+    return (jlong) new SerializationIfacePtr(tbl);
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_CSRNumericTableImpl
  * Method:    initCSRNumericTable
@@ -208,3 +240,27 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_CSRNumericTa
     jobject byteBuffer = env->NewDirectByteBuffer(ptr, ((jlong)dataSize * sizeof(int)));
     return byteBuffer;
 }
+
+/*
+ * Class:     com_intel_daal_data_1management_data_CSRNumericTableImpl
+ * Method:    dInitDirect
+ * Signature:(Ljava/nio/Buffer;Ljava/nio/LongBuffer;Ljava/nio/LongBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_CSRNumericTableImpl_dInitDirect(JNIEnv * env, jobject thisObj, jobject data,
+                                                                                                  jobject colIndices, jobject rowOffsets,
+                                                                                                  jlong nFeatures, jlong nVectors, jint indexing)
+{
+    return initDirectCSRNumericTable<double>(env, data, colIndices, rowOffsets, nFeatures, nVectors, indexing);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_CSRNumericTableImpl
+ * Method:    sInitDirect
+ * Signature:(Ljava/nio/Buffer;Ljava/nio/LongBuffer;Ljava/nio/LongBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_CSRNumericTableImpl_sInitDirect(JNIEnv * env, jobject thisObj, jobject data,
+                                                                                                  jobject colIndices, jobject rowOffsets,
+                                                                                                  jlong nFeatures, jlong nVectors, jint indexing)
+{
+    return initDirectCSRNumericTable<float>(env, data, colIndices, rowOffsets, nFeatures, nVectors, indexing);
+}
@@ -21,10 +21,63 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "com/intel/daal/common_helpers_functions.h"
+#include "java_direct_buffer.h"
 
 using namespace daal;
 using namespace daal::data_management;
 
+template <typename T>
+static jlong initDirectHomogenNumericTable(JNIEnv * env, jobject buffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    services::SharedPtr<T> data = wrapJavaDirectBuffer<T>(env, buffer);
+    if (!data)
+    {
+        return 0;
+    }
+
+    HomogenNumericTable<T> * tbl = new HomogenNumericTable<T>((DictionaryIface::FeaturesEqual)featuresEqual, data, nColumns, nRows);
+    SerializationIfacePtr * sPtr = new SerializationIfacePtr(tbl);
+    if (tbl->getErrors()->size() > 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), tbl->getErrors()->getDescription());
+    }
+    return (jlong)sPtr;
+}
+
+/*
+ * Returns the buffer that points to the rows of the table memory or NULL if the table does not store values of type T.
+ * The reference to the table memory is written to arrayRef, so the memory is kept after the table is resized or disposed
+ * until the reference is released by releaseArrayRef()
+ */
+template <typename T>
+static jobject getBlockView(JNIEnv * env, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jlongArray arrayRef)
+{
+    HomogenNumericTable<T> * nt = dynamic_cast<HomogenNumericTable<T> *>(((SerializationIfacePtr *)numTableAddr)->get());
+    if (!nt || !nt->getArray())
+    {
+        return NULL;
+    }
+
+    const size_t nRows = nt->getNumberOfRows();
+    const size_t nCols = nt->getNumberOfColumns();
+    if ((size_t)vectorIndex >= nRows)
+    {
+        return NULL;
+    }
+    const size_t nBlockRows = ((size_t)vectorNum > nRows - vectorIndex ? nRows - vectorIndex : (size_t)vectorNum);
+
+    jobject byteBuffer = env->NewDirectByteBuffer(nt->getArray() + vectorIndex * nCols, (jlong)(nBlockRows * nCols * sizeof(T)));
+    if (!byteBuffer)
+    {
+        return NULL;
+    }
+
+    services::SharedPtr<byte> * memory = new services::SharedPtr<byte>(services::reinterpretPointerCast<byte, T>(nt->getArraySharedPtr()));
+    const jlong memoryAddr             = (jlong)memory;
+    env->SetLongArrayRegion(arrayRef, 0, 1, &memoryAddr);
+    return byteBuffer;
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getIndexType
@@ -182,7 +235,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    releaseFloatBlockBuffer
- * Signature:(JJJLjava/nio/ByteBuffer;)V
+ * Signature:(JJJLjava/nio/Buffer;)V
  */
 JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseFloatBlockBuffer(
     JNIEnv * env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject byteBuffer)
@@ -196,9 +249,13 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     float * data      = block.getBlockPtr();
     const float * src = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for (size_t i = 0; i < vectorNum * nCols; i++)
+    /* Buffer returned by get*BlockView() points to the table memory, data is already in place */
+    if (data != src)
     {
-        data[i] = src[i];
+        for (size_t i = 0; i < vectorNum * nCols; i++)
+        {
+            data[i] = src[i];
+        }
     }
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
@@ -207,7 +264,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    releaseDoubleBlockBuffer
- * Signature:(JJJLjava/nio/ByteBuffer;)V
+ * Signature:(JJJLjava/nio/Buffer;)V
  */
 JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseDoubleBlockBuffer(
     JNIEnv * env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject byteBuffer)
@@ -221,9 +278,13 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     double * data      = block.getBlockPtr();
     const double * src = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for (size_t i = 0; i < vectorNum * nCols; i++)
+    /* Buffer returned by get*BlockView() points to the table memory, data is already in place */
+    if (data != src)
     {
-        data[i] = src[i];
+        for (size_t i = 0; i < vectorNum * nCols; i++)
+        {
+            data[i] = src[i];
+        }
     }
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
@@ -232,7 +293,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    releaseIntBlockBuffer
- * Signature:(JJJLjava/nio/ByteBuffer;)V
+ * Signature:(JJJLjava/nio/Buffer;)V
  */
 JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseIntBlockBuffer(
     JNIEnv * env, jobject thisObj, jlong numTableAddr, jlong vectorIndex, jlong vectorNum, jobject byteBuffer)
@@ -246,9 +307,13 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     int * data      = block.getBlockPtr();
     const int * src = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for (size_t i = 0; i < vectorNum * nCols; i++)
+    /* Buffer returned by get*BlockView() points to the table memory, data is already in place */
+    if (data != src)
     {
-        data[i] = src[i];
+        for (size_t i = 0; i < vectorNum * nCols; i++)
+        {
+            data[i] = src[i];
+        }
     }
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
@@ -742,3 +807,104 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     DAAL_CHECK_THROW(((HomogenNumericTable<int> *)tbl)->allocateDataMemory());
 }
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    dInitDirect
+ * Signature:(Ljava/nio/Buffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_dInitDirect(JNIEnv * env, jobject thisObj,
+                                                                                                                jobject buffer, jlong nColumns,
+                                                                                                                jlong nRows, jint featuresEqual)
+{
+    return initDirectHomogenNumericTable<double>(env, buffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    sInitDirect
+ * Signature:(Ljava/nio/Buffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_sInitDirect(JNIEnv * env, jobject thisObj,
+                                                                                                                jobject buffer, jlong nColumns,
+                                                                                                                jlong nRows, jint featuresEqual)
+{
+    return initDirectHomogenNumericTable<float>(env, buffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    lInitDirect
+ * Signature:(Ljava/nio/Buffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_lInitDirect(JNIEnv * env, jobject thisObj,
+                                                                                                                jobject buffer, jlong nColumns,
+                                                                                                                jlong nRows, jint featuresEqual)
+{
+    return initDirectHomogenNumericTable<__int64>(env, buffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    iInitDirect
+ * Signature:(Ljava/nio/Buffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_iInitDirect(JNIEnv * env, jobject thisObj,
+                                                                                                                jobject buffer, jlong nColumns,
+                                                                                                                jlong nRows, jint featuresEqual)
+{
+    return initDirectHomogenNumericTable<int>(env, buffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getDoubleBlockView
+ * Signature:(JJJ[J)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getDoubleBlockView(JNIEnv * env, jobject thisObj,
+                                                                                                                      jlong numTableAddr,
+                                                                                                                      jlong vectorIndex,
+                                                                                                                      jlong vectorNum,
+                                                                                                                      jlongArray arrayRef)
+{
+    return getBlockView<double>(env, numTableAddr, vectorIndex, vectorNum, arrayRef);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getFloatBlockView
+ * Signature:(JJJ[J)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getFloatBlockView(JNIEnv * env, jobject thisObj,
+                                                                                                                      jlong numTableAddr,
+                                                                                                                      jlong vectorIndex,
+                                                                                                                      jlong vectorNum,
+                                                                                                                      jlongArray arrayRef)
+{
+    return getBlockView<float>(env, numTableAddr, vectorIndex, vectorNum, arrayRef);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getIntBlockView
+ * Signature:(JJJ[J)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getIntBlockView(JNIEnv * env, jobject thisObj,
+                                                                                                                      jlong numTableAddr,
+                                                                                                                      jlong vectorIndex,
+                                                                                                                      jlong vectorNum,
+                                                                                                                      jlongArray arrayRef)
+{
+    return getBlockView<int>(env, numTableAddr, vectorIndex, vectorNum, arrayRef);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    releaseArrayRef
+ * Signature:(J)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_releaseArrayRef(JNIEnv * env, jclass cls,
+                                                                                                                   jlong arrayRef)
+{
+    delete (services::SharedPtr<byte> *)arrayRef;
+}
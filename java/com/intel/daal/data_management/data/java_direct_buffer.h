@@ -0,0 +1,118 @@
+/* file: java_direct_buffer.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Helpers that let C++ objects use the memory of Java direct buffers without copying
+//--
+*/
+
+#ifndef __JAVA_DIRECT_BUFFER_H__
+#define __JAVA_DIRECT_BUFFER_H__
+
+#include <jni.h>
+
+#include "services/daal_shared_ptr.h"
+
+namespace daal
+{
+/**
+ * Deleter that keeps the Java direct buffer reachable while its memory is used by a C++ object
+ * and releases the global reference to the buffer when the memory is not needed anymore
+ */
+class JavaDirectBufferDeleter : public services::DeleterIface
+{
+public:
+    JavaDirectBufferDeleter(JavaVM * jvm, jobject buffer) : _jvm(jvm), _buffer(buffer) {}
+
+    void operator()(const void * ptr) DAAL_C11_OVERRIDE
+    {
+        JNIEnv * env    = NULL;
+        bool isAttached = false;
+
+        jint status = _jvm->GetEnv((void **)&env, JNI_VERSION_1_6);
+        if (status == JNI_EDETACHED)
+        {
+            if (_jvm->AttachCurrentThread((void **)&env, NULL) != JNI_OK)
+            {
+                return;
+            }
+            isAttached = true;
+        }
+        else if (status != JNI_OK)
+        {
+            return;
+        }
+
+        env->DeleteGlobalRef(_buffer);
+
+        if (isAttached)
+        {
+            _jvm->DetachCurrentThread();
+        }
+    }
+
+private:
+    JavaVM * _jvm;
+    jobject _buffer;
+};
+
+/**
+ * Returns the memory of the Java direct buffer as a shared pointer without copying the data.
+ * Throws a Java exception and returns an empty pointer if the buffer is not direct or its position is not zero,
+ * because the memory of the buffer is used starting from its first element
+ */
+template <typename T>
+services::SharedPtr<T> wrapJavaDirectBuffer(JNIEnv * env, jobject buffer)
+{
+    T * data = (T *)(env->GetDirectBufferAddress(buffer));
+    if (!data)
+    {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "buffer is not direct");
+        return services::SharedPtr<T>();
+    }
+
+    jmethodID positionMethod = env->GetMethodID(env->FindClass("java/nio/Buffer"), "position", "()I");
+    if (!positionMethod)
+    {
+        return services::SharedPtr<T>();
+    }
+    if (env->CallIntMethod(buffer, positionMethod) != 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "position of the buffer is not zero");
+        return services::SharedPtr<T>();
+    }
+
+    JavaVM * jvm;
+    if (env->GetJavaVM(&jvm) != 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), "Error: Couldn't get Java VM");
+        return services::SharedPtr<T>();
+    }
+
+    jobject bufferRef = env->NewGlobalRef(buffer);
+    if (!bufferRef)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), "Couldn't create global ref from buffer");
+        return services::SharedPtr<T>();
+    }
+    return services::SharedPtr<T>(data, JavaDirectBufferDeleter(jvm, bufferRef));
+}
+
+} // namespace daal
+
+#endif